@@ -0,0 +1,94 @@
+#include "BenchStandIn.h"
+#include "AgentBase.h"
+#include "Server.h"
+#include "internal/Packet.h"
+#include "service/ServiceModule.h"
+
+#include <AgentHandlerImpl.h>
+
+
+UBenchService::UBenchService(std::string name)
+    : mName(std::move(name)) {
+}
+
+UBenchService::~UBenchService() {
+}
+
+std::string UBenchService::GetServiceName() const {
+    return mName;
+}
+
+void UBenchService::OnRequest(const int64_t pid, const FPackageHandle &pkg) const {
+    SendToClient(pid, pkg);
+}
+
+UBenchPlayer::UBenchPlayer()
+    : mServiceID(INVALID_SERVICE_ID) {
+}
+
+UBenchPlayer::~UBenchPlayer() {
+}
+
+void UBenchPlayer::Initial() {
+    IPlayerBase::Initial();
+
+    if (const auto *module = GetServer()->GetModule<UServiceModule>()) {
+        if (const auto services = module->GetAllServiceMap(); !services.empty()) {
+            mServiceID = services.begin()->first;
+        }
+    }
+}
+
+void UBenchPlayer::OnPackage(IPackage_Interface *pkg) {
+    auto *request = TagCast<FPacket>(pkg);
+    if (request == nullptr)
+        return;
+
+    const auto reply = GetAgent()->BuildPackage().CastTo<FPacket>();
+    if (reply == nullptr)
+        return;
+
+    reply->CopyFrom(request);
+
+    switch (request->GetPackageID()) {
+        case BENCH_ECHO_PACKAGE_ID: {
+            SendPackage(reply);
+        } break;
+        case BENCH_SERVICE_PACKAGE_ID: {
+            if (mServiceID != INVALID_SERVICE_ID) {
+                PostTaskT<UBenchService>(mServiceID, &UBenchService::OnRequest, GetPlayerID(), FPackageHandle(reply));
+            }
+        } break;
+        default: break;
+    }
+}
+
+void UBenchPlayerFactory::Initial() {
+}
+
+FPlayerHandle UBenchPlayerFactory::CreatePlayer() {
+    return FPlayerHandle{ new UBenchPlayer(), this };
+}
+
+unique_ptr<IAgentHandler> UBenchPlayerFactory::CreateAgentHandler() const {
+    return make_unique<UAgentHandlerImpl>();
+}
+
+void UBenchPlayerFactory::DestroyPlayer(IPlayerBase *pPlayer) {
+    delete dynamic_cast<UBenchPlayer *>(pPlayer);
+}
+
+void UBenchServiceFactory::LoadService() {
+}
+
+FServiceHandle UBenchServiceFactory::CreateInstance(const std::string &path) {
+    const auto pos = path.find('.');
+    if (pos == std::string::npos)
+        return {};
+
+    return { new UBenchService(path.substr(pos + 1)), this, path };
+}
+
+void UBenchServiceFactory::DestroyInstance(IServiceBase *pService, const std::string &path) {
+    delete dynamic_cast<UBenchService *>(pService);
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "gateway/PlayerBase.h"
+#include "service/ServiceBase.h"
+#include "factory/PlayerFactory.h"
+#include "factory/ServiceFactory.h"
+
+#include <string>
+
+
+/** Answered By The Player Directly **/
+inline constexpr uint32_t BENCH_ECHO_PACKAGE_ID     = 2001;
+
+/** Answered By The Service, Through The Route Module And The Service Channel **/
+inline constexpr uint32_t BENCH_SERVICE_PACKAGE_ID  = 2002;
+
+
+/**
+ * The Stand-In Of The Service Libraries, Send The Request Back To The Client
+ */
+class UBenchService final : public IServiceBase {
+
+public:
+    DECLARE_TYPE_TAG(UBenchService, type_tag::USER + 101, IServiceBase)
+
+    explicit UBenchService(std::string name);
+    ~UBenchService() override;
+
+    [[nodiscard]] std::string GetServiceName() const override;
+
+    void OnRequest(int64_t pid, const FPackageHandle &pkg) const;
+
+private:
+    std::string mName;
+};
+
+
+/**
+ * The Stand-In Of The Agent Library, Echo Or Forward The Request To The First Service
+ */
+class UBenchPlayer final : public IPlayerBase {
+
+public:
+    DECLARE_TYPE_TAG(UBenchPlayer, type_tag::USER + 102, IPlayerBase)
+
+    UBenchPlayer();
+    ~UBenchPlayer() override;
+
+    void Initial() override;
+
+    void OnPackage(IPackage_Interface *pkg) override;
+
+private:
+    int64_t mServiceID;
+};
+
+
+/**
+ * Create The Player In Process Instead Of Loading The Agent Library
+ */
+class UBenchPlayerFactory final : public IPlayerFactory_Interface {
+
+public:
+    void Initial() override;
+
+    [[nodiscard]] FPlayerHandle CreatePlayer() override;
+    [[nodiscard]] unique_ptr<IAgentHandler> CreateAgentHandler() const override;
+
+    void DestroyPlayer(IPlayerBase *pPlayer) override;
+};
+
+
+/**
+ * Create The Services In Process Instead Of Loading The Service Libraries,
+ * Every Configured Service Becomes An UBenchService With The Same Name
+ */
+class UBenchServiceFactory final : public IServiceFactory_Interface {
+
+public:
+    void LoadService() override;
+
+    [[nodiscard]] FServiceHandle CreateInstance(const std::string &path) override;
+    void DestroyInstance(IServiceBase *pService, const std::string &path) override;
+};
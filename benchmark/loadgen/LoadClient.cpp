@@ -0,0 +1,189 @@
+#include "LoadClient.h"
+#include "BenchStandIn.h"
+#include "internal/PacketCodec.h"
+
+#include <login.pb.h>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+
+namespace {
+    int64_t NowNanoseconds() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    uint64_t ElapsedMicroseconds(const ASteadyTimePoint begin) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+    }
+}
+
+
+ULoadClient::ULoadClient(asio::io_context &ctx, asio::ssl::context *ssl, const FLoadOptions &options, FLoadStatistics &stats, const int64_t pid)
+    : mContext(ctx),
+      mSSLContext(ssl),
+      mOptions(options),
+      mStatistics(stats),
+      mPlayerID(pid),
+      mPayload(options.payload, 'x'),
+      mRandom(static_cast<uint32_t>(pid)) {
+}
+
+ULoadClient::~ULoadClient() {
+    Disconnect();
+}
+
+awaitable<void> ULoadClient::Run(const ASteadyTimePoint deadline) {
+    try {
+        if (!co_await Connect() || !co_await Login()) {
+            mStatistics.failed.fetch_add(1, std::memory_order_relaxed);
+            Disconnect();
+            co_return;
+        }
+
+        const int total = mOptions.heartbeat + mOptions.echo + mOptions.service;
+        std::uniform_int_distribution<int> dist(0, std::max(total, 1) - 1);
+
+        ASteadyTimer timer(mContext);
+
+        while (std::chrono::steady_clock::now() < deadline) {
+            bool ret;
+
+            if (const auto pick = dist(mRandom); pick < mOptions.heartbeat) {
+                ret = co_await Heartbeat();
+            } else if (pick < mOptions.heartbeat + mOptions.echo) {
+                ret = co_await Request(BENCH_ECHO_PACKAGE_ID, mStatistics.echo);
+            } else {
+                ret = co_await Request(BENCH_SERVICE_PACKAGE_ID, mStatistics.service);
+            }
+
+            if (!ret) {
+                mStatistics.failed.fetch_add(1, std::memory_order_relaxed);
+                break;
+            }
+
+            if (mOptions.think > 0) {
+                timer.expires_after(std::chrono::milliseconds(mOptions.think));
+                co_await timer.async_wait();
+            }
+        }
+    } catch (const std::exception &e) {
+        SPDLOG_ERROR("{:<20} - Player[{}] {}", __FUNCTION__, mPlayerID, e.what());
+        mStatistics.failed.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Disconnect();
+}
+
+awaitable<bool> ULoadClient::Connect() {
+    const auto begin = std::chrono::steady_clock::now();
+
+    ATcpSocket socket(mContext);
+    const asio::ip::tcp::endpoint endpoint(asio::ip::make_address(mOptions.host), mOptions.port);
+
+    if (const auto [ec] = co_await socket.async_connect(endpoint); ec) {
+        SPDLOG_WARN("{:<20} - Player[{}] Failed To Connect: {}", __FUNCTION__, mPlayerID, ec.message());
+        co_return false;
+    }
+
+    socket.set_option(asio::ip::tcp::no_delay(true));
+
+    if (mOptions.bTLS) {
+        mCodec = std::make_unique<UPacketCodec>(ASslStream(std::move(socket), *mSSLContext), ECodecSide::CLIENT);
+    } else {
+        mCodec = std::make_unique<UPlainPacketCodec>(std::move(socket));
+    }
+
+    if (!co_await mCodec->Initial())
+        co_return false;
+
+    mStatistics.connect.Record(ElapsedMicroseconds(begin));
+    mStatistics.connected.fetch_add(1, std::memory_order_relaxed);
+
+    co_return true;
+}
+
+awaitable<bool> ULoadClient::Login() {
+    const auto begin = std::chrono::steady_clock::now();
+
+    Login::LoginRequest request;
+    request.set_player_id(mPlayerID);
+    request.set_token("benchmark");
+
+    mRequest.SetMagic(mOptions.magic);
+    mRequest.SetPackageID(LOGIN_REQUEST_PACKAGE_ID);
+    mRequest.SetSource(CLIENT_TARGET_ID);
+    mRequest.SetTarget(PLAYER_TARGET_ID);
+    mRequest.SetData(request.SerializeAsString());
+
+    if (!co_await mCodec->Encode(&mRequest))
+        co_return false;
+
+    mStatistics.sent.fetch_add(1, std::memory_order_relaxed);
+
+    if (!co_await WaitFor(LOGIN_RESPONSE_PACKAGE_ID))
+        co_return false;
+
+    mStatistics.login.Record(ElapsedMicroseconds(begin));
+    mStatistics.loggedIn.fetch_add(1, std::memory_order_relaxed);
+    mStatistics.lastLogin.store(NowNanoseconds(), std::memory_order_relaxed);
+
+    co_return true;
+}
+
+awaitable<bool> ULoadClient::Heartbeat() {
+    Login::Heartbeat heartbeat;
+    heartbeat.set_player_id(mPlayerID);
+
+    mRequest.SetPackageID(HEARTBEAT_PACKAGE_ID);
+    mRequest.SetData(heartbeat.SerializeAsString());
+
+    // The Server Does Not Reply The Heartbeat
+    if (!co_await mCodec->Encode(&mRequest))
+        co_return false;
+
+    mStatistics.sent.fetch_add(1, std::memory_order_relaxed);
+    co_return true;
+}
+
+awaitable<bool> ULoadClient::Request(const uint32_t id, UMetricHistogram &histogram) {
+    const auto begin = std::chrono::steady_clock::now();
+
+    mRequest.SetPackageID(id);
+    mRequest.SetData(mPayload);
+
+    if (!co_await mCodec->Encode(&mRequest))
+        co_return false;
+
+    mStatistics.sent.fetch_add(1, std::memory_order_relaxed);
+
+    if (!co_await WaitFor(id))
+        co_return false;
+
+    histogram.Record(ElapsedMicroseconds(begin));
+    co_return true;
+}
+
+awaitable<bool> ULoadClient::WaitFor(const uint32_t id) {
+    while (true) {
+        if (!co_await mCodec->Decode(&mResponse))
+            co_return false;
+
+        mStatistics.received.fetch_add(1, std::memory_order_relaxed);
+
+        if (mResponse.GetPackageID() == id)
+            co_return true;
+
+        if (mResponse.GetPackageID() == LOGIN_FAILED_PACKAGE_ID ||
+            mResponse.GetPackageID() == LOGIN_REPEATED_PACKAGE_ID) {
+            SPDLOG_WARN("{:<20} - Player[{}] Kicked By Package[{}]", __FUNCTION__, mPlayerID, mResponse.GetPackageID());
+            co_return false;
+        }
+    }
+}
+
+void ULoadClient::Disconnect() const {
+    if (mCodec != nullptr && mCodec->GetSocket().is_open()) {
+        std::error_code ec;
+        mCodec->GetSocket().close(ec);
+    }
+}
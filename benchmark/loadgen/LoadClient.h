@@ -0,0 +1,117 @@
+#pragma once
+
+#include "base/Types.h"
+#include "internal/Packet.h"
+#include "monitor/Metrics.h"
+
+#include <asio/ssl/context.hpp>
+#include <random>
+#include <memory>
+#include <string>
+
+
+class IPackageCodec_Interface;
+
+
+/**
+ * The Options Of One Load Run
+ */
+struct FLoadOptions {
+    std::string host = "127.0.0.1";
+    uint16_t port = 8080;
+    uint32_t magic = 0;
+
+    bool bTLS = true;
+
+    /** The Count Of The Connections And The Client Threads **/
+    int connections = 100;
+    int threads = 4;
+
+    /** The Seconds Of The Whole Run, Include The Ramp-Up **/
+    int duration = 30;
+
+    /** The Weights Of The Request Mix After Login **/
+    int heartbeat = 10;
+    int echo = 45;
+    int service = 45;
+
+    /** The Bytes Of The Request Payload **/
+    size_t payload = 64;
+
+    /** The Milliseconds To Wait Between Two Requests Of A Connection **/
+    int think = 0;
+
+    /** The Player ID Of The First Connection **/
+    int64_t playerBase = 100000;
+};
+
+
+/**
+ * The Statistics Shared By All The Connections, Lock-Free
+ */
+struct FLoadStatistics {
+    /** The Latency In Microseconds **/
+    UMetricHistogram connect;
+    UMetricHistogram login;
+    UMetricHistogram echo;
+    UMetricHistogram service;
+
+    std::atomic_int64_t connected{0};
+    std::atomic_int64_t loggedIn{0};
+    std::atomic_int64_t failed{0};
+
+    /** The Messages Written To And Read From The Server **/
+    std::atomic_int64_t sent{0};
+    std::atomic_int64_t received{0};
+
+    /** The Time Point In Nanoseconds When The Last Connection Logged In **/
+    std::atomic_int64_t lastLogin{0};
+};
+
+
+/**
+ * One Headless Client, Connect And Login, Then Run The Request Mix Until The Deadline;
+ * Only One Request Is In Flight, So The Latency Is The Round Trip Of It
+ */
+class ULoadClient final {
+
+public:
+    ULoadClient(asio::io_context &ctx, asio::ssl::context *ssl, const FLoadOptions &options, FLoadStatistics &stats, int64_t pid);
+    ~ULoadClient();
+
+    DISABLE_COPY_MOVE(ULoadClient)
+
+    awaitable<void> Run(ASteadyTimePoint deadline);
+
+private:
+    awaitable<bool> Connect();
+    awaitable<bool> Login();
+    awaitable<bool> Heartbeat();
+
+    /// Send The Request And Wait For The Reply With The Same Package ID
+    awaitable<bool> Request(uint32_t id, UMetricHistogram &histogram);
+
+    /// Read Until The Package With The Specific ID
+    awaitable<bool> WaitFor(uint32_t id);
+
+    void Disconnect() const;
+
+private:
+    asio::io_context &mContext;
+    asio::ssl::context *mSSLContext;
+
+    const FLoadOptions &mOptions;
+    FLoadStatistics &mStatistics;
+
+    const int64_t mPlayerID;
+
+    std::unique_ptr<IPackageCodec_Interface> mCodec;
+
+    FPacket mRequest;
+    FPacket mResponse;
+
+    /** The Payload Of The Echo And Service Requests **/
+    std::string mPayload;
+
+    std::mt19937 mRandom;
+};
@@ -0,0 +1,312 @@
+/**
+ * The Headless Client Swarm And The End-To-End Throughput Benchmark;
+ * Start An UServer In Process With The Stand-Ins Of The Agent And Service Libraries,
+ * Or Connect To An External One With --host, Then Report The Connection Rate,
+ * The Message Rate, The Latency Quantiles And The Server CPU Per Message.
+ *
+ * Usage: uranus_loadgen [--config <dir>] [--host <address>] [--port <port>] [--plain]
+ *                       [--connections <n>] [--threads <n>] [--duration <sec>]
+ *                       [--mix <heartbeat:echo:service>] [--payload <bytes>] [--think <ms>]
+ *                       [--output <file.json>]
+ */
+
+#include "LoadClient.h"
+#include "BenchStandIn.h"
+
+#include <Server.h>
+#include <config/Config.h>
+#include <login/LoginAuth.h>
+#include <event/EventModule.h>
+#include <gateway/Gateway.h>
+#include <service/ServiceModule.h>
+#include <route/RouteModule.h>
+#include <internal/CodecFactory.h>
+#include <monitor/AgentProfiler.h>
+#include <LoginHandlerImpl.h>
+
+#include <spdlog/spdlog.h>
+#include <nlohmann/json.hpp>
+#include <yaml-cpp/yaml.h>
+
+#include <cstdio>
+#include <fstream>
+#include <format>
+#include <iostream>
+#include <thread>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#endif
+
+
+namespace {
+    struct FArguments {
+        FLoadOptions options;
+
+        std::string config = "../../config";
+        std::string output;
+
+        /** Connect To The External Server, Do Not Start One In Process **/
+        bool bExternal = false;
+    };
+
+    bool ParseArguments(const int argc, char *argv[], FArguments &args) {
+        for (int idx = 1; idx < argc; ++idx) {
+            const std::string_view key = argv[idx];
+
+            if (key == "--plain") {
+                args.options.bTLS = false;
+                continue;
+            }
+
+            if (idx + 1 >= argc) {
+                std::cerr << std::format("Missing Value Of {}", key) << std::endl;
+                return false;
+            }
+
+            const std::string value = argv[++idx];
+
+            if (key == "--config") {
+                args.config = value;
+            } else if (key == "--host") {
+                args.options.host = value;
+                args.bExternal = true;
+            } else if (key == "--port") {
+                args.options.port = static_cast<uint16_t>(std::stoi(value));
+            } else if (key == "--connections") {
+                args.options.connections = std::max(std::stoi(value), 1);
+            } else if (key == "--threads") {
+                args.options.threads = std::max(std::stoi(value), 1);
+            } else if (key == "--duration") {
+                args.options.duration = std::max(std::stoi(value), 1);
+            } else if (key == "--mix") {
+                if (std::sscanf(value.c_str(), "%d:%d:%d", &args.options.heartbeat, &args.options.echo, &args.options.service) != 3) {
+                    std::cerr << std::format("Invalid Mix {}, Expect <heartbeat:echo:service>", value) << std::endl;
+                    return false;
+                }
+            } else if (key == "--payload") {
+                args.options.payload = std::stoul(value);
+            } else if (key == "--think") {
+                args.options.think = std::stoi(value);
+            } else if (key == "--output") {
+                args.output = value;
+            } else {
+                std::cerr << std::format("Unknown Option {}", key) << std::endl;
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// The CPU Time Of The Whole Process In Nanoseconds
+    int64_t ProcessCPUTime() {
+#if defined(_WIN32) || defined(_WIN64)
+        FILETIME create, exit, kernel, user;
+        if (!GetProcessTimes(GetCurrentProcess(), &create, &exit, &kernel, &user))
+            return 0;
+
+        const auto toInt = [](const FILETIME &ft) {
+            return (static_cast<int64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime;
+        };
+        return (toInt(kernel) + toInt(user)) * 100;
+#else
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+
+        const auto toInt = [](const timeval &tv) {
+            return static_cast<int64_t>(tv.tv_sec) * 1000000000 + static_cast<int64_t>(tv.tv_usec) * 1000;
+        };
+        return toInt(usage.ru_utime) + toInt(usage.ru_stime);
+#endif
+    }
+
+    UServer *CreateServer(const std::string &config, const bool bTLS) {
+        auto *server = new UServer();
+
+        if (auto *module = server->CreateModule<UConfig>(); module != nullptr) {
+            module->SetYAMLPath(config);
+            module->SetJSONPath(config);
+        }
+
+        if (auto *auth = server->CreateModule<ULoginAuth>(); auth != nullptr) {
+            auth->SetLoginHandler<ULoginHandlerImpl>();
+        }
+
+        server->CreateModule<UEventModule>();
+        server->CreateModule<URouteModule>();
+
+        if (auto *module = server->CreateModule<UServiceModule>(); module != nullptr) {
+            module->SetServiceFactory<UBenchServiceFactory>();
+        }
+
+        if (auto *gateway = server->CreateModule<UGateway>(); gateway != nullptr) {
+            gateway->SetPlayerFactory<UBenchPlayerFactory>();
+        }
+
+        if (bTLS) {
+            server->SetCodecFactory<UCodecFactory>();
+        } else {
+            server->SetCodecFactory<UPlainCodecFactory>();
+        }
+
+        return server;
+    }
+
+    nlohmann::json BuildLatency(const UMetricHistogram &histogram) {
+        return {
+            { "count", histogram.Count() },
+            { "p50", histogram.Percentile(0.5) },
+            { "p99", histogram.Percentile(0.99) },
+            { "p999", histogram.Percentile(0.999) },
+        };
+    }
+}
+
+
+int main(const int argc, char *argv[]) {
+    FArguments args;
+    if (!ParseArguments(argc, argv, args))
+        return EXIT_FAILURE;
+
+    spdlog::set_level(spdlog::level::warn);
+
+    auto &options = args.options;
+
+    // Take The Port And The Magic From The Same Configuration As The Server
+    try {
+        const auto cfg = YAML::LoadFile(args.config + SERVER_CONFIG_FILE);
+        if (options.port == FLoadOptions{}.port) {
+            options.port = cfg["server"]["port"].as<uint16_t>();
+        }
+        options.magic = cfg["package"]["magic"].as<uint32_t>();
+    } catch (const std::exception &e) {
+        std::cerr << std::format("Failed To Load The Configuration: {}", e.what()) << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    UServer *server = nullptr;
+    std::thread serverThread;
+
+    if (!args.bExternal) {
+        server = CreateServer(args.config, options.bTLS);
+        serverThread = std::thread([server] {
+            server->Initial();
+            server->Start();
+        });
+
+        // Wait For The Acceptor
+        while (server->GetState() != EServerState::RUNNING) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+
+    asio::ssl::context sslContext(asio::ssl::context::tlsv13_client);
+    sslContext.set_verify_mode(asio::ssl::verify_none);
+
+    FLoadStatistics stats;
+
+    std::vector<std::unique_ptr<asio::io_context>> contexts;
+    for (int idx = 0; idx < options.threads; ++idx) {
+        contexts.emplace_back(std::make_unique<asio::io_context>());
+    }
+
+    std::vector<std::unique_ptr<ULoadClient>> clients;
+    clients.reserve(options.connections);
+
+    const auto begin = std::chrono::steady_clock::now();
+    const auto deadline = begin + std::chrono::seconds(options.duration);
+
+    for (int idx = 0; idx < options.connections; ++idx) {
+        auto &ctx = *contexts[idx % contexts.size()];
+        auto &client = clients.emplace_back(std::make_unique<ULoadClient>(ctx, &sslContext, options, stats, options.playerBase + idx));
+
+        co_spawn(ctx, client->Run(deadline), detached);
+    }
+
+    std::atomic_int64_t clientCPU{0};
+    const auto processBegin = ProcessCPUTime();
+
+    std::vector<std::thread> threads;
+    for (const auto &ctx : contexts) {
+        threads.emplace_back([&ctx, &clientCPU] {
+            const auto cpuBegin = UAgentProfiler::ThreadCPUTime();
+            ctx->run();
+            clientCPU.fetch_add(UAgentProfiler::ThreadCPUTime() - cpuBegin, std::memory_order_relaxed);
+        });
+    }
+
+    for (auto &th : threads) {
+        th.join();
+    }
+
+    const auto processCPU = ProcessCPUTime() - processBegin;
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    clients.clear();
+
+    if (server != nullptr) {
+        asio::post(server->GetIOContext(), [server] {
+            server->Shutdown();
+        });
+
+        serverThread.join();
+        delete server;
+    }
+
+    // The Connection Rate Is Measured Over The Ramp-Up, Until The Last Login
+    const auto lastLogin = stats.lastLogin.load();
+    const auto rampUp = lastLogin > 0
+        ? static_cast<double>(lastLogin - std::chrono::duration_cast<std::chrono::nanoseconds>(begin.time_since_epoch()).count()) / 1e9
+        : elapsed;
+
+    const auto sent = stats.sent.load();
+    const auto received = stats.received.load();
+
+    nlohmann::json report;
+
+    report["transport"] = options.bTLS ? "tls" : "plain";
+    report["connections"] = options.connections;
+    report["threads"] = options.threads;
+    report["duration"] = elapsed;
+    report["mix"] = { options.heartbeat, options.echo, options.service };
+    report["payload"] = options.payload;
+
+    report["connected"] = stats.connected.load();
+    report["logged_in"] = stats.loggedIn.load();
+    report["failed"] = stats.failed.load();
+    report["connection_rate"] = rampUp > 0 ? static_cast<double>(stats.loggedIn.load()) / rampUp : 0.0;
+
+    report["sent"] = sent;
+    report["received"] = received;
+    report["messages_per_second"] = static_cast<double>(sent + received) / elapsed;
+
+    report["latency_us"] = {
+        { "connect", BuildLatency(stats.connect) },
+        { "login", BuildLatency(stats.login) },
+        { "echo", BuildLatency(stats.echo) },
+        { "service", BuildLatency(stats.service) },
+    };
+
+    // The Server Shares The Process, Exclude The CPU Of The Client Threads
+    if (!args.bExternal && sent > 0) {
+        const auto serverCPU = std::max<int64_t>(processCPU - clientCPU.load(), 0);
+        report["server_cpu_ns_per_message"] = static_cast<double>(serverCPU) / static_cast<double>(sent);
+    }
+
+    const auto output = report.dump(2);
+
+    std::cout << output << std::endl;
+
+    if (!args.output.empty()) {
+        std::ofstream file(args.output);
+        file << output << std::endl;
+    }
+
+    spdlog::drop_all();
+
+    return stats.failed.load() == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,98 @@
+#include "MicroBenchmark.h"
+
+#include "AgentBase.h"
+#include "ActorBase.h"
+
+#include <memory>
+
+
+namespace {
+    /** The Agent Only Drains Its Channel, The Default Actor Runs The Task **/
+    class UChatterAgent final : public IAgentBase {
+
+    public:
+        explicit UChatterAgent(asio::io_context &ctx)
+            : IAgentBase(ctx) {
+            mActor.SetUpAgent(this);
+        }
+
+        void Run() {
+            co_spawn(mContext, ProcessChannel(), detached);
+        }
+
+        void Close() {
+            mChannel.close();
+        }
+
+    protected:
+        [[nodiscard]] IActorBase *GetActor() const override {
+            return &mActor;
+        }
+
+    private:
+        mutable IActorBase mActor;
+    };
+}
+
+
+/**
+ * One Actor Pushes A Batch Of Tasks To Another By The Opt-In Inline Push, As The Actor Calls Chatter;
+ * On The Same Context The Receiver Is Idle And Runs Each Task Inline,
+ * On Another Context Every Task Goes Through The Channel.
+ * Both Contexts Are Polled By The Benchmark Thread, So Only The Delivery Differs
+ */
+static void BM_AgentChatter(benchmark::State &state) {
+    const bool bSameContext = state.range(0) != 0;
+    const int64_t batch = state.range(1);
+
+    asio::io_context senderContext;
+    asio::io_context otherContext;
+    auto &receiverContext = bSameContext ? senderContext : otherContext;
+
+    auto senderGuard = asio::make_work_guard(senderContext);
+    auto receiverGuard = asio::make_work_guard(otherContext);
+
+    const auto sender = std::make_shared<UChatterAgent>(senderContext);
+    const auto receiver = std::make_shared<UChatterAgent>(receiverContext);
+
+    sender->Run();
+    receiver->Run();
+
+    senderContext.poll();
+    otherContext.poll();
+
+    int64_t received = 0;
+
+    const AActorTask reply = [&received](IActorBase *) {
+        ++received;
+    };
+
+    const AActorTask chatter = [&receiver, &reply, batch](IActorBase *) {
+        for (int64_t idx = 0; idx < batch; ++idx) {
+            receiver->PushTaskInline(reply);
+        }
+    };
+
+    for (auto _ : state) {
+        received = 0;
+        sender->PushTask(chatter);
+
+        while (received < batch) {
+            senderContext.poll();
+            otherContext.poll();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * batch);
+    state.SetLabel(bSameContext ? "inline" : "channel");
+
+    sender->Close();
+    receiver->Close();
+
+    senderGuard.reset();
+    receiverGuard.reset();
+
+    senderContext.run();
+    otherContext.run();
+}
+BENCHMARK(BM_AgentChatter)->ArgsProduct({{0, 1}, {1, 64}});
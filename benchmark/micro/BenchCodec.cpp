@@ -0,0 +1,42 @@
+#include "MicroBenchmark.h"
+#include "MemoryStream.h"
+
+#include "internal/PacketCodec.h"
+
+
+static void BM_PacketCodec_EncodeDecode(benchmark::State &state) {
+    asio::io_context ctx;
+
+    TPacketCodec<FMemoryStream> codec{ FMemoryStream(ctx) };
+
+    const std::string payload(state.range(0), 'x');
+
+    FPacket request;
+    request.SetMagic(20250101);
+    request.SetPackageID(1001);
+    request.SetSource(1);
+    request.SetTarget(2);
+    request.SetData(payload);
+
+    FPacket response;
+
+    // The Benchmark Loop Runs Inside The Coroutine, Every Await Completes Through The Context
+    co_spawn(ctx, [&]() -> awaitable<void> {
+        for (auto _ : state) {
+            if (!co_await codec.EncodeT(&request)) {
+                state.SkipWithError("Encode Failed");
+                break;
+            }
+            if (!co_await codec.DecodeT(&response)) {
+                state.SkipWithError("Decode Failed");
+                break;
+            }
+        }
+    }, detached);
+
+    ctx.run();
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(FPacket::PACKAGE_HEADER_SIZE + payload.size()) * 2);
+}
+BENCHMARK(BM_PacketCodec_EncodeDecode)->Arg(0)->Arg(64)->Arg(1024)->Arg(16384);
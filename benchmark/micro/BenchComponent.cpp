@@ -0,0 +1,91 @@
+#include "MicroBenchmark.h"
+
+#include <ComponentSlots.h>
+
+#include <unordered_map>
+#include <typeindex>
+#include <memory>
+#include <utility>
+
+
+namespace {
+    /** Stand-In Of IPlayerComponent, Only The Lookup Is Measured **/
+    class IBenchComponent {
+    public:
+        virtual ~IBenchComponent() = default;
+        int64_t value = 0;
+    };
+
+    template<uint32_t Index>
+    class TBenchComponent final : public IBenchComponent {
+    public:
+        static constexpr uint32_t COMPONENT_TYPE = Index;
+    };
+
+    /** More Than The Components Of A Real Player **/
+    constexpr size_t COMPONENT_COUNT = 32;
+
+    using ABenchSlots = TComponentSlots<IBenchComponent, COMPONENT_COUNT>;
+
+    /// UComponentModule Before: Hash The type_index, Then dynamic_cast
+    class FLegacyComponentMap {
+    public:
+        template<class Type>
+        void Create() {
+            mComponentMap.insert_or_assign(typeid(Type), std::make_unique<Type>());
+        }
+
+        template<class Type>
+        Type *Get() const {
+            if (const auto iter = mComponentMap.find(std::type_index(typeid(Type))); iter != mComponentMap.end()) {
+                return dynamic_cast<Type *>(iter->second.get());
+            }
+            return nullptr;
+        }
+
+    private:
+        std::unordered_map<std::type_index, std::unique_ptr<IBenchComponent>> mComponentMap;
+    };
+
+    template<class Storage, size_t... Index>
+    void CreateAll(Storage &storage, std::index_sequence<Index...>) {
+        if constexpr (std::is_same_v<Storage, ABenchSlots>) {
+            (storage.template Emplace<TBenchComponent<Index>>(), ...);
+        } else {
+            (storage.template Create<TBenchComponent<Index>>(), ...);
+        }
+    }
+
+    /// Look Up Every Component Once, As A Burst Of Handlers Touching Different Components
+    template<class Storage, size_t... Index>
+    void TouchAll(const Storage &storage, std::index_sequence<Index...>) {
+        ((++storage.template Get<TBenchComponent<Index>>()->value), ...);
+    }
+}
+
+
+static void BM_Component_Dense(benchmark::State &state) {
+    ABenchSlots slots;
+    CreateAll(slots, std::make_index_sequence<COMPONENT_COUNT>());
+
+    for (auto _ : state) {
+        TouchAll(slots, std::make_index_sequence<COMPONENT_COUNT>());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * COMPONENT_COUNT);
+}
+BENCHMARK(BM_Component_Dense);
+
+static void BM_Component_HashMap(benchmark::State &state) {
+    FLegacyComponentMap map;
+    CreateAll(map, std::make_index_sequence<COMPONENT_COUNT>());
+
+    for (auto _ : state) {
+        TouchAll(map, std::make_index_sequence<COMPONENT_COUNT>());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * COMPONENT_COUNT);
+}
+BENCHMARK(BM_Component_HashMap);
@@ -0,0 +1,137 @@
+#include "MicroBenchmark.h"
+
+#include "ActorBase.h"
+#include "internal/Packet.h"
+
+#include <memory>
+#include <vector>
+
+
+namespace {
+    /** Stand-In Of IServiceBase And Two Services, The Depth Of A Real Service Under IActorBase **/
+    class IBenchService : public IActorBase {
+
+    public:
+        DECLARE_TYPE_TAG(IBenchService, type_tag::USER + 201, IActorBase)
+    };
+
+    class UBenchWorld final : public IBenchService {
+
+    public:
+        DECLARE_TYPE_TAG(UBenchWorld, type_tag::USER + 202, IBenchService)
+
+        int64_t value = 0;
+    };
+
+    class UBenchChat final : public IBenchService {
+
+    public:
+        DECLARE_TYPE_TAG(UBenchChat, type_tag::USER + 203, IBenchService)
+
+        int64_t value = 0;
+    };
+
+    /** Both Hit And Miss, As The Tasks Posted To Different Services **/
+    constexpr size_t ACTOR_COUNT = 64;
+
+    std::vector<std::unique_ptr<IActorBase>> CreateActors() {
+        std::vector<std::unique_ptr<IActorBase>> actors;
+        for (size_t idx = 0; idx < ACTOR_COUNT; ++idx) {
+            if (idx % 2 == 0)
+                actors.emplace_back(std::make_unique<UBenchWorld>());
+            else
+                actors.emplace_back(std::make_unique<UBenchChat>());
+        }
+        return actors;
+    }
+}
+
+
+/// The Codec And The Handlers Before: dynamic_cast From The Package Interface
+static void BM_Dispatch_Package_DynamicCast(benchmark::State &state) {
+    FPacket pkt;
+    IPackage_Interface *pkg = &pkt;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(pkg);
+        auto *temp = dynamic_cast<FPacket *>(pkg);
+        benchmark::DoNotOptimize(temp);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Dispatch_Package_DynamicCast);
+
+static void BM_Dispatch_Package_TypeTag(benchmark::State &state) {
+    FPacket pkt;
+    IPackage_Interface *pkg = &pkt;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(pkg);
+        auto *temp = TagCast<FPacket>(pkg);
+        benchmark::DoNotOptimize(temp);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Dispatch_Package_TypeTag);
+
+/// The PostTaskT Lambdas Before: dynamic_cast From The Actor To The Final Service
+static void BM_Dispatch_Actor_DynamicCast(benchmark::State &state) {
+    const auto actors = CreateActors();
+
+    for (auto _ : state) {
+        for (const auto &actor : actors) {
+            if (auto *world = dynamic_cast<UBenchWorld *>(actor.get()))
+                ++world->value;
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * ACTOR_COUNT);
+}
+BENCHMARK(BM_Dispatch_Actor_DynamicCast);
+
+static void BM_Dispatch_Actor_TypeTag(benchmark::State &state) {
+    const auto actors = CreateActors();
+
+    for (auto _ : state) {
+        for (const auto &actor : actors) {
+            if (auto *world = TagCast<UBenchWorld>(actor.get()))
+                ++world->value;
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * ACTOR_COUNT);
+}
+BENCHMARK(BM_Dispatch_Actor_TypeTag);
+
+/// The Ticker Casts To The Interface In The Middle Of The Hierarchy
+static void BM_Dispatch_Interface_DynamicCast(benchmark::State &state) {
+    const auto actors = CreateActors();
+
+    for (auto _ : state) {
+        for (const auto &actor : actors) {
+            auto *service = dynamic_cast<IBenchService *>(actor.get());
+            benchmark::DoNotOptimize(service);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * ACTOR_COUNT);
+}
+BENCHMARK(BM_Dispatch_Interface_DynamicCast);
+
+static void BM_Dispatch_Interface_TypeTag(benchmark::State &state) {
+    const auto actors = CreateActors();
+
+    for (auto _ : state) {
+        for (const auto &actor : actors) {
+            auto *service = TagCast<IBenchService>(actor.get());
+            benchmark::DoNotOptimize(service);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * ACTOR_COUNT);
+}
+BENCHMARK(BM_Dispatch_Interface_TypeTag);
@@ -0,0 +1,148 @@
+#include "MicroBenchmark.h"
+
+#include "Server.h"
+#include "AgentBase.h"
+#include "config/Config.h"
+#include "event/EventModule.h"
+
+#include <thread>
+
+
+namespace {
+    constexpr int BENCH_EVENT_TYPE = 1;
+
+    class FBenchEventParam final : public IEventParam_Interface {
+
+    public:
+        [[nodiscard]] int GetEventType() const override {
+            return BENCH_EVENT_TYPE;
+        }
+    };
+
+    /** The Agent Only Drains Its Channel, The Default Actor Ignores The Event **/
+    class UBenchListener final : public IAgentBase {
+
+    public:
+        explicit UBenchListener(asio::io_context &ctx)
+            : IAgentBase(ctx) {
+            mActor.SetUpAgent(this);
+        }
+
+        void Run() {
+            co_spawn(mContext, ProcessChannel(), detached);
+        }
+
+        void Close() {
+            mChannel.close();
+        }
+
+    protected:
+        [[nodiscard]] IActorBase *GetActor() const override {
+            return &mActor;
+        }
+
+    private:
+        mutable IActorBase mActor;
+    };
+
+    /**
+     * The Running Server With Only The Event Module,
+     * The Listeners Are Driven By Another Context As The Service Workers Do
+     */
+    class FEventFixture final {
+
+    public:
+        FEventFixture()
+            : mServer(new UServer()),
+              mGuard(asio::make_work_guard(mAgentContext)) {
+
+            if (auto *config = mServer->CreateModule<UConfig>(); config != nullptr) {
+                config->SetYAMLPath(micro::GetConfigPath());
+                config->SetJSONPath(micro::GetConfigPath());
+            }
+            mEvent = mServer->CreateModule<UEventModule>();
+
+            mServerThread = std::thread([this] {
+                mServer->Initial();
+                mServer->Start();
+            });
+
+            while (mServer->GetState() != EServerState::RUNNING) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+
+            mAgentThread = std::thread([this] {
+                mAgentContext.run();
+            });
+        }
+
+        ~FEventFixture() {
+            for (const auto &agent : mListeners) {
+                asio::post(mAgentContext, [agent] { agent->Close(); });
+            }
+            mGuard.reset();
+            mAgentThread.join();
+            mListeners.clear();
+
+            asio::post(mServer->GetIOContext(), [this] {
+                mServer->Shutdown();
+            });
+            mServerThread.join();
+        }
+
+        DISABLE_COPY_MOVE(FEventFixture)
+
+        /// Grow The Listeners Of The Bench Event To The Count
+        void Resize(const size_t count) {
+            while (mListeners.size() < count) {
+                auto agent = std::make_shared<UBenchListener>(mAgentContext);
+                agent->Run();
+                mListeners.emplace_back(std::move(agent));
+            }
+
+            // The Extra Listeners Of The Larger Run Stop Listening
+            for (size_t idx = count; idx < mListeners.size(); ++idx) {
+                mEvent->RemoveServiceListener(static_cast<int64_t>(idx) + 1);
+            }
+            for (size_t idx = 0; idx < count; ++idx) {
+                mEvent->ServiceListenEvent(static_cast<int64_t>(idx) + 1, mListeners[idx], BENCH_EVENT_TYPE);
+            }
+        }
+
+        [[nodiscard]] UEventModule *GetEventModule() const {
+            return mEvent;
+        }
+
+    private:
+        std::unique_ptr<UServer> mServer;
+        UEventModule *mEvent = nullptr;
+
+        asio::io_context mAgentContext;
+        asio::executor_work_guard<asio::io_context::executor_type> mGuard;
+
+        std::vector<std::shared_ptr<UBenchListener>> mListeners;
+
+        std::thread mServerThread;
+        std::thread mAgentThread;
+    };
+
+    FEventFixture &GetEventFixture() {
+        static FEventFixture fixture;
+        return fixture;
+    }
+}
+
+
+static void BM_EventModule_Dispatch(benchmark::State &state) {
+    auto &fixture = GetEventFixture();
+    fixture.Resize(state.range(0));
+
+    const auto event = std::make_shared<FBenchEventParam>();
+
+    for (auto _ : state) {
+        fixture.GetEventModule()->Dispatch(event);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EventModule_Dispatch)->Arg(1)->Arg(16)->Arg(256)->UseRealTime();
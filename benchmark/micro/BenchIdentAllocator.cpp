@@ -0,0 +1,84 @@
+#include "MicroBenchmark.h"
+#include "LegacyIdentAllocator.h"
+
+#include "base/IdentAllocator.h"
+
+#include <vector>
+
+
+/// Allocate And Recycle The Same ID, The Free List Holds One ID At Most
+template<class Allocator>
+static void BM_IdentAllocator_Dense(benchmark::State &state) {
+    Allocator allocator;
+
+    for (auto _ : state) {
+        const auto id = allocator.AllocateTS();
+        allocator.RecycleTS(id);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_IdentAllocator_Dense, TLegacyIdentAllocator<int64_t, true>);
+BENCHMARK_TEMPLATE(BM_IdentAllocator_Dense, TLockFreeIdentAllocator<int64_t>);
+BENCHMARK_TEMPLATE(BM_IdentAllocator_Dense, TBitmapIdentAllocator<int64_t>);
+
+/// Every Other ID Recycled, The Free List Is Large And Scattered
+template<class Allocator>
+static void BM_IdentAllocator_Sparse(benchmark::State &state) {
+    Allocator allocator;
+
+    std::vector<int64_t> ids(state.range(0));
+    for (auto &id : ids) {
+        id = allocator.AllocateTS();
+    }
+    for (size_t idx = 0; idx < ids.size(); idx += 2) {
+        allocator.RecycleTS(ids[idx]);
+    }
+
+    for (auto _ : state) {
+        const auto id = allocator.AllocateTS();
+        allocator.RecycleTS(id);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_IdentAllocator_Sparse, TLegacyIdentAllocator<int64_t, true>)->Arg(1 << 10)->Arg(1 << 17);
+BENCHMARK_TEMPLATE(BM_IdentAllocator_Sparse, TLockFreeIdentAllocator<int64_t>)->Arg(1 << 10)->Arg(1 << 17);
+BENCHMARK_TEMPLATE(BM_IdentAllocator_Sparse, TBitmapIdentAllocator<int64_t>)->Arg(1 << 10)->Arg(1 << 17);
+
+/// The Churn Of The Timer IDs, Hold A Window Of Live IDs And Recycle The Oldest
+template<class Allocator>
+static void BM_IdentAllocator_Churn(benchmark::State &state) {
+    Allocator allocator;
+
+    std::vector<int64_t> window(state.range(0));
+    for (auto &id : window) {
+        id = allocator.AllocateTS();
+    }
+
+    size_t cursor = 0;
+    for (auto _ : state) {
+        allocator.RecycleTS(window[cursor]);
+        window[cursor] = allocator.AllocateTS();
+        cursor = (cursor + 1) % window.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_IdentAllocator_Churn, TLegacyIdentAllocator<int64_t, true>)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_IdentAllocator_Churn, TLockFreeIdentAllocator<int64_t>)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_IdentAllocator_Churn, TBitmapIdentAllocator<int64_t>)->Arg(1 << 12);
+
+template<class Allocator>
+static void BM_IdentAllocator_Concurrent(benchmark::State &state) {
+    static Allocator allocator;
+
+    for (auto _ : state) {
+        const auto id = allocator.AllocateTS();
+        allocator.RecycleTS(id);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_IdentAllocator_Concurrent, TLegacyIdentAllocator<int64_t, true>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_IdentAllocator_Concurrent, TLockFreeIdentAllocator<int64_t>)->ThreadRange(1, 16)->UseRealTime();
@@ -0,0 +1,73 @@
+#include "MicroBenchmark.h"
+
+#include "aoi/InterestGrid.h"
+
+#include <random>
+#include <vector>
+
+
+namespace {
+    constexpr float WORLD_SIZE = 2000.f;
+    constexpr float CELL_SIZE = 50.f;
+    constexpr float VIEW_RADIUS = 50.f;
+
+    struct FWalker {
+        int64_t id;
+        float x;
+        float y;
+    };
+}
+
+
+/// One Server Tick: Move The Given Percent Of The Entities A Step, Then Diff All The Affected Watchers
+static void BM_InterestGrid_Tick(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto percent = static_cast<size_t>(state.range(1));
+
+    UInterestGrid grid(WORLD_SIZE, WORLD_SIZE, CELL_SIZE, VIEW_RADIUS);
+
+    std::mt19937 random(20250101);
+    std::uniform_real_distribution<float> position(0.f, WORLD_SIZE);
+    std::uniform_real_distribution<float> step(-3.f, 3.f);
+
+    std::vector<FWalker> walkers;
+    for (size_t idx = 0; idx < count; ++idx) {
+        auto &walker = walkers.emplace_back(static_cast<int64_t>(idx + 1), position(random), position(random));
+        grid.Add(walker.id, walker.x, walker.y);
+    }
+
+    // Settle The First Sight, Everyone Enters At Once
+    grid.Tick(nullptr);
+
+    const auto moving = count * percent / 100;
+    size_t cursor = 0;
+    int64_t changes = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (size_t idx = 0; idx < moving; ++idx) {
+            auto &walker = walkers[cursor];
+            walker.x = std::clamp(walker.x + step(random), 0.f, WORLD_SIZE);
+            walker.y = std::clamp(walker.y + step(random), 0.f, WORLD_SIZE);
+            cursor = (cursor + 1) % count;
+        }
+        state.ResumeTiming();
+
+        for (size_t idx = 0, from = (cursor + count - moving) % count; idx < moving; ++idx) {
+            const auto &walker = walkers[(from + idx) % count];
+            grid.Move(walker.id, walker.x, walker.y);
+        }
+
+        grid.Tick([&changes](const FInterestDiff &diff) {
+            changes += static_cast<int64_t>(diff.enter.size() + diff.leave.size() + diff.update.size());
+        });
+    }
+
+    state.counters["changes_per_tick"] = benchmark::Counter(static_cast<double>(changes), benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_InterestGrid_Tick)
+    ->Args({ 10000, 1 })
+    ->Args({ 10000, 10 })
+    ->Args({ 10000, 100 })
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,83 @@
+#include "MicroBenchmark.h"
+
+#include "base/ConcurrentDeque.h"
+#include "base/ProtocolRoute.h"
+#include "internal/Packet.h"
+
+#include <functional>
+
+
+static void BM_ConcurrentDeque_PushPop(benchmark::State &state) {
+    static TConcurrentDeque<int64_t> deque;
+
+    // Every Thread Pushes Before It Pops, So The Deque Never Runs Dry
+    int64_t value = 0;
+    for (auto _ : state) {
+        deque.PushBack(++value);
+        benchmark::DoNotOptimize(deque.PopFront());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConcurrentDeque_PushPop)->ThreadRange(1, 16)->UseRealTime();
+
+static void BM_ProtocolRoute_Receive(benchmark::State &state) {
+    using ARouteFunctor = std::function<void(uint32_t, FPacket *)>;
+
+    TProtocolRoute<FPacket, ARouteFunctor> route;
+
+    int64_t handled = 0;
+    for (uint32_t id = 1; id <= static_cast<uint32_t>(state.range(0)); ++id) {
+        route.Register(1000 + id, [&handled](uint32_t, FPacket *) {
+            ++handled;
+        });
+    }
+
+    FPacket pkt;
+    uint32_t next = 0;
+
+    for (auto _ : state) {
+        pkt.SetPackageID(1001 + next);
+        next = (next + 1) % static_cast<uint32_t>(state.range(0));
+
+        route.OnReceivePackage(&pkt);
+    }
+
+    benchmark::DoNotOptimize(handled);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ProtocolRoute_Receive)->Arg(8)->Arg(64)->Arg(512);
+
+namespace {
+    int64_t gTableHandled = 0;
+
+    void BenchTableHandler(uint32_t, FPacket *) {
+        ++gTableHandled;
+    }
+
+    // The Same Shape As The Generated Table, 8 Handlers In A Dense Range
+    using ABenchTable = TProtocolTable<FPacket, 1001, 1009>;
+
+    constexpr ABenchTable BENCH_TABLE = {
+        { 1001, &BenchTableHandler }, { 1002, &BenchTableHandler },
+        { 1003, &BenchTableHandler }, { 1004, &BenchTableHandler },
+        { 1005, &BenchTableHandler }, { 1006, &BenchTableHandler },
+        { 1007, &BenchTableHandler }, { 1008, &BenchTableHandler },
+    };
+}
+
+static void BM_ProtocolTable_Receive(benchmark::State &state) {
+    FPacket pkt;
+    uint32_t next = 0;
+
+    for (auto _ : state) {
+        pkt.SetPackageID(1001 + next);
+        next = (next + 1) % 8;
+
+        BENCH_TABLE.OnReceivePackage(&pkt);
+    }
+
+    benchmark::DoNotOptimize(gTableHandled);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ProtocolTable_Receive);
@@ -0,0 +1,61 @@
+#include "MicroBenchmark.h"
+
+#include "base/Recycler.h"
+#include "internal/Packet.h"
+
+
+namespace {
+    IRecyclerBase &GetSharedRecycler() {
+        static asio::io_context ctx;
+        static const auto recycler = [] {
+            auto res = IRecyclerBase::CreateUnique<FPacket>(ctx);
+            res->Initial(1024);
+            return res;
+        }();
+        return *recycler;
+    }
+}
+
+
+static void BM_Recycler_AcquireRelease(benchmark::State &state) {
+    auto &recycler = GetSharedRecycler();
+
+    for (auto _ : state) {
+        auto handle = recycler.Acquire<FPacket>();
+        benchmark::DoNotOptimize(handle);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Recycler_AcquireRelease)->ThreadRange(1, 16)->UseRealTime();
+
+static void BM_RecycleHandle_Copy(benchmark::State &state) {
+    const auto handle = GetSharedRecycler().Acquire<IPackage_Interface>();
+
+    for (auto _ : state) {
+        FPackageHandle copy(handle);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_RecycleHandle_Copy)->ThreadRange(1, 16)->UseRealTime();
+
+static void BM_RecycleHandle_Move(benchmark::State &state) {
+    auto handle = GetSharedRecycler().Acquire<IPackage_Interface>();
+
+    for (auto _ : state) {
+        FPackageHandle moved(std::move(handle));
+        handle = std::move(moved);
+        benchmark::DoNotOptimize(handle);
+    }
+}
+BENCHMARK(BM_RecycleHandle_Move);
+
+static void BM_RecycleHandle_CastTo(benchmark::State &state) {
+    const auto handle = GetSharedRecycler().Acquire<IPackage_Interface>();
+
+    for (auto _ : state) {
+        auto pkt = handle.CastTo<FPacket>();
+        benchmark::DoNotOptimize(pkt);
+    }
+}
+BENCHMARK(BM_RecycleHandle_CastTo);
@@ -0,0 +1,141 @@
+#include "MicroBenchmark.h"
+
+#include "base/SlotMap.h"
+
+#include <absl/container/flat_hash_map.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <shared_mutex>
+#include <vector>
+
+
+namespace {
+    /** Stand-In Of The Timer And The Agent, Only The Lookup Is Measured **/
+    struct FBenchElement {
+        int64_t value = 0;
+    };
+
+    /// The Lookup Order Is Shuffled Once, The Same For All The Containers
+    std::vector<size_t> BuildOrder(const size_t count) {
+        std::vector<size_t> order(count);
+        for (size_t idx = 0; idx < count; ++idx) {
+            order[idx] = idx;
+        }
+        std::shuffle(order.begin(), order.end(), std::mt19937_64(20250101));
+        return order;
+    }
+}
+
+
+/// The Timer Manager And The Service Module Now: Slot Index Plus Generation Compare, No Reference Counting
+static void BM_Lookup_SlotMap(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+
+    TSlotMap<std::shared_ptr<FBenchElement>> map;
+    std::shared_mutex mutex;
+
+    std::vector<int64_t> ids;
+    for (size_t idx = 0; idx < count; ++idx) {
+        ids.emplace_back(map.Insert(std::make_shared<FBenchElement>()).ToID());
+    }
+
+    const auto order = BuildOrder(count);
+    size_t cursor = 0;
+
+    for (auto _ : state) {
+        std::shared_lock lock(mutex);
+        if (const auto *element = map.Find(FSlotHandle::FromID(ids[order[cursor]]))) {
+            ++(*element)->value;
+        }
+        cursor = (cursor + 1) % count;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Lookup_SlotMap)->Arg(64)->Arg(4096)->Arg(1 << 16);
+
+/// The Service Module Before: Hash The ID And Copy The shared_ptr Out Of The Lock
+static void BM_Lookup_HashMapShared(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+
+    absl::flat_hash_map<int64_t, std::shared_ptr<FBenchElement>> map;
+    std::shared_mutex mutex;
+
+    std::vector<int64_t> ids;
+    for (size_t idx = 0; idx < count; ++idx) {
+        ids.emplace_back(static_cast<int64_t>(idx) + 1);
+        map.emplace(ids.back(), std::make_shared<FBenchElement>());
+    }
+
+    const auto order = BuildOrder(count);
+    size_t cursor = 0;
+
+    for (auto _ : state) {
+        std::shared_ptr<FBenchElement> element;
+        {
+            std::shared_lock lock(mutex);
+            if (const auto iter = map.find(ids[order[cursor]]); iter != map.end()) {
+                element = iter->second;
+            }
+        }
+        if (element != nullptr) {
+            ++element->value;
+        }
+        cursor = (cursor + 1) % count;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Lookup_HashMapShared)->Arg(64)->Arg(4096)->Arg(1 << 16);
+
+/// The Timer Manager Before: Hash The Handle, Then Lock The weak_ptr It Carries
+static void BM_Lookup_HashMapWeak(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+
+    std::vector<std::shared_ptr<FBenchElement>> owners;
+    absl::flat_hash_map<int64_t, std::weak_ptr<FBenchElement>> map;
+    std::shared_mutex mutex;
+
+    std::vector<int64_t> ids;
+    for (size_t idx = 0; idx < count; ++idx) {
+        ids.emplace_back(static_cast<int64_t>(idx) + 1);
+        map.emplace(ids.back(), owners.emplace_back(std::make_shared<FBenchElement>()));
+    }
+
+    const auto order = BuildOrder(count);
+    size_t cursor = 0;
+
+    for (auto _ : state) {
+        std::weak_ptr<FBenchElement> weak;
+        {
+            std::shared_lock lock(mutex);
+            if (const auto iter = map.find(ids[order[cursor]]); iter != map.end()) {
+                weak = iter->second;
+            }
+        }
+        if (const auto element = weak.lock()) {
+            ++element->value;
+        }
+        cursor = (cursor + 1) % count;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Lookup_HashMapWeak)->Arg(64)->Arg(4096)->Arg(1 << 16);
+
+/// The Stale Handle Is Rejected By The Generation After The Slot Is Reused
+static void BM_Lookup_SlotMapStale(benchmark::State &state) {
+    TSlotMap<std::shared_ptr<FBenchElement>> map;
+
+    const auto stale = map.Insert(std::make_shared<FBenchElement>());
+    map.Erase(stale);
+    (void) map.Insert(std::make_shared<FBenchElement>());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.Find(stale));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Lookup_SlotMapStale);
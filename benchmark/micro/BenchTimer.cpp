@@ -0,0 +1,47 @@
+#include "MicroBenchmark.h"
+
+#include "timer/TimerManager.h"
+
+
+static void BM_TimerManager_CreateCancel(benchmark::State &state) {
+    asio::io_context ctx;
+    auto guard = asio::make_work_guard(ctx);
+
+    UTimerManager manager(ctx);
+
+    for (auto _ : state) {
+        const auto handle = manager.CreateTimer([](ASteadyTimePoint, ASteadyDuration) {}, 1000);
+        manager.CancelTimer(handle.id);
+
+        // The Timer Is Removed From The Manager On The Context
+        ctx.poll();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TimerManager_CreateCancel);
+
+/// Keep Many Timers Alive, Then Create And Cancel One More
+static void BM_TimerManager_CreateCancelLoaded(benchmark::State &state) {
+    asio::io_context ctx;
+    auto guard = asio::make_work_guard(ctx);
+
+    UTimerManager manager(ctx);
+
+    for (int64_t idx = 0; idx < state.range(0); ++idx) {
+        (void) manager.CreateTimer([](ASteadyTimePoint, ASteadyDuration) {}, 3600 * 1000);
+    }
+    ctx.poll();
+
+    for (auto _ : state) {
+        const auto handle = manager.CreateTimer([](ASteadyTimePoint, ASteadyDuration) {}, 1000);
+        manager.CancelTimer(handle.id);
+        ctx.poll();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+
+    manager.CancelAll();
+    ctx.poll();
+}
+BENCHMARK(BM_TimerManager_CreateCancelLoaded)->Arg(1 << 10)->Arg(1 << 14);
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "base/Types.h"
+
+#include <asio/append.hpp>
+#include <vector>
+
+
+/**
+ * The Loopback Byte Stream In Memory, The Written Bytes Are Read Back In Order;
+ * Lets The Packet Codec Be Measured Without The Kernel Socket.
+ * Not Thread Safe, Drive It From One Coroutine
+ */
+class FMemoryStream final {
+
+public:
+    using executor_type = ATcpSocket::executor_type;
+
+    explicit FMemoryStream(asio::io_context &ctx)
+        : mSocket(ctx),
+          mReadPos(0) {
+    }
+
+    [[nodiscard]] executor_type get_executor() {
+        return mSocket.get_executor();
+    }
+
+    /// Only For TPacketCodec::GetSocket(), The Socket Is Never Opened
+    ATcpSocket &next_layer() {
+        return mSocket;
+    }
+
+    template<class MutableBufferSequence, class Token = asio::default_completion_token_t<executor_type>>
+    auto async_read_some(const MutableBufferSequence &buffers, Token &&token = Token{}) {
+        return asio::async_initiate<Token, void(std::error_code, size_t)>([this](auto handler, const MutableBufferSequence &target) {
+            std::error_code ec;
+            size_t len = 0;
+
+            if (mReadPos < mBuffer.size()) {
+                len = asio::buffer_copy(target, asio::buffer(mBuffer.data() + mReadPos, mBuffer.size() - mReadPos));
+                mReadPos += len;
+
+                // Reuse The Storage Once Drained
+                if (mReadPos == mBuffer.size()) {
+                    mBuffer.clear();
+                    mReadPos = 0;
+                }
+            } else if (asio::buffer_size(target) > 0) {
+                ec = asio::error::eof;
+            }
+
+            Complete(std::move(handler), ec, len);
+        }, token, buffers);
+    }
+
+    template<class ConstBufferSequence, class Token = asio::default_completion_token_t<executor_type>>
+    auto async_write_some(const ConstBufferSequence &buffers, Token &&token = Token{}) {
+        return asio::async_initiate<Token, void(std::error_code, size_t)>([this](auto handler, const ConstBufferSequence &source) {
+            const auto len = asio::buffer_size(source);
+            const auto offset = mBuffer.size();
+
+            mBuffer.resize(offset + len);
+            asio::buffer_copy(asio::buffer(mBuffer.data() + offset, len), source);
+
+            Complete(std::move(handler), std::error_code{}, len);
+        }, token, buffers);
+    }
+
+private:
+    /// Never Complete Inline, The Same As The Real Socket
+    template<class Handler>
+    void Complete(Handler &&handler, const std::error_code &ec, const size_t len) {
+        const auto executor = asio::get_associated_executor(handler, mSocket.get_executor());
+        asio::post(executor, asio::append(std::forward<Handler>(handler), ec, len));
+    }
+
+private:
+    ATcpSocket mSocket;
+
+    std::vector<uint8_t> mBuffer;
+    size_t mReadPos;
+};
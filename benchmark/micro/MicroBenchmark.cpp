@@ -0,0 +1,51 @@
+/**
+ * The Microbenchmarks Of The Core Primitives;
+ * Write The Result As JSON To Diff Across Commits:
+ *     uranus_microbench --benchmark_out=result.json --benchmark_out_format=json
+ *
+ * The Extra Option --uranus_config=<dir> Points To The Directory Of server.yaml
+ */
+
+#include "MicroBenchmark.h"
+
+#include <spdlog/spdlog.h>
+#include <string_view>
+#include <vector>
+
+
+namespace {
+    std::string gConfigPath = "../../config";
+}
+
+const std::string &micro::GetConfigPath() {
+    return gConfigPath;
+}
+
+int main(int argc, char *argv[]) {
+    constexpr std::string_view CONFIG_OPTION = "--uranus_config=";
+
+    // Take Out The Own Option Before The Benchmark Library Parses The Rest
+    std::vector<char *> args;
+    for (int idx = 0; idx < argc; ++idx) {
+        if (const std::string_view arg = argv[idx]; arg.starts_with(CONFIG_OPTION)) {
+            gConfigPath = arg.substr(CONFIG_OPTION.size());
+            continue;
+        }
+        args.emplace_back(argv[idx]);
+    }
+
+    int count = static_cast<int>(args.size());
+
+    spdlog::set_level(spdlog::level::warn);
+
+    benchmark::Initialize(&count, args.data());
+    if (benchmark::ReportUnrecognizedArguments(count, args.data()))
+        return 1;
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    spdlog::drop_all();
+
+    return 0;
+}
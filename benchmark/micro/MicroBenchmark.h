@@ -0,0 +1,10 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <string>
+
+
+namespace micro {
+    /// The Directory Of server.yaml, For The Benchmarks That Need A Running UServer
+    const std::string &GetConfigPath();
+}
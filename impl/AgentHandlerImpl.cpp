@@ -62,15 +62,16 @@ FPackageHandle UAgentHandlerImpl::OnRepeated(const std::string &addr) {
 FPlatformInfo UAgentHandlerImpl::ParsePlatformInfo(const FPackageHandle &pkg) {
     const auto pkt = pkg.CastTo<FPacket>();
 
-    Login::PlatformInfo request;
-    request.ParseFromString(pkt->ToString());
+    const auto *request = pkt->Decode<Login::PlatformInfo>();
+    if (request == nullptr)
+        return {};
 
     FPlatformInfo info;
 
-    info.playerID = request.player_id();
-    info.operateSystemName = request.os_name();
-    info.operateSystemVersion = request.os_version();
-    info.clientVersion = request.client_version();
+    info.playerID = request->player_id();
+    info.operateSystemName = request->os_name();
+    info.operateSystemVersion = request->os_version();
+    info.clientVersion = request->client_version();
 
     return info;
 }
@@ -78,11 +79,12 @@ FPlatformInfo UAgentHandlerImpl::ParsePlatformInfo(const FPackageHandle &pkg) {
 FLogoutRequest UAgentHandlerImpl::ParseLogoutRequest(const FPackageHandle &pkg) {
     const auto pkt = pkg.CastTo<FPacket>();
 
-    Login::LogoutRequest request;
-    request.ParseFromString(pkt->ToString());
+    const auto *request = pkt->Decode<Login::LogoutRequest>();
+    if (request == nullptr)
+        return {};
 
     FLogoutRequest info;
-    info.player_id = request.player_id();
+    info.player_id = request->player_id();
 
     return info;
 }
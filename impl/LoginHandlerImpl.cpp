@@ -24,12 +24,13 @@ ILoginHandler::FLoginToken ULoginHandlerImpl::ParseLoginRequest(const FPackageHa
     if (pkt->GetPackageID() != LOGIN_REQUEST_PACKAGE_ID)
         return {};
 
-    Login::LoginRequest request;
-    request.ParseFromString(pkt->ToString());
+    const auto *request = pkt->Decode<Login::LoginRequest>();
+    if (request == nullptr)
+        return {};
 
     return {
-        request.token(),
-        request.player_id()
+        request->token(),
+        request->player_id()
     };
 }
 
@@ -41,14 +42,15 @@ FPlatformInfo ULoginHandlerImpl::ParsePlatformInfo(const FPackageHandle &pkg) {
     if (pkt->GetPackageID() != PLATFORM_PACKAGE_ID)
         return {};
 
-    Login::PlatformInfo request;
-    request.ParseFromString(pkt->ToString());
+    const auto *request = pkt->Decode<Login::PlatformInfo>();
+    if (request == nullptr)
+        return {};
 
     FPlatformInfo info;
 
-    info.operateSystemName = request.os_name();
-    info.operateSystemVersion = request.os_version();
-    info.clientVersion = request.client_version();
+    info.operateSystemName = request->os_name();
+    info.operateSystemVersion = request->os_version();
+    info.clientVersion = request->client_version();
 
     return info;
 }
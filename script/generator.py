@@ -2,14 +2,21 @@ import platform
 import os
 import re
 
-VERSION = '0.1'
-TARGET_DIR = 'service'
+VERSION = '0.3'
+TARGET_DIR = 'service/generated'
 PROTOBUF_DIR = 'protobuf/def'
 PROTO_FILE = [
     'appearance',
-    'player'
+    'player',
+    'world'
 ]
 
+# The messages with this suffix are handled by the player,
+# every one must have a handler with the same name in namespace protocol,
+# which receives the message decoded once by the packet
+HANDLER_SUFFIX = 'Request'
+HANDLER_TARGET = 'UPlayer'
+
 def pascal_case_to_camel_case(name):
     """Convert PascalCase to camelCase."""
     if not name:
@@ -32,7 +39,7 @@ name_set = []
 for val in PROTO_FILE:
     path = os.path.join(PROTOBUF_DIR, val + '.proto')
     with open(path, 'r', encoding='utf-8') as file:
-        package = {'list': [], 'src': path}
+        package = {'list': [], 'src': path, 'name': val}
         
         in_message = False
         line = file.readline()
@@ -78,6 +85,7 @@ with open(os.path.join(TARGET_DIR, 'ProtoType.gen.h'), 'w', encoding='utf-8') as
 
     package_index = 11
     proto_index = 1
+    first_id = package_index * 100 + proto_index
 
     for package in proto_list:
         proto_index = 1
@@ -94,7 +102,55 @@ with open(os.path.join(TARGET_DIR, 'ProtoType.gen.h'), 'w', encoding='utf-8') as
         package_index += 1
 
     file.write('\t\tPROTO_TYPE_MAX,\n')
-    file.write('\t}; // EProtoType\n')
+    file.write('\t}; // EProtoType\n\n')
+
+    file.write('\t// The range of the protocol id, for the dense dispatch table\n')
+    file.write(f'\tinline constexpr uint32_t PROTO_ID_BEGIN = {first_id};\n')
+    file.write('\tinline constexpr uint32_t PROTO_ID_END = static_cast<uint32_t>(EProtoType::PROTO_TYPE_MAX);\n')
+    file.write('}\n')
+
+with open(os.path.join(TARGET_DIR, 'ProtoRoute.gen.h'), 'w', encoding='utf-8') as file:
+    file.write(f'''/**
+ * Protocol handler and dispatch table define here
+ * This file is generated by Python script. Do not edit!!!
+ * Python version: v{platform.python_version()}
+ * Script version: v{VERSION}
+ */\n\n''')
+
+    file.write('#pragma once\n\n')
+    file.write('#include "ProtoType.gen.h"\n\n')
+    file.write('#include <base/ProtocolRoute.h>\n')
+    file.write('#include <internal/Packet.h>\n\n')
+
+    for package in proto_list:
+        if any(proto.endswith(HANDLER_SUFFIX) for proto in package['list']):
+            file.write(f'#include <{package['name']}.pb.h>\n')
+    file.write('\n')
+
+    file.write(f'class {HANDLER_TARGET};\n\n')
+
+    file.write('namespace protocol {\n')
+
+    handler_list = []
+
+    for package in proto_list:
+        requests = [proto for proto in package['list'] if proto.endswith(HANDLER_SUFFIX)]
+        if not requests:
+            continue
+
+        file.write(f'\t// {package['package']}\n')
+        for proto in requests:
+            file.write(f'\tvoid {proto}(const {package['package']}::{proto} &, FPacket *, {HANDLER_TARGET} *);\n')
+            handler_list.append((package['package'], proto))
+        file.write('\n')
+
+    file.write(f'\tusing ARouteTable = TProtocolTable<FPacket, PROTO_ID_BEGIN, PROTO_ID_END, {HANDLER_TARGET} *>;\n\n')
+
+    file.write('\t// Shared by all the instances, dispatch is one bounds check plus one indirect call\n')
+    file.write('\tinline constexpr ARouteTable ROUTE_TABLE = {\n')
+    for package_name, proto in handler_list:
+        file.write(f'\t\t{{ static_cast<uint32_t>(EProtoType::{pascal_to_upper_snake(proto)}), &ARouteTable::Typed<{package_name}::{proto}, &{proto}> }},\n')
+    file.write('\t}; // ROUTE_TABLE\n')
     file.write('}\n')
 
 with open(os.path.join(TARGET_DIR, 'proto_type.dart'), 'w', encoding='utf-8') as file:
@@ -1,5 +1,22 @@
 #include "ComponentModule.h"
 #include "Player.h"
+#include "component/stamina/StaminaComponent.h"
+
+#include <spdlog/spdlog.h>
+
+
+namespace {
+    /// Collected First, A Hook May Make Its Player Leave The World While Sweeping
+    std::vector<UPlayer *> CollectLoaded(entt::registry &registry) {
+        std::vector<UPlayer *> result;
+        for (const auto [entity, owner] : registry.view<FWorldPlayer>().each()) {
+            if (owner.player != nullptr && owner.player->IsLoaded()) {
+                result.emplace_back(owner.player);
+            }
+        }
+        return result;
+    }
+}
 
 UComponentModule::UComponentModule()
     : mPlayer(nullptr) {
@@ -31,13 +48,134 @@ UServer *UComponentModule::GetServer() const {
 }
 
 void UComponentModule::OnLogin() {
-    for (const auto &comp : mComponentMap | std::views::values) {
+    mComponents.Foreach([](IPlayerComponent *comp) {
         comp->OnLogin();
-    }
+    });
 }
 
 void UComponentModule::OnLogout() {
-    for (const auto &comp : mComponentMap | std::views::values) {
+    mComponents.Foreach([](IPlayerComponent *comp) {
         comp->OnLogout();
+    });
+}
+
+void UComponentModule::OnTick() {
+    mComponents.Foreach([](IPlayerComponent *comp) {
+        comp->OnTick();
+    });
+}
+
+void UComponentModule::RegisterWorldSystems(UPlayerWorld &world) {
+    UStaminaComponent::RegisterSystems(world);
+
+    // The Components Not Moved Into The Pools Still Run Their Own Hooks, At The Rate Of The World
+    world.AddSystem(EWorldPhase::TICK, [](entt::registry &registry, ASteadyTimePoint) {
+        for (auto *player : CollectLoaded(registry)) {
+            player->GetComponentModule().OnTick();
+        }
+    });
+
+    world.AddSystem(EWorldPhase::DAY_CHANGE, [](entt::registry &registry, ASteadyTimePoint) {
+        for (auto *player : CollectLoaded(registry)) {
+            player->GetComponentModule().OnDayChange();
+        }
+    });
+}
+
+void UComponentModule::OnDayChange() {
+    mComponents.Foreach([](IPlayerComponent *comp) {
+        comp->OnDayChange();
+    });
+}
+
+std::vector<FComponentDocument> UComponentModule::CollectDirty() {
+    std::vector<FComponentDocument> result;
+
+    mComponents.Foreach([&result](IPlayerComponent *comp) {
+        if (!comp->IsDirty())
+            return;
+
+        comp->ClearDirty();
+
+        nlohmann::json doc;
+        doc["version"] = comp->GetComponentVersion();
+        comp->Serialize(doc);
+
+        auto str = doc.dump();
+        const auto hash = std::hash<std::string>()(str);
+
+        if (hash == comp->mSavedHash)
+            return;
+
+        comp->mSavedHash = hash;
+        result.emplace_back(comp->GetComponentName(), std::move(str));
+    });
+
+    return result;
+}
+
+void UComponentModule::OnComponentDirty() const {
+    if (mPlayer) {
+        mPlayer->OnComponentDirty();
     }
 }
+
+std::vector<std::string> UComponentModule::GetComponentNames() const {
+    std::vector<std::string> result;
+
+    mComponents.Foreach([&result](const IPlayerComponent *comp) {
+        result.emplace_back(comp->GetComponentName());
+    });
+
+    return result;
+}
+
+bool UComponentModule::LoadComponent(const std::string &name, const std::string &document) {
+    IPlayerComponent *target = nullptr;
+
+    mComponents.Foreach([&target, &name](IPlayerComponent *comp) {
+        if (name == comp->GetComponentName())
+            target = comp;
+        return target == nullptr;
+    });
+
+    if (target == nullptr)
+        return false;
+
+    const auto doc = nlohmann::json::parse(document, nullptr, false);
+    if (doc.is_discarded() || !doc.is_object())
+        return false;
+
+    if (const auto version = doc.value("version", 0); version != target->GetComponentVersion()) {
+        SPDLOG_WARN("{} - Component[{}] Version {} Loaded, Current {}", __FUNCTION__, name, version, target->GetComponentVersion());
+    }
+
+    target->Deserialize(doc);
+    target->ClearDirty();
+    target->mSavedHash = std::hash<std::string>()(document);
+
+    return true;
+}
+
+void UComponentModule::RestoreDirty(const std::string &name) {
+    mComponents.Foreach([&name](IPlayerComponent *comp) {
+        if (name != comp->GetComponentName())
+            return true;
+
+        // Not Stored, So Not Skipped As The Same Next Time
+        comp->mSavedHash = 0;
+        comp->MarkDirty();
+        return false;
+    });
+}
+
+bool UComponentModule::HasDirty() const {
+    bool bDirty = false;
+
+    mComponents.Foreach([&bDirty](const IPlayerComponent *comp) {
+        bDirty = comp->IsDirty();
+        return !bDirty;
+    });
+
+    return bDirty;
+}
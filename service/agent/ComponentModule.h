@@ -1,17 +1,25 @@
 #pragma once
 
 #include "PlayerComponent.h"
+#include "ComponentSlots.h"
 
-#include <unordered_map>
-#include <typeindex>
-#include <memory>
+#include <vector>
+#include <string>
 
 
 class UPlayer;
 class UServer;
+class UPlayerWorld;
+
+struct FComponentDocument {
+    std::string name;
+    std::string document;
+};
 
 class UComponentModule final {
 
+    using AComponentSlots = TComponentSlots<IPlayerComponent, static_cast<size_t>(EComponentType::COMPONENT_TYPE_MAX)>;
+
 public:
     UComponentModule();
     ~UComponentModule();
@@ -33,10 +41,35 @@ public:
     void OnLogin();
     void OnLogout();
 
+    void OnTick();
+    void OnDayChange();
+
+    /// Register The Pool Systems Of All The Components And The Legacy Hooks, Once When The World Created
+    static void RegisterWorldSystems(UPlayerWorld &world);
+
+    /// Serialize The Dirty Components And Clear The Flags,
+    /// The Component Whose Document Is Same As The Last Saved Will Be Skipped
+    [[nodiscard]] std::vector<FComponentDocument> CollectDirty();
+
+    [[nodiscard]] bool HasDirty() const;
+
+    /// The Collected Document Of The Name Was Not Accepted, Mark It Dirty Again For The Next Save
+    void RestoreDirty(const std::string &name);
+
+    /// The Collection Names Of The Components, Each One Saved And Loaded As One Document
+    [[nodiscard]] std::vector<std::string> GetComponentNames() const;
+
+    /// Deserialize The Saved Document Into The Component Of The Name, The Same Document Is Not Saved Again
+    bool LoadComponent(const std::string &name, const std::string &document);
+
+    /// Called By The Component Marked Dirty
+    void OnComponentDirty() const;
+
 private:
     UPlayer *mPlayer;
 
-    std::unordered_map<std::type_index, std::unique_ptr<IPlayerComponent>> mComponentMap;
+    /** One Slot Per EComponentType, Looked Up By The Protocol Handlers In Every Package **/
+    AComponentSlots mComponents;
 };
 
 template<CComponentType Type>
@@ -44,21 +77,19 @@ inline Type *UComponentModule::CreateComponent() {
     if (mPlayer == nullptr)
         return nullptr;
 
-    if (const auto iter = mComponentMap.find(std::type_index(typeid(Type))); iter != mComponentMap.end()) {
-        return dynamic_cast<Type *>(iter->second.get());
-    }
+    if (auto *comp = mComponents.Get<Type>())
+        return comp;
 
-    auto *comp = new Type();
-    comp->SetUpModule(this);
+    // Null If Another Component Declared The Same Type
+    auto *comp = mComponents.Emplace<Type>();
+    if (comp == nullptr)
+        return nullptr;
 
-    mComponentMap.insert_or_assign(typeid(Type), comp);
+    comp->SetUpModule(this);
     return comp;
 }
 
 template<CComponentType Type>
 inline Type *UComponentModule::GetComponent() const {
-    if (const auto iter = mComponentMap.find(std::type_index(typeid(Type))); iter != mComponentMap.end()) {
-        return dynamic_cast<Type *>(iter->second.get());
-    }
-    return nullptr;
+    return mComponents.Get<Type>();
 }
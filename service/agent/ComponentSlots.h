@@ -0,0 +1,81 @@
+#pragma once
+
+#include <functional>
+#include <concepts>
+#include <typeinfo>
+#include <memory>
+#include <array>
+
+
+template<class Type, class Base, size_t Count>
+concept CSlotType = std::derived_from<Type, Base>
+    && requires { Type::COMPONENT_TYPE; }
+    && (static_cast<size_t>(Type::COMPONENT_TYPE) < Count);
+
+
+/**
+ * The Fixed Slots Of The Components, Indexed By The Compile-Time ID Of The Type;
+ * Lookup Is One Array Index Plus A static_cast, No Hash And No dynamic_cast.
+ * Every Type Must Own A Unique COMPONENT_TYPE, Emplace Refuses The Type Whose Slot Is Taken By Another
+ */
+template<class Base, size_t Count>
+class TComponentSlots final {
+
+public:
+    template<class Type>
+    requires CSlotType<Type, Base, Count>
+    static constexpr size_t IndexOf() {
+        return static_cast<size_t>(Type::COMPONENT_TYPE);
+    }
+
+    template<class Type>
+    requires CSlotType<Type, Base, Count>
+    [[nodiscard]] Type *Get() const {
+        return static_cast<Type *>(mSlots[IndexOf<Type>()].get());
+    }
+
+    /// Return The Existing One If Already Created, Null If The Slot Is Taken By Another Type
+    template<class Type, class... Args>
+    requires CSlotType<Type, Base, Count>
+    Type *Emplace(Args &&... args);
+
+    /// Visit All The Components In ID Order, Stop If The Functor Returns False
+    template<class Functor>
+    void Foreach(Functor &&func) const;
+
+private:
+    std::array<std::unique_ptr<Base>, Count> mSlots;
+};
+
+
+template<class Base, size_t Count>
+template<class Type, class ... Args>
+requires CSlotType<Type, Base, Count>
+Type *TComponentSlots<Base, Count>::Emplace(Args &&...args) {
+    auto &slot = mSlots[IndexOf<Type>()];
+
+    // Only Checked While Creating, Get Trusts The ID
+    if (slot != nullptr)
+        return typeid(*slot) == typeid(Type) ? static_cast<Type *>(slot.get()) : nullptr;
+
+    auto *comp = new Type(std::forward<Args>(args)...);
+    slot.reset(comp);
+
+    return comp;
+}
+
+template<class Base, size_t Count>
+template<class Functor>
+void TComponentSlots<Base, Count>::Foreach(Functor &&func) const {
+    for (const auto &slot : mSlots) {
+        if (slot == nullptr)
+            continue;
+
+        if constexpr (std::is_same_v<std::invoke_result_t<Functor, Base *>, bool>) {
+            if (!std::invoke(func, slot.get()))
+                return;
+        } else {
+            std::invoke(func, slot.get());
+        }
+    }
+}
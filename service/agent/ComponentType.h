@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdint>
+
+
+/**
+ * The Compile-Time ID Of The Player Components, Also The Index Of Its Slot In UComponentModule;
+ * One Value Per Component, Append The New One Before COMPONENT_TYPE_MAX
+ */
+enum class EComponentType : uint32_t {
+    APPEAR,
+    STAMINA,
+
+    COMPONENT_TYPE_MAX,
+};
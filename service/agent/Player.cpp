@@ -1,14 +1,42 @@
 #include "Player.h"
 #include "Server.h"
+#include "AgentBase.h"
+#include "gateway/PlayerAgent.h"
+#include "component/appear/AppearComponent.h"
+#include "component/stamina/StaminaComponent.h"
 
+#include <ProtoRoute.gen.h>
+#include <ProtoType.gen.h>
+#include <internal/Packet.h>
 #include <config/Config.h>
+#include <database/DataAccess.h>
+#include <spdlog/spdlog.h>
+#include <Utils.h>
+#include <algorithm>
 
 
-UPlayer::UPlayer() {
+namespace {
+    /** Must Match UGameWorld::GetServiceName **/
+    constexpr auto GAME_WORLD_SERVICE = "Game World";
+
+    /** Timer Rate In 100 Milliseconds **/
+    constexpr int LOAD_RETRY_DELAY = 10;
+    constexpr int LOAD_RETRY_LIMIT = 3;
+}
+
+UPlayer::UPlayer()
+    : mSaveInterval(-1),
+      mEntity(entt::null),
+      bWorldEnabled(false),
+      mLoadSerial(0),
+      mPendingLoads(0),
+      mLoadAttempts(0),
+      bLoadFailed(false),
+      bLoaded(false) {
 
     mComponentModule.SetUpPlayer(this);
-    mConfig.LoadConfig(GetServer()->GetModule<UConfig>());
-    LoadProtocol();
+    mComponentModule.CreateComponent<UAppearComponent>();
+    mComponentModule.CreateComponent<UStaminaComponent>();
 }
 
 UPlayer::~UPlayer() {
@@ -16,48 +44,300 @@ UPlayer::~UPlayer() {
 }
 
 void UPlayer::Initial() {
+    // The Agent Is Only Set Up Before This, The Server Is Not Reachable In The Constructor
+    if (const auto *config = GetServer()->GetModule<UConfig>()) {
+        mConfig.LoadConfig(config);
+
+        // Config In Second, Timer Rate In 100 Milliseconds
+        mSaveInterval = config->GetServerConfig()["database"]["save_interval"].as<int>() * 10;
 
+        // The World Is Opt-In, It Takes Over The Periodic Save
+        if (const auto &node = config->GetServerConfig()["player"]["world"]; node.IsDefined()) {
+            bWorldEnabled = node["enable"].as<bool>(false);
+            mWorldOptions.tick = node["tick"].as<int>(mWorldOptions.tick);
+            mWorldOptions.save = mSaveInterval > 0 ? mSaveInterval * 100 : -1;
+        }
+    }
 }
 
 void UPlayer::OnLogin() {
-    mComponentModule.OnLogin();
+    if (bWorldEnabled) {
+        mWorld = UPlayerWorld::Acquire(GetIOContext(), mWorldOptions);
+        mEntity = mWorld->CreatePlayer(this, GetPlayerID());
+    }
+
+    mLoadAttempts = 0;
+    LoadComponents();
+
+    if (mWorld == nullptr && mSaveInterval > 0) {
+        mSaveTimer = CreateTimer([this](ASteadyTimePoint, ASteadyDuration) {
+            Save();
+        }, mSaveInterval, mSaveInterval);
+    }
+
+    if (mWorld == nullptr) {
+        // Timer Rate In 100 Milliseconds
+        const auto rate = std::max(mWorldOptions.tick / 100, 1);
+
+        mLastDay = NowTimePoint();
+        mTickTimer = CreateTimer([this](ASteadyTimePoint, ASteadyDuration) {
+            OnTick();
+        }, rate, rate);
+    }
 }
 
 void UPlayer::OnLogout() {
-    mComponentModule.OnLogout();
+    if (mSaveTimer.IsValid()) {
+        CancelTimer(mSaveTimer.id);
+        mSaveTimer = {};
+    }
+
+    if (mTickTimer.IsValid()) {
+        CancelTimer(mTickTimer.id);
+        mTickTimer = {};
+    }
+
+    if (mLoadTimer.IsValid()) {
+        CancelTimer(mLoadTimer.id);
+        mLoadTimer = {};
+    }
+
+    // Drop The Load Still In Flight, The Components Keep The Loaded State For The Save After Logout
+    ++mLoadSerial;
+
+    if (bLoaded) {
+        mComponentModule.OnLogout();
+    }
+
+    LeaveWorld();
+    LeaveInterest();
 }
 
 void UPlayer::Save() {
+    // Never Overwrite The Stored Documents With The Default Before They Are Loaded
+    if (!bLoaded || !mComponentModule.HasDirty())
+        return;
+
+    auto *access = GetServer()->GetModule<UDataAccess>();
+    if (access == nullptr || access->GetState() != EModuleState::RUNNING)
+        return;
 
+    const auto pid = GetPlayerID();
+    const auto key = std::to_string(pid);
+
+    // Every Component Is One Document In Its Own Collection, Keyed By The Player ID
+    for (auto &[name, doc] : mComponentModule.CollectDirty()) {
+        if (!access->SaveDocument(name, key, std::move(doc), pid)) {
+            SPDLOG_WARN("{} - Player[{}] Failed To Save Component[{}]", __FUNCTION__, pid, name);
+            mComponentModule.RestoreDirty(name);
+        }
+    }
 }
 
 void UPlayer::OnReset() {
+    // Taken Over By The Repeated Login Without Logout, The Timers Died With The Old Agent
+    mSaveTimer = {};
+    mTickTimer = {};
+    mLoadTimer = {};
 
+    // Called By The Gateway, Leave In The Thread Of The World
+    if (mWorld != nullptr) {
+        auto &ctx = mWorld->GetIOContext();
+        asio::post(ctx, [world = std::move(mWorld), entity = mEntity] {
+            world->DestroyPlayer(entity);
+            UPlayerWorld::Release(world);
+        });
+
+        mWorld.reset();
+        mEntity = entt::null;
+    }
+
+    ++mLoadSerial;
+    bLoaded = false;
 }
 
-void UPlayer::OnEvent(IEventParam_Interface *event) {
+void UPlayer::OnTick() {
+    if (!bLoaded)
+        return;
 
+    if (const auto today = NowTimePoint(); utils::GetDaysGone(mLastDay, today) > 0) {
+        mLastDay = today;
+        OnDayChange();
+    }
+
+    mComponentModule.OnTick();
+}
+
+void UPlayer::OnDayChange() {
+    mComponentModule.OnDayChange();
 }
 
-void UPlayer::RegisterProtocol(const uint32_t id, const AProtocolFunctor &func) {
-    mRoute.Register(id, func);
+void UPlayer::OnEvent(IEventParam_Interface *event) {
+
 }
 
 void UPlayer::OnPackage(IPackage_Interface *pkg) {
     if (pkg == nullptr)
         return;
 
-    const auto pkt = dynamic_cast<FPacket *>(pkg);
+    if (!bLoaded) {
+        SPDLOG_WARN("{} - Player[{}] Drop Package[{}] Before Loaded", __FUNCTION__, GetPlayerID(), pkg->GetPackageID());
+        return;
+    }
+
+    const auto pkt = TagCast<FPacket>(pkg);
     if (pkt == nullptr)
         return;
 
-    mRoute.OnReceivePackage(pkt, this);
+    // The Generated Table Is Shared By All The Players
+    protocol::ROUTE_TABLE.OnReceivePackage(pkt, this);
 }
 
 UComponentModule &UPlayer::GetComponentModule() {
     return mComponentModule;
 }
 
+UPlayerWorld *UPlayer::GetWorld() const {
+    return mWorld.get();
+}
+
+entt::entity UPlayer::GetEntity() const {
+    return mEntity;
+}
+
+int UPlayer::GetAvatarIndex() const {
+    if (const auto *comp = GetComponent<UAppearComponent>())
+        return comp->GetCurrentIndex();
+
+    return 0;
+}
+
+void UPlayer::OnComponentDirty() const {
+    if (mWorld != nullptr) {
+        mWorld->MarkDirty(mEntity);
+    }
+}
+
+void UPlayer::LeaveWorld() {
+    if (mWorld == nullptr)
+        return;
+
+    mWorld->DestroyPlayer(mEntity);
+    UPlayerWorld::Release(mWorld);
+
+    mWorld.reset();
+    mEntity = entt::null;
+}
+
+void UPlayer::LeaveInterest() const {
+    // Only Online Through The Gateway, Which Stamps The Player ID;
+    // The Client Never Sends WORLD_LEAVE On Disconnect
+    if (TagCast<UPlayerAgent>(GetAgent()) == nullptr)
+        return;
+
+    const auto pkg = BuildPackage();
+    auto *pkt = pkg.GetT<FPacket>();
+    if (pkt == nullptr)
+        return;
+
+    pkt->SetPackageID(static_cast<uint32_t>(protocol::EProtoType::WORLD_LEAVE));
+    PostPackage(GAME_WORLD_SERVICE, pkg);
+}
+
+bool UPlayer::IsLoaded() const {
+    return bLoaded;
+}
+
+void UPlayer::LoadComponents() {
+    bLoaded = false;
+    bLoadFailed = false;
+
+    ++mLoadAttempts;
+
+    const auto serial = ++mLoadSerial;
+    const auto names = mComponentModule.GetComponentNames();
+
+    // Nothing Stored Without The Database, Log In With The Default
+    auto *access = GetServer()->GetModule<UDataAccess>();
+    if (names.empty() || access == nullptr) {
+        mPendingLoads = 1;
+        OnComponentLoaded(serial, {}, EDBLoadStatus::NOT_FOUND, {});
+        return;
+    }
+
+    const auto pid = GetPlayerID();
+    const auto key = std::to_string(pid);
+
+    mPendingLoads = names.size();
+
+    const std::weak_ptr agent = GetAgent()->weak_from_this();
+
+    // Same Collection, Key And Shard Key As Saved, So The Load Runs After The Buffered Writes
+    for (const auto &name : names) {
+        const bool bPushed = access->LoadDocument(name, key, [agent, serial, name](const EDBLoadStatus status, std::string doc) {
+            const auto owner = agent.lock();
+            if (owner == nullptr)
+                return;
+
+            // Back To The Own Agent From The Database Worker, The Components Are Only Touched There
+            owner->PushTask([serial, name, status, doc = std::move(doc)](IActorBase *actor) {
+                if (auto *plr = TagCast<UPlayer>(actor)) {
+                    plr->OnComponentLoaded(serial, name, status, doc);
+                }
+            });
+        }, pid);
+
+        if (!bPushed) {
+            OnComponentLoaded(serial, name, EDBLoadStatus::FAILED, {});
+        }
+    }
+}
+
+void UPlayer::OnComponentLoaded(const int64_t serial, const std::string &name, const EDBLoadStatus status, const std::string &doc) {
+    if (serial != mLoadSerial || bLoaded)
+        return;
+
+    if (status == EDBLoadStatus::FAILED) {
+        SPDLOG_WARN("{} - Player[{}] Failed To Load Component[{}]", __FUNCTION__, GetPlayerID(), name);
+        bLoadFailed = true;
+    } else if (status == EDBLoadStatus::FOUND && !mComponentModule.LoadComponent(name, doc)) {
+        SPDLOG_WARN("{} - Player[{}] Failed To Deserialize Component[{}]", __FUNCTION__, GetPlayerID(), name);
+        bLoadFailed = true;
+    }
+
+    if (--mPendingLoads > 0)
+        return;
+
+    // Never Log In With The Default In Place Of The Stored, The Save Would Overwrite It
+    if (bLoadFailed) {
+        OnLoadFailed();
+        return;
+    }
+
+    mLoadAttempts = 0;
+
+    bLoaded = true;
+    mComponentModule.OnLogin();
+}
+
+void UPlayer::OnLoadFailed() {
+    if (mLoadAttempts < LOAD_RETRY_LIMIT) {
+        mLoadTimer = CreateTimer([this, serial = mLoadSerial](ASteadyTimePoint, ASteadyDuration) {
+            mLoadTimer = {};
+            if (serial == mLoadSerial) {
+                LoadComponents();
+            }
+        }, LOAD_RETRY_DELAY);
+        return;
+    }
+
+    SPDLOG_ERROR("{} - Player[{}] Failed To Load After {} Attempts, Disconnect", __FUNCTION__, GetPlayerID(), mLoadAttempts);
+
+    if (auto *agent = TagCast<UPlayerAgent>(GetAgent())) {
+        agent->Disconnect();
+    }
+}
+
 extern "C" {
     SERVICE_API IPlayerBase *CreatePlayer() {
         return new UPlayer();
@@ -1,19 +1,19 @@
 #pragma once
 
 #include "ComponentModule.h"
+#include "PlayerWorld.h"
 #include "gateway/PlayerBase.h"
 
-#include <base/ProtocolRoute.h>
 #include <config/ConfigManager.h>
-#include <internal/Packet.h>
-
-#include <functional>
+#include <database/DBAdapterBase.h>
+#include <optional>
+#include <string>
 
 class UPlayer final : public IPlayerBase {
 
-    using AProtocolFunctor = std::function<void(uint32_t, FPacket *, UPlayer *)>;
-
 public:
+    DECLARE_TYPE_TAG(UPlayer, type_tag::USER + 2, IPlayerBase)
+
     UPlayer();
     ~UPlayer() override;
 
@@ -26,11 +26,13 @@ public:
 
     void OnReset() override;
 
+    /// Only Without The World, Which Runs The Component Hooks In Its Own Phases
+    void OnTick();
+    void OnDayChange();
+
     void OnPackage(IPackage_Interface *pkg) override;
     void OnEvent(IEventParam_Interface *event) override;
 
-    void RegisterProtocol(uint32_t id, const AProtocolFunctor &func);
-
     UComponentModule &GetComponentModule();
 
     template<CComponentType Type>
@@ -43,13 +45,70 @@ public:
     requires std::derived_from<T, ILogicConfig_Interface>
     T *GetLogicConfig() const;
 
+    /// The ECS World Of The IO Context While Online, Null If Not Enabled In server.yaml
+    [[nodiscard]] UPlayerWorld *GetWorld() const;
+    [[nodiscard]] entt::entity GetEntity() const;
+
+    /// The Avatar In Use, Called By The Other Players To View It
+    [[nodiscard]] int GetAvatarIndex() const;
+
+    /// Store The Hot Data In The Pool Of The World, Null If No World
+    template<class T, class... Args>
+    T *EmplaceWorldComponent(Args &&... args);
+
+    template<class T>
+    T *GetWorldComponent() const;
+
+    /// Called By The Component Module, Tag The Player For The Save Sweep Of The World
+    void OnComponentDirty() const;
+
+    /// All The Components Are Loaded Since The Last Login, Nothing Saved Before It
+    [[nodiscard]] bool IsLoaded() const;
+
 private:
-    void LoadProtocol();
+    void LeaveWorld();
+
+    /// Remove The Player From The Interest Grid Of The Game World
+    void LeaveInterest() const;
+
+    /// Read The Document Of Every Component, The Components Log In After All Returned
+    void LoadComponents();
+
+    /// Run In The Own Agent, The Document Is Only Set With FOUND
+    void OnComponentLoaded(int64_t serial, const std::string &name, EDBLoadStatus status, const std::string &doc);
+
+    /// Load Again Later, Disconnect After The Attempts Used Up; Stay Not Loaded Meanwhile
+    void OnLoadFailed();
 
 private:
     UComponentModule mComponentModule;
-    TProtocolRoute<FPacket, AProtocolFunctor> mRoute;
     UConfigManager mConfig;
+
+    /** Save The Dirty Components Periodically While Online **/
+    FTimerHandle mSaveTimer;
+    int mSaveInterval;
+
+    /** Tick The Components At The Rate Of The World While Not In It, So Both Paths Behave The Same **/
+    FTimerHandle mTickTimer;
+    ASystemTimePoint mLastDay;
+
+    /** Shared By The Players Of The Same IO Context, Saves Instead Of The Timer Above **/
+    std::shared_ptr<UPlayerWorld> mWorld;
+    entt::entity mEntity;
+
+    FWorldOptions mWorldOptions;
+    bool bWorldEnabled;
+
+    /** Counted Up Every Login, The Load Returned After Logout Or Relogin Is Dropped **/
+    int64_t mLoadSerial;
+    size_t mPendingLoads;
+
+    /** Any Component Of The Round Failed To Read Or Deserialize, Retried By The Timer **/
+    FTimerHandle mLoadTimer;
+    int mLoadAttempts;
+    bool bLoadFailed;
+
+    bool bLoaded;
 };
 
 template<CComponentType Type>
@@ -67,6 +126,18 @@ inline T *UPlayer::GetLogicConfig() const {
     return mConfig.GetLogicConfig<T>();
 }
 
+template<class T, class ... Args>
+inline T *UPlayer::EmplaceWorldComponent(Args &&...args) {
+    if (mWorld == nullptr)
+        return nullptr;
+
+    return &mWorld->GetRegistry().emplace_or_replace<T>(mEntity, std::forward<Args>(args)...);
+}
+
+template<class T>
+inline T *UPlayer::GetWorldComponent() const {
+    if (mWorld == nullptr)
+        return nullptr;
 
-#define REGISTER_PROTOCOL(type, func) \
-    RegisterProtocol(static_cast<uint32_t>(protocol::EProtoType::type), &protocol::##func);
+    return mWorld->GetRegistry().try_get<T>(mEntity);
+}
@@ -1,8 +1,13 @@
 #include "PlayerComponent.h"
 #include "ComponentModule.h"
+#include "Player.h"
+
+#include <replication/ReplicaObject.h>
 
 IPlayerComponent::IPlayerComponent()
-    : mModule(nullptr) {
+    : mModule(nullptr),
+      mSavedHash(0),
+      bDirty(false) {
 }
 
 IPlayerComponent::~IPlayerComponent() {
@@ -35,9 +40,46 @@ void IPlayerComponent::OnLogin() {
 void IPlayerComponent::OnLogout() {
 }
 
+void IPlayerComponent::OnTick() {
+}
+
 void IPlayerComponent::OnDayChange() {
 }
 
+void IPlayerComponent::Serialize(nlohmann::json &doc) const {
+}
+
+void IPlayerComponent::Deserialize(const nlohmann::json &doc) {
+}
+
+void IPlayerComponent::MarkDirty() {
+    bDirty = true;
+
+    if (mModule) {
+        mModule->OnComponentDirty();
+    }
+}
+
+void IPlayerComponent::Replicate(const UReplicaObject &object) const {
+    if (auto *plr = GetPlayer()) {
+        plr->Replicate({ &object });
+    }
+}
+
+void IPlayerComponent::ForgetReplica(const UReplicaObject &object) const {
+    if (auto *plr = GetPlayer()) {
+        plr->ForgetReplica(object.GetObjectID());
+    }
+}
+
+bool IPlayerComponent::IsDirty() const {
+    return bDirty;
+}
+
+void IPlayerComponent::ClearDirty() {
+    bDirty = false;
+}
+
 void IPlayerComponent::SetUpModule(UComponentModule *module) {
     mModule = module;
 }
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "Common.h"
+#include "ComponentType.h"
 
+#include <nlohmann/json.hpp>
 #include <cstdint>
 #include <concepts>
 
@@ -9,6 +11,7 @@
 class UComponentModule;
 class UPlayer;
 class UServer;
+class UReplicaObject;
 
 class IPlayerComponent {
 
@@ -31,24 +34,54 @@ public:
     virtual void OnLogin();
     virtual void OnLogout();
 
+    /// Only Without The World, In The World The TICK Systems Sweep The State In The Pools Instead
+    virtual void OnTick();
+
+    /// Only Without The World, In The World The DAY_CHANGE Systems Sweep The State In The Pools Instead
     virtual void OnDayChange();
 
+    /// Write The Persistent Fields To The Document
+    virtual void Serialize(nlohmann::json &doc) const;
+
+    /// Read The Persistent Fields From The Document
+    virtual void Deserialize(const nlohmann::json &doc);
+
+    /// Call After Any Persistent Field Changed, Only The Dirty Component Will Be Serialized While Saving
+    void MarkDirty();
+    [[nodiscard]] bool IsDirty() const;
+
+    /// Send The Changed Fields Of The Replicated Object To The Own Client
+    void Replicate(const UReplicaObject &object) const;
+
+    /// The Replicated Object Is Destroyed Or Out Of The Client
+    void ForgetReplica(const UReplicaObject &object) const;
+
 protected:
     void SetUpModule(UComponentModule *module);
 
+private:
+    void ClearDirty();
+
 private:
     UComponentModule* mModule;
+
+    /** The Hash Of The Last Saved Document, Skip Writing If Not Changed **/
+    size_t mSavedHash;
+    bool bDirty;
 };
 
 template<class T>
-concept CComponentType = std::derived_from<T, IPlayerComponent>;
+concept CComponentType = std::derived_from<T, IPlayerComponent> && requires {
+    { T::COMPONENT_TYPE } -> std::convertible_to<EComponentType>;
+};
 
 
-#define DECLARE_COMPONENT(component) \
+#define DECLARE_COMPONENT(component, type) \
 private: \
     friend class UServer; \
     using Super = IPlayerComponent; \
     using ThisClass = component;\
 public: \
+    static constexpr EComponentType COMPONENT_TYPE = EComponentType::type; \
     DISABLE_COPY_MOVE(component) \
 private:
\ No newline at end of file
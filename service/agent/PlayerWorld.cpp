@@ -0,0 +1,154 @@
+#include "PlayerWorld.h"
+#include "Player.h"
+#include "ComponentModule.h"
+
+#include <Utils.h>
+#include <spdlog/spdlog.h>
+
+#include <unordered_map>
+#include <mutex>
+
+
+namespace {
+    std::mutex gWorldMutex;
+    std::unordered_map<asio::io_context *, std::shared_ptr<UPlayerWorld>> gWorldMap;
+}
+
+UPlayerWorld::UPlayerWorld(asio::io_context &ctx, const FWorldOptions &options)
+    : mContext(ctx),
+      mTimer(ctx),
+      mOptions(options),
+      mLastSave(std::chrono::steady_clock::now()),
+      mLastDay(NowTimePoint()),
+      mPlayerCount(0) {
+}
+
+UPlayerWorld::~UPlayerWorld() {
+    mTimer.cancel();
+}
+
+std::shared_ptr<UPlayerWorld> UPlayerWorld::Acquire(asio::io_context &ctx, const FWorldOptions &options) {
+    std::unique_lock lock(gWorldMutex);
+
+    auto &world = gWorldMap[&ctx];
+    if (world == nullptr) {
+        world = std::make_shared<UPlayerWorld>(ctx, options);
+        UComponentModule::RegisterWorldSystems(*world);
+        world->StartTimer();
+    }
+
+    return world;
+}
+
+void UPlayerWorld::Release(const std::shared_ptr<UPlayerWorld> &world) {
+    if (world == nullptr || world->GetPlayerCount() > 0)
+        return;
+
+    std::unique_lock lock(gWorldMutex);
+
+    if (const auto iter = gWorldMap.find(&world->mContext); iter != gWorldMap.end() && iter->second == world) {
+        world->mTimer.cancel();
+        gWorldMap.erase(iter);
+    }
+}
+
+entt::entity UPlayerWorld::CreatePlayer(UPlayer *player, const int64_t pid) {
+    const auto entity = mRegistry.create();
+    mRegistry.emplace<FWorldPlayer>(entity, player, pid);
+
+    ++mPlayerCount;
+    return entity;
+}
+
+void UPlayerWorld::DestroyPlayer(const entt::entity entity) {
+    if (mRegistry.valid(entity)) {
+        mRegistry.destroy(entity);
+        --mPlayerCount;
+    }
+}
+
+void UPlayerWorld::MarkDirty(const entt::entity entity) {
+    if (mRegistry.valid(entity)) {
+        mRegistry.emplace_or_replace<FWorldSaveDirty>(entity);
+    }
+}
+
+entt::registry &UPlayerWorld::GetRegistry() {
+    return mRegistry;
+}
+
+asio::io_context &UPlayerWorld::GetIOContext() const {
+    return mContext;
+}
+
+size_t UPlayerWorld::GetPlayerCount() const {
+    return mPlayerCount;
+}
+
+void UPlayerWorld::AddSystem(const EWorldPhase phase, const ASystem &system) {
+    if (phase >= EWorldPhase::PHASE_MAX || system == nullptr)
+        return;
+
+    mSystems[static_cast<size_t>(phase)].emplace_back(system);
+}
+
+void UPlayerWorld::RunPhase(const EWorldPhase phase, const ASteadyTimePoint now) {
+    if (phase >= EWorldPhase::PHASE_MAX)
+        return;
+
+    for (const auto &system : mSystems[static_cast<size_t>(phase)]) {
+        try {
+            std::invoke(system, mRegistry, now);
+        } catch (const std::exception &e) {
+            SPDLOG_ERROR("{} - Phase[{}] {}", __FUNCTION__, static_cast<int>(phase), e.what());
+        }
+    }
+
+    if (phase == EWorldPhase::SAVE) {
+        SaveDirty();
+    }
+}
+
+void UPlayerWorld::StartTimer() {
+    mTimer.expires_after(std::chrono::milliseconds(mOptions.tick));
+    mTimer.async_wait([weak = weak_from_this()](const std::error_code &ec) {
+        if (ec)
+            return;
+
+        if (const auto world = weak.lock()) {
+            world->OnTick();
+            world->StartTimer();
+        }
+    });
+}
+
+void UPlayerWorld::OnTick() {
+    const auto now = std::chrono::steady_clock::now();
+
+    RunPhase(EWorldPhase::TICK, now);
+
+    if (const auto today = NowTimePoint(); utils::GetDaysGone(mLastDay, today) > 0) {
+        mLastDay = today;
+        RunPhase(EWorldPhase::DAY_CHANGE, now);
+    }
+
+    if (mOptions.save > 0 && now - mLastSave >= std::chrono::milliseconds(mOptions.save)) {
+        mLastSave = now;
+        RunPhase(EWorldPhase::SAVE, now);
+    }
+}
+
+void UPlayerWorld::SaveDirty() {
+    // Only The Dirty Ones Are Visited, The Others Are Never Touched
+    std::vector<UPlayer *> players;
+    for (const auto [entity, owner] : mRegistry.view<FWorldPlayer, FWorldSaveDirty>().each()) {
+        players.emplace_back(owner.player);
+    }
+
+    // Cleared Before The Save, The Player Failed To Save Marks Itself Again
+    mRegistry.clear<FWorldSaveDirty>();
+
+    for (auto *player : players) {
+        player->Save();
+    }
+}
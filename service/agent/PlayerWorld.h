@@ -0,0 +1,124 @@
+#pragma once
+
+#include "Common.h"
+
+#include <base/Types.h>
+#include <entt/entt.hpp>
+#include <asio/steady_timer.hpp>
+
+#include <functional>
+#include <memory>
+#include <array>
+#include <vector>
+
+
+class UPlayer;
+
+
+/** The Owner Of The Entity, Every Player In The World Has One **/
+struct FWorldPlayer {
+    UPlayer *player;
+    int64_t pid;
+};
+
+/** Tag Of The Player Changed Since The Last Save Sweep **/
+struct FWorldSaveDirty {};
+
+
+/**
+ * The Phase That The Batch Systems Run In
+ */
+enum class EWorldPhase : uint8_t {
+    TICK,
+    DAY_CHANGE,
+    SAVE,
+    PHASE_MAX
+};
+
+
+/**
+ * The Options Of The World, From The player.world Node Of server.yaml
+ */
+struct FWorldOptions {
+    /** The Interval Of The TICK Phase In Milliseconds **/
+    int tick = 1000;
+
+    /** The Interval Of The SAVE Phase In Milliseconds, Not Saved By The World If Not Positive **/
+    int save = -1;
+};
+
+
+/**
+ * The Opt-In ECS Registry Shared By The Players Of One IO Context;
+ * The Hot Player Data Lives In The Contiguous EnTT Pools, And The Batch Systems
+ * Sweep The Pools Instead Of Visiting Every UPlayer.
+ * Only Touched By The Thread Of Its Context, So No Lock Inside
+ */
+class UPlayerWorld final : public std::enable_shared_from_this<UPlayerWorld> {
+
+public:
+    using ASystem = std::function<void(entt::registry &, ASteadyTimePoint)>;
+
+    UPlayerWorld(asio::io_context &ctx, const FWorldOptions &options);
+    ~UPlayerWorld();
+
+    DISABLE_COPY_MOVE(UPlayerWorld)
+
+    /// The World Of The Context, Created With The First Player
+    static std::shared_ptr<UPlayerWorld> Acquire(asio::io_context &ctx, const FWorldOptions &options);
+
+    /// Destroyed With The Last Player, So None Of The Timers Outlives Its Context
+    static void Release(const std::shared_ptr<UPlayerWorld> &world);
+
+    entt::entity CreatePlayer(UPlayer *player, int64_t pid);
+    void DestroyPlayer(entt::entity entity);
+
+    /// Tag The Player For The Next Save Sweep
+    void MarkDirty(entt::entity entity);
+
+    [[nodiscard]] entt::registry &GetRegistry();
+    [[nodiscard]] asio::io_context &GetIOContext() const;
+    [[nodiscard]] size_t GetPlayerCount() const;
+
+    void AddSystem(EWorldPhase phase, const ASystem &system);
+
+    /// Run Over Every Entity Owning The Component In The Given Phase
+    template<class Component, class Functor>
+    void AddSystem(EWorldPhase phase, Functor &&func);
+
+    /// Run The Systems Of The Phase Immediately
+    void RunPhase(EWorldPhase phase, ASteadyTimePoint now);
+
+private:
+    void StartTimer();
+    void OnTick();
+
+    /// The Built-In System Of The SAVE Phase, Save Only The Dirty Players
+    void SaveDirty();
+
+private:
+    asio::io_context &mContext;
+    asio::steady_timer mTimer;
+
+    const FWorldOptions mOptions;
+
+    entt::registry mRegistry;
+    std::array<std::vector<ASystem>, static_cast<size_t>(EWorldPhase::PHASE_MAX)> mSystems;
+
+    ASteadyTimePoint mLastSave;
+    ASystemTimePoint mLastDay;
+
+    size_t mPlayerCount;
+};
+
+
+template<class Component, class Functor>
+inline void UPlayerWorld::AddSystem(const EWorldPhase phase, Functor &&func) {
+    static_assert(!std::is_empty_v<Component>, "The Tag Has No Storage, Use The Registry Overload");
+
+    AddSystem(phase, [func = std::forward<Functor>(func)](entt::registry &registry, ASteadyTimePoint now) {
+        for (const auto [entity, comp] : registry.view<Component>().each()) {
+            std::invoke(func, entity, comp, now);
+        }
+    });
+}
@@ -1,5 +1,9 @@
 #include "AppearComponent.h"
-#include "../../Protocol.h"
+#include "../../Player.h"
+#include "gateway/PlayerAgent.h"
+
+#include <ProtoRoute.gen.h>
+#include <algorithm>
 
 UAppearComponent::UAppearComponent()
     : mCurrentIndex(0) {
@@ -9,22 +13,162 @@ UAppearComponent::UAppearComponent()
 UAppearComponent::~UAppearComponent() {
 }
 
-// DB_SERIALIZE_BEGIN(UAppearComponent)
-//     DB_WRITE_FIELD("current_index", mCurrentIndex);
-//     DB_WRITE_ARRAY("avatar_list", mAvatarList,
-//         DB_WRITE_ARRAY_ELEMENT("index", index),
-//         DB_WRITE_ARRAY_ELEMENT("active", active))
-// DB_SERIALIZE_END
-//
-// DB_DESERIALIZE_BEGIN(UAppearComponent)
-//     DB_READ_FIELD("current_index", int32, mCurrentIndex)
-//     DB_READ_ARRAY("avatar_list", mAvatarList,
-//         DB_READ_ARRAY_ELEMENT("index", int32, index)
-//         DB_READ_ARRAY_ELEMENT("active", int32, active)
-//     )
-// DB_DESERIALIZE_END
+void UAppearComponent::Serialize(nlohmann::json &doc) const {
+    doc["current_index"] = mCurrentIndex;
+
+    auto &list = doc["avatar_list"];
+    list = nlohmann::json::array();
+
+    for (const auto &[index, active] : mAvatarList) {
+        list.push_back({ { "index", index }, { "active", active } });
+    }
+}
+
+void UAppearComponent::Deserialize(const nlohmann::json &doc) {
+    mCurrentIndex = doc.value("current_index", 0);
+
+    mAvatarList.clear();
+    if (const auto iter = doc.find("avatar_list"); iter != doc.end() && iter->is_array()) {
+        for (const auto &elem : *iter) {
+            mAvatarList.emplace_back(elem.value("index", 0), elem.value("active", false));
+        }
+    }
+}
+
+bool UAppearComponent::ActiveAvatar(const int index) {
+    if (index <= 0)
+        return false;
+
+    const auto iter = std::ranges::find(mAvatarList, index, &FAvatarInfo::index);
+    if (iter != mAvatarList.end()) {
+        if (iter->active)
+            return false;
+        iter->active = true;
+    } else {
+        mAvatarList.emplace_back(index, true);
+    }
+
+    MarkDirty();
+    return true;
+}
+
+bool UAppearComponent::UseAvatar(const int index) {
+    if (index == mCurrentIndex || !IsAvatarActive(index))
+        return false;
+
+    mCurrentIndex = index;
+
+    MarkDirty();
+    return true;
+}
+
+int UAppearComponent::GetCurrentIndex() const {
+    return mCurrentIndex;
+}
+
+bool UAppearComponent::IsAvatarActive(const int index) const {
+    const auto iter = std::ranges::find(mAvatarList, index, &FAvatarInfo::index);
+    return iter != mAvatarList.end() && iter->active;
+}
+
+void UAppearComponent::SendInfo() const {
+    const auto *plr = GetPlayer();
+    if (plr == nullptr)
+        return;
+
+    Appearance::AppearanceResponse response;
+    response.set_avatar(mCurrentIndex);
+
+    for (const auto &[index, active] : mAvatarList) {
+        auto *info = response.add_list();
+        info->set_index(index);
+        info->set_active(active);
+        info->set_in_used(index == mCurrentIndex);
+    }
+
+    const auto pkg = plr->BuildPackage();
+    auto *pkt = pkg.GetT<FPacket>();
+    if (pkt == nullptr)
+        return;
+
+    pkt->SetPackageID(static_cast<uint32_t>(protocol::EProtoType::APPEARANCE_RESPONSE));
+    pkt->SetData(response.SerializeAsString());
+
+    plr->SendPackage(pkg);
+}
+
+void UAppearComponent::ViewAvatar(const int64_t target) const {
+    auto *plr = GetPlayer();
+    if (plr == nullptr || target <= 0 || target == plr->GetPlayerID())
+        return;
+
+    auto *agent = TagCast<UPlayerAgent>(plr->GetAgent());
+    if (agent == nullptr)
+        return;
+
+    // The Player Is Released Or Recycled On Logout, Only Trusted While Its Agent Still Holds It
+    const auto resolve = [weak = agent->weak_from_this(), plr, pid = plr->GetPlayerID()]() -> UPlayer * {
+        const auto owner = weak.lock();
+        if (owner == nullptr)
+            return nullptr;
+
+        const auto *current = TagCast<UPlayerAgent>(owner.get());
+        return current != nullptr && current->GetPlayerID() == pid ? plr : nullptr;
+    };
+
+    // The Other Player Runs In Its Own Agent, The Coroutine Resumes In This One
+    co_spawn(plr->GetIOContext(), [resolve, target]() -> awaitable<void> {
+        const auto *caller = resolve();
+        if (caller == nullptr)
+            co_return;
+
+        const auto index = co_await caller->Call<&UPlayer::GetAvatarIndex>(target);
+
+        // Offline Or Not Replied In Time
+        if (!index.has_value())
+            co_return;
+
+        // Logged Out While Waiting
+        auto *self = resolve();
+        if (self == nullptr)
+            co_return;
+
+        Appearance::AppearanceResponse response;
+        response.set_avatar(*index);
+        response.set_target(target);
+
+        const auto pkg = self->BuildPackage();
+        auto *pkt = pkg.GetT<FPacket>();
+        if (pkt == nullptr)
+            co_return;
+
+        pkt->SetPackageID(static_cast<uint32_t>(protocol::EProtoType::APPEARANCE_RESPONSE));
+        pkt->SetData(response.SerializeAsString());
+
+        self->SendPackage(pkg);
+    }, detached);
+}
+
 
+void protocol::AppearanceRequest(const Appearance::AppearanceRequest &request, FPacket *pkg, UPlayer *plr) {
+    auto *comp = plr->GetComponent<UAppearComponent>();
+    if (comp == nullptr)
+        return;
 
-void protocol::AppearanceRequest(uint32_t pid, FPacket *pkg, UPlayer *plr) {
+    switch (request.operate()) {
+        case Appearance::AppearanceRequest::ACTIVE_AVATAR: {
+            comp->ActiveAvatar(request.param_1());
+        } break;
+        case Appearance::AppearanceRequest::USE_AVATAR: {
+            comp->UseAvatar(request.param_1());
+        } break;
+        case Appearance::AppearanceRequest::VIEW_AVATAR: {
+            // Replied Alone When The Other Player Answers
+            comp->ViewAvatar(request.target());
+        } return;
+        default: break;
+    }
 
+    // Reply The Whole List Whether Changed Or Not
+    comp->SendInfo();
 }
@@ -11,7 +11,7 @@ struct FAvatarInfo {
 
 class UAppearComponent final : public IPlayerComponent {
 
-    DECLARE_COMPONENT(UAppearComponent)
+    DECLARE_COMPONENT(UAppearComponent, APPEAR)
 
 public:
     UAppearComponent();
@@ -25,6 +25,24 @@ public:
         return 1;
     }
 
+    void Serialize(nlohmann::json &doc) const override;
+    void Deserialize(const nlohmann::json &doc) override;
+
+    /// Unlock The Avatar, False If Already Active
+    bool ActiveAvatar(int index);
+
+    /// Put On The Active Avatar, False If Not Active Or Already In Use
+    bool UseAvatar(int index);
+
+    [[nodiscard]] int GetCurrentIndex() const;
+    [[nodiscard]] bool IsAvatarActive(int index) const;
+
+    /// Send The Avatar List To The Own Client
+    void SendInfo() const;
+
+    /// Ask The Other Player For Its Avatar In Use, Sent To The Own Client When It Replies
+    void ViewAvatar(int64_t target) const;
+
 private:
     int mCurrentIndex;
     std::vector<FAvatarInfo> mAvatarList;
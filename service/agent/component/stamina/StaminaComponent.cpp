@@ -0,0 +1,163 @@
+#include "StaminaComponent.h"
+#include "../../Player.h"
+
+#include <Utils.h>
+#include <algorithm>
+
+
+void stamina::Regen(FStaminaState &state, const int64_t now) {
+    if (state.value >= MAX_VALUE) {
+        state.regenTime = now;
+        return;
+    }
+
+    const auto steps = (now - state.regenTime) / REGEN_INTERVAL;
+    if (steps <= 0)
+        return;
+
+    state.value = static_cast<int>(std::min<int64_t>(MAX_VALUE, state.value + steps));
+    state.regenTime = state.value >= MAX_VALUE ? now : state.regenTime + steps * REGEN_INTERVAL;
+}
+
+void stamina::ResetDaily(FStaminaState &state, const int64_t day) {
+    if (state.refillDay == day)
+        return;
+
+    state.refillCount = 0;
+    state.refillDay = day;
+}
+
+int64_t stamina::GetDay(const ASystemTimePoint point) {
+    return utils::ToUnixTime(utils::GetDayZeroTime(point));
+}
+
+
+UStaminaComponent::UStaminaComponent() {
+    mState.value = stamina::MAX_VALUE;
+}
+
+UStaminaComponent::~UStaminaComponent() {
+}
+
+void UStaminaComponent::OnLogin() {
+    // Catch Up The Time Offline, Only Derived From The Saved State So Not Dirty
+    const auto now = NowTimePoint();
+    stamina::Regen(mState, utils::ToUnixTime(now));
+    stamina::ResetDaily(mState, stamina::GetDay(now));
+
+    if (auto *plr = GetPlayer(); plr != nullptr && plr->GetWorld() != nullptr) {
+        plr->EmplaceWorldComponent<FStaminaState>(mState);
+    }
+}
+
+void UStaminaComponent::OnLogout() {
+    if (const auto *plr = GetPlayer(); plr != nullptr) {
+        if (const auto *state = plr->GetWorldComponent<FStaminaState>()) {
+            mState = *state;
+        }
+    }
+}
+
+void UStaminaComponent::OnTick() {
+    // The Pool Is Swept By The System Of The World Instead
+    if (IsInWorld())
+        return;
+
+    stamina::Regen(mState, utils::UnixTime());
+}
+
+void UStaminaComponent::OnDayChange() {
+    if (IsInWorld())
+        return;
+
+    stamina::ResetDaily(mState, stamina::GetDay(NowTimePoint()));
+}
+
+bool UStaminaComponent::IsInWorld() const {
+    const auto *plr = GetPlayer();
+    return plr != nullptr && plr->GetWorldComponent<FStaminaState>() != nullptr;
+}
+
+void UStaminaComponent::Serialize(nlohmann::json &doc) const {
+    const auto &state = GetState();
+
+    doc["value"] = state.value;
+    doc["regen_time"] = state.regenTime;
+    doc["refill_count"] = state.refillCount;
+    doc["refill_day"] = state.refillDay;
+}
+
+void UStaminaComponent::Deserialize(const nlohmann::json &doc) {
+    mState.value = doc.value("value", stamina::MAX_VALUE);
+    mState.regenTime = doc.value("regen_time", static_cast<int64_t>(0));
+    mState.refillCount = doc.value("refill_count", 0);
+    mState.refillDay = doc.value("refill_day", static_cast<int64_t>(0));
+}
+
+int UStaminaComponent::GetStamina() const {
+    return GetState().value;
+}
+
+int UStaminaComponent::GetRefillCount() const {
+    return GetState().refillCount;
+}
+
+bool UStaminaComponent::Consume(const int cost) {
+    if (cost <= 0)
+        return false;
+
+    // Regen Counts From Now If It Was Full
+    auto &state = GetState();
+    stamina::Regen(state, utils::UnixTime());
+
+    if (state.value < cost)
+        return false;
+
+    state.value -= cost;
+
+    MarkDirty();
+    return true;
+}
+
+bool UStaminaComponent::Refill() {
+    auto &state = GetState();
+
+    stamina::ResetDaily(state, stamina::GetDay(NowTimePoint()));
+    if (state.refillCount >= stamina::DAILY_REFILL || state.value >= stamina::MAX_VALUE)
+        return false;
+
+    state.value = stamina::MAX_VALUE;
+    state.regenTime = utils::UnixTime();
+    ++state.refillCount;
+
+    MarkDirty();
+    return true;
+}
+
+void UStaminaComponent::RegisterSystems(UPlayerWorld &world) {
+    world.AddSystem(EWorldPhase::TICK, [](entt::registry &registry, ASteadyTimePoint) {
+        const auto now = utils::UnixTime();
+        for (const auto [entity, state] : registry.view<FStaminaState>().each()) {
+            stamina::Regen(state, now);
+        }
+    });
+
+    world.AddSystem(EWorldPhase::DAY_CHANGE, [](entt::registry &registry, ASteadyTimePoint) {
+        const auto day = stamina::GetDay(NowTimePoint());
+        for (const auto [entity, state] : registry.view<FStaminaState>().each()) {
+            stamina::ResetDaily(state, day);
+        }
+    });
+}
+
+FStaminaState &UStaminaComponent::GetState() {
+    if (const auto *plr = GetPlayer(); plr != nullptr) {
+        if (auto *state = plr->GetWorldComponent<FStaminaState>())
+            return *state;
+    }
+    return mState;
+}
+
+const FStaminaState &UStaminaComponent::GetState() const {
+    return const_cast<UStaminaComponent *>(this)->GetState();
+}
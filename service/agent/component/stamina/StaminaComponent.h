@@ -0,0 +1,91 @@
+#pragma once
+
+#include "../../PlayerComponent.h"
+
+#include <base/Types.h>
+
+
+class UPlayerWorld;
+
+/**
+ * The Hot State Of The Stamina, Swept Every Tick;
+ * In The Pool Of The World While Online, Otherwise Kept In The Component
+ */
+struct FStaminaState {
+    int value = 0;
+
+    /** The Unix Time Of The Last Regen Step, Counted From Here While Not Full **/
+    int64_t regenTime = 0;
+
+    /** The Refill Count Of The Day, Reset When The Day Changes **/
+    int refillCount = 0;
+    int64_t refillDay = 0;
+};
+
+namespace stamina {
+    inline constexpr int MAX_VALUE          = 100;
+    inline constexpr int REGEN_INTERVAL     = 60;
+    inline constexpr int DAILY_REFILL       = 3;
+
+    /// Regen By The Time Gone Since The Last Step, The Same Result However Often It Runs
+    void Regen(FStaminaState &state, int64_t now);
+
+    /// Reset The Daily Count If The Day Of It Is Not The Given One
+    void ResetDaily(FStaminaState &state, int64_t day);
+
+    /// The Unix Time Of The Zero Hour Of The Day
+    [[nodiscard]] int64_t GetDay(ASystemTimePoint point);
+}
+
+
+class UStaminaComponent final : public IPlayerComponent {
+
+    DECLARE_COMPONENT(UStaminaComponent, STAMINA)
+
+public:
+    UStaminaComponent();
+    ~UStaminaComponent() override;
+
+    [[nodiscard]] constexpr const char *GetComponentName() const override {
+        return "Stamina";
+    }
+
+    [[nodiscard]] constexpr int GetComponentVersion() const override {
+        return 1;
+    }
+
+    /// Move The State Into The Pool If In The World
+    void OnLogin() override;
+
+    /// Take The State Back Before The Entity Is Destroyed, For The Save After Logout
+    void OnLogout() override;
+
+    void OnTick() override;
+    void OnDayChange() override;
+
+    void Serialize(nlohmann::json &doc) const override;
+    void Deserialize(const nlohmann::json &doc) override;
+
+    [[nodiscard]] int GetStamina() const;
+    [[nodiscard]] int GetRefillCount() const;
+
+    /// False If Not Enough
+    bool Consume(int cost);
+
+    /// Fill Up, False If Refilled Too Many Times Today
+    bool Refill();
+
+    /// The TICK And DAY_CHANGE Systems Over The Pool, Registered Once Per World
+    static void RegisterSystems(UPlayerWorld &world);
+
+private:
+    [[nodiscard]] FStaminaState &GetState();
+    [[nodiscard]] const FStaminaState &GetState() const;
+
+    /// The State Lives In The Pool, Ticked By The Systems And Not The Hooks
+    [[nodiscard]] bool IsInWorld() const;
+
+private:
+    /** Used Only While Not In The World **/
+    FStaminaState mState;
+};
@@ -1,8 +1,23 @@
 #include "GameWorld.h"
 #include <config/Config.h>
+#include <internal/Packet.h>
+#include <logger/BinaryLogger.h>
 
+#include <ProtoType.gen.h>
+#include <cmath>
+#include <spdlog/spdlog.h>
 
-UGameWorld::UGameWorld() {
+
+namespace {
+    constexpr float AOI_WORLD_SIZE = 4096.f;
+    constexpr float AOI_CELL_SIZE = 64.f;
+    constexpr float AOI_VIEW_RADIUS = 64.f;
+
+    constexpr auto GAME_WORLD_LOGGER = "game_world";
+}
+
+UGameWorld::UGameWorld()
+    : mInterest(AOI_WORLD_SIZE, AOI_WORLD_SIZE, AOI_CELL_SIZE, AOI_VIEW_RADIUS) {
     bUpdatePerTick = true;
 
 }
@@ -24,19 +39,94 @@ void UGameWorld::OnEvent(IEventParam_Interface *event) {
 
 void UGameWorld::OnUpdate(ASteadyTimePoint now, ASteadyDuration delta) {
     IServiceBase::OnUpdate(now, delta);
+
+    SyncInterest();
+}
+
+UInterestGrid &UGameWorld::GetInterestGrid() {
+    return mInterest;
+}
+
+void UGameWorld::SyncInterest() {
+    mInterest.Tick([this](const FInterestDiff &diff) {
+        mSync.Clear();
+
+        for (const auto &[id, x, y] : diff.enter) {
+            auto *entity = mSync.add_enter();
+            entity->set_id(id);
+            entity->set_x(x);
+            entity->set_y(y);
+        }
+
+        for (const auto id : diff.leave) {
+            mSync.add_leave(id);
+        }
+
+        for (const auto &[id, x, y] : diff.update) {
+            auto *entity = mSync.add_update();
+            entity->set_id(id);
+            entity->set_x(x);
+            entity->set_y(y);
+        }
+
+        const auto pkg = BuildPackage();
+        auto pkt = pkg.CastTo<FPacket>();
+        if (pkt == nullptr)
+            return;
+
+        pkt->SetPackageID(static_cast<uint32_t>(protocol::EProtoType::WORLD_SYNC));
+        pkt->SetData(mSync.SerializeAsString());
+
+        SendToClient(diff.watcher, pkt);
+    });
 }
 
 bool UGameWorld::Start() {
     IServiceBase::Start();
+
+    TryCreateLogger(GAME_WORLD_LOGGER);
+    mMoveLogger = GetBinaryLogger(GAME_WORLD_LOGGER);
+
     return true;
 }
 
 void UGameWorld::Stop() {
+    mMoveLogger.reset();
     IServiceBase::Stop();
 }
 
 void UGameWorld::OnPackage(IPackage_Interface *pkg) {
-
+    const auto pkt = TagCast<FPacket>(pkg);
+    if (pkt == nullptr)
+        return;
+
+    // Only The Player Stamped By The Gateway, The Client Can Not Move Others
+    const auto pid = pkt->GetSenderPlayer();
+    if (pid <= 0)
+        return;
+
+    // Only Moved Here, The Sight Is Diffed And Sent In The Next Tick
+    switch (static_cast<protocol::EProtoType>(pkt->GetPackageID())) {
+        case protocol::EProtoType::WORLD_MOVE: {
+            if (const auto *request = pkt->Decode<World::WorldMove>(); request != nullptr) {
+                // Never Trust The Client, NaN Or Infinity Can Not Be Placed In The Grid
+                if (!std::isfinite(request->x()) || !std::isfinite(request->y())) {
+                    SPDLOG_WARN("{:<20} - Player[{}] Moved To Non-Finite Position", __FUNCTION__, pid);
+                    break;
+                }
+
+                BINARY_LOG_TRACE(mMoveLogger, "Player[{}] Move To ({}, {})", pid, request->x(), request->y());
+
+                if (!mInterest.Move(pid, request->x(), request->y())) {
+                    mInterest.Add(pid, request->x(), request->y());
+                }
+            }
+        } break;
+        case protocol::EProtoType::WORLD_LEAVE: {
+            mInterest.Remove(pid);
+        } break;
+        default: break;
+    }
 }
 
 extern "C" {
@@ -2,14 +2,19 @@
 
 #include <../../src/service/ServiceBase.h>
 
+#include <aoi/InterestGrid.h>
+
 #include <entt/entt.hpp>
 #include <absl/container/flat_hash_map.h>
+#include <world.pb.h>
 
 
 class UGameWorld final : public IServiceBase {
 
 
 public:
+    DECLARE_TYPE_TAG(UGameWorld, type_tag::USER + 1, IServiceBase)
+
     UGameWorld();
     ~UGameWorld() override;
 
@@ -25,7 +30,22 @@ public:
     void OnEvent(IEventParam_Interface *event) override;
     void OnUpdate(ASteadyTimePoint now, ASteadyDuration delta) override;
 
+    /// The Other Logic Of The World Can Query The Sight Or Place The Non-Player Entities
+    [[nodiscard]] UInterestGrid &GetInterestGrid();
+
+private:
+    /// Send The Changes In Sight Of The Tick, One Package Per Client
+    void SyncInterest();
+
 private:
     entt::registry mRegistry;
+
+    UInterestGrid mInterest;
+
+    /** Reused For Every Client, Keeps The Capacity Of The Repeated Fields **/
+    World::WorldSync mSync;
+
+    /** Every Move Is Traced Without Formatting, Null Unless The Binary Log Enabled **/
+    shared_ptr<UBinaryLogger> mMoveLogger;
 };
 
@@ -0,0 +1,29 @@
+/**
+ * Protocol handler and dispatch table define here
+ * This file is generated by Python script. Do not edit!!!
+ * Python version: v3.12.10
+ * Script version: v0.3
+ */
+
+#pragma once
+
+#include "ProtoType.gen.h"
+
+#include <base/ProtocolRoute.h>
+#include <internal/Packet.h>
+
+#include <appearance.pb.h>
+
+class UPlayer;
+
+namespace protocol {
+	// Appearance
+	void AppearanceRequest(const Appearance::AppearanceRequest &, FPacket *, UPlayer *);
+
+	using ARouteTable = TProtocolTable<FPacket, PROTO_ID_BEGIN, PROTO_ID_END, UPlayer *>;
+
+	// Shared by all the instances, dispatch is one bounds check plus one indirect call
+	inline constexpr ARouteTable ROUTE_TABLE = {
+		{ static_cast<uint32_t>(EProtoType::APPEARANCE_REQUEST), &ARouteTable::Typed<Appearance::AppearanceRequest, &AppearanceRequest> },
+	}; // ROUTE_TABLE
+}
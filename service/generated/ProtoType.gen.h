@@ -2,7 +2,7 @@
  * Protocol ID define here by enum class
  * This file is generated by Python script. Do not edit!!!
  * Python version: v3.12.10
- * Script version: v0.1
+ * Script version: v0.3
  */
 
 #pragma once
@@ -20,6 +20,16 @@ namespace protocol {
 		// Source File: protobuf/def\player.proto
 		SYNC_PLAYER_INFO = 1201,
 
+		// World
+		// Source File: protobuf/def\world.proto
+		WORLD_MOVE = 1301,
+		WORLD_LEAVE = 1302,
+		WORLD_SYNC = 1303,
+
 		PROTO_TYPE_MAX,
 	}; // EProtoType
+
+	// The range of the protocol id, for the dense dispatch table
+	inline constexpr uint32_t PROTO_ID_BEGIN = 1101;
+	inline constexpr uint32_t PROTO_ID_END = static_cast<uint32_t>(EProtoType::PROTO_TYPE_MAX);
 }
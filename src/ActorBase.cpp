@@ -1,5 +1,7 @@
 #include "ActorBase.h"
 #include "AgentBase.h"
+#include "Server.h"
+#include "route/RouteModule.h"
 
 #include <spdlog/fmt/fmt.h>
 
@@ -36,6 +38,36 @@ UServer *IActorBase::GetServer() const {
     return mAgent->GetServer();
 }
 
+AActorCallDelivery IActorBase::BindCallDelivery() const {
+    if (mAgent == nullptr)
+        return {};
+
+    // Not Run If The Agent Is Gone Or Its Channel Closed, The Resumption Destroyed Then Closes The Call
+    return [weak = mAgent->weak_from_this()](std::function<void()> &&resume) {
+        if (const auto agent = weak.lock()) {
+            agent->PushTask([resume = std::move(resume)](IActorBase *) {
+                std::invoke(resume);
+            });
+        }
+    };
+}
+
+bool IActorBase::DispatchCall(const bool bToService, const int64_t target, const AActorTask &task) const {
+    const auto *router = GetServer()->GetModule<URouteModule>();
+    if (!router)
+        return false;
+
+    return router->CallTask(bToService, target, task);
+}
+
+bool IActorBase::DispatchCall(const std::string &name, const AActorTask &task) const {
+    const auto *router = GetServer()->GetModule<URouteModule>();
+    if (!router)
+        return false;
+
+    return router->CallTask(name, task);
+}
+
 void IActorBase::OnPackage(IPackage_Interface *pkg) {
     // Implement In SubClass
 }
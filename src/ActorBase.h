@@ -2,15 +2,22 @@
 
 #include "base/Recycler.h"
 #include "base/Types.h"
+#include "base/ActorCall.h"
 
+#include <functional>
+#include <string>
 
+
+class IActorBase;
 class IAgentBase;
+class IServiceBase;
 class IPackage_Interface;
 class IEventParam_Interface;
 class UServer;
 
 using FPackageHandle = FRecycleHandle<IPackage_Interface>;
 using ATimerTask = std::function<void(ASteadyTimePoint, ASteadyDuration)>;
+using AActorTask = std::function<void(IActorBase *)>;
 
 /**
  * The Basic Class Of Player And Service
@@ -18,9 +25,14 @@ using ATimerTask = std::function<void(ASteadyTimePoint, ASteadyDuration)>;
 class BASE_API IActorBase {
 
 public:
+    static constexpr ATypeTag TYPE_TAG = type_tag::ACTOR;
+
     IActorBase();
     virtual ~IActorBase();
 
+    /// The Service And The Player Override By DECLARE_TYPE_TAG, The Tasks Posted To The Actor Cast By It
+    [[nodiscard]] virtual bool HasTypeTag(const ATypeTag tag) const noexcept { return tag == TYPE_TAG; }
+
     void SetUpAgent(IAgentBase *agent);
     [[nodiscard]] IAgentBase *GetAgent() const;
 
@@ -33,10 +45,29 @@ public:
     [[nodiscard]] asio::io_context &GetIOContext() const;
     [[nodiscard]] UServer *GetServer() const;
 
+    /**
+     * Call The Member Function Of Another Actor And Resume With Its Return Value Inside This Actor;
+     * Await It In The Coroutine Spawned On GetIOContext() While The Actor Is Executing,
+     * The Reply Comes Back As A Task Of The Own Agent And Resumes The Coroutine In That Task.
+     * The Class Of The Function Tells Service Or Player, The Target Is The Service ID Or The Player ID.
+     * Run Inline If The Callee Is Idle In The Same Thread, Otherwise Posted To Its Channel.
+     * Null If The Target Is Not Found, Not Of The Class, Throws Or Not Replied In Time
+     */
+    template<auto Method, class... Args>
+    awaitable<TActorCallResult<Method>> Call(int64_t target, Args... args) const;
+
+    /// Call The Service By Its Name
+    template<auto Method, class... Args>
+    awaitable<TActorCallResult<Method>> Call(std::string name, Args... args) const;
+
+    /// Call With The Specific Timeout
+    template<auto Method, class... Args>
+    awaitable<TActorCallResult<Method>> CallFor(ASteadyDuration timeout, int64_t target, Args... args) const;
+
 protected:
     template<class T>
     T *GetAgentT() const {
-        auto *pResult = dynamic_cast<T *>(GetAgent());
+        auto *pResult = TagCast<T>(GetAgent());
 
         if (pResult == nullptr)
             throw std::bad_cast();
@@ -44,7 +75,84 @@ protected:
         return pResult;
     }
 
+    /// Hand The Task To The Callee's Agent Through The Router, False If The Target Not Found
+    virtual bool DispatchCall(bool bToService, int64_t target, const AActorTask &task) const;
+    virtual bool DispatchCall(const std::string &name, const AActorTask &task) const;
+
+private:
+    /// Push The Resumption Of The Call To The Own Agent, Empty If The Agent Is Not Set Up
+    [[nodiscard]] AActorCallDelivery BindCallDelivery() const;
+
+    template<auto Method, class Target, class... Args>
+    awaitable<TActorCallResult<Method>> CallImpl(ASteadyDuration timeout, const Target &target, Args &&... args) const;
+
 protected:
     /** The Pointer To The Agent **/
     IAgentBase *mAgent;
 };
+
+// The Arguments Are Taken By Value, They Live In The Coroutine Frame Until Passed To The Callee
+
+template<auto Method, class... Args>
+inline awaitable<TActorCallResult<Method>> IActorBase::Call(const int64_t target, Args... args) const {
+    co_return co_await CallImpl<Method>(ACTOR_CALL_TIMEOUT, target, std::move(args)...);
+}
+
+template<auto Method, class... Args>
+inline awaitable<TActorCallResult<Method>> IActorBase::Call(std::string name, Args... args) const {
+    co_return co_await CallImpl<Method>(ACTOR_CALL_TIMEOUT, name, std::move(args)...);
+}
+
+template<auto Method, class... Args>
+inline awaitable<TActorCallResult<Method>> IActorBase::CallFor(const ASteadyDuration timeout, const int64_t target, Args... args) const {
+    co_return co_await CallImpl<Method>(timeout, target, std::move(args)...);
+}
+
+template<auto Method, class Target, class... Args>
+inline awaitable<TActorCallResult<Method>> IActorBase::CallImpl(const ASteadyDuration timeout, const Target &target, Args &&... args) const {
+    using AMethod = TActorMethod<decltype(Method)>;
+    using AClass = typename AMethod::AClass;
+    using AValue = typename AMethod::AValue;
+
+    static_assert(std::derived_from<AClass, IActorBase>, "The Called Method Must Belong To An Actor");
+
+    auto delivery = BindCallDelivery();
+    if (delivery == nullptr)
+        co_return std::nullopt;
+
+    const auto state = std::make_shared<TActorCallState<AValue>>(co_await asio::this_coro::executor, std::move(delivery));
+
+    const AActorTask task = [state, ...args = std::forward<Args>(args)](IActorBase *pActor) mutable {
+        auto *pCallee = TagCast<AClass>(pActor);
+        if (pCallee == nullptr) {
+            state->Reply(std::nullopt);
+            return;
+        }
+
+        // Or The Caller Waits Until The Timeout
+        try {
+            if constexpr (std::is_void_v<typename AMethod::AReturn>) {
+                std::invoke(Method, pCallee, std::move(args)...);
+                state->Reply(std::monostate{});
+            } else {
+                state->Reply(std::invoke(Method, pCallee, std::move(args)...));
+            }
+        } catch (...) {
+            state->Reply(std::nullopt);
+            throw;
+        }
+    };
+
+    bool bDispatched;
+    if constexpr (std::is_convertible_v<Target, std::string>) {
+        static_assert(std::derived_from<AClass, IServiceBase>, "Only The Service Can Be Called By Name");
+        bDispatched = DispatchCall(target, task);
+    } else {
+        bDispatched = DispatchCall(std::derived_from<AClass, IServiceBase>, target, task);
+    }
+
+    if (!bDispatched)
+        co_return std::nullopt;
+
+    co_return co_await state->Wait(timeout);
+}
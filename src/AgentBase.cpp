@@ -1,21 +1,106 @@
 #include "AgentBase.h"
 #include "Server.h"
 #include "base/Package.h"
+#include "monitor/Metrics.h"
+#include "monitor/PackageTracer.h"
+#include "base/ContextWatchdog.h"
+#include "monitor/AgentProfiler.h"
 
 #include <spdlog/spdlog.h>
 #include <spdlog/fmt/fmt.h>
 
 
+namespace {
+    UMetricGauge *LiveAgentGauge() {
+        static auto *gauge = UMetricsRegistry::Instance().GetGauge("uranus_live_agents", "The Alive Player And Service Agents");
+        return gauge;
+    }
+
+    UMetricGauge *ChannelDepthGauge() {
+        static auto *gauge = UMetricsRegistry::Instance().GetGauge("uranus_channel_depth", "The Nodes Waiting In All The Agent Channels");
+        return gauge;
+    }
+
+    UMetricHistogram *ChannelDepthHistogram() {
+        static auto *histogram = UMetricsRegistry::Instance().GetHistogram("uranus_channel_depth_observed", "The Agent Channel Depth Observed When Receiving");
+        return histogram;
+    }
+
+    UMetricCounter *InlineExecutionCounter() {
+        static auto *counter = UMetricsRegistry::Instance().GetCounter("uranus_inline_executions", "The Nodes Executed Inline Without The Agent Channel");
+        return counter;
+    }
+
+    /** Bound The Stack Of The Inline Tasks Calling Into Each Other **/
+    constexpr int MAX_INLINE_DEPTH = 4;
+
+    thread_local int tInlineDepth = 0;
+
+    /**
+     * The Agent Whose Actor Is Executing In This Thread;
+     * Only The Push From An Actor Runs Inline, The Module Pushing Under Its Own Lock Never Re-Enters
+     */
+    thread_local const IAgentBase *tExecutingAgent = nullptr;
+
+    class FExecutingAgentScope final {
+
+        const IAgentBase *mOuter;
+
+    public:
+        explicit FExecutingAgentScope(const IAgentBase *agent)
+            : mOuter(tExecutingAgent) {
+            tExecutingAgent = agent;
+        }
+
+        ~FExecutingAgentScope() {
+            tExecutingAgent = mOuter;
+        }
+
+        DISABLE_COPY_MOVE(FExecutingAgentScope)
+    };
+
+    /// Take The Executing Flag Of The Agent Without Waiting, False If Held By Another Execution
+    bool TryAcquireExecuting(std::atomic_bool &flag) {
+        return !flag.exchange(true, std::memory_order_acquire);
+    }
+
+    /// Release The Executing Flag Taken By The Caller
+    class FExecuteGuard final {
+
+        std::atomic_bool &mFlag;
+
+    public:
+        explicit FExecuteGuard(std::atomic_bool &flag)
+            : mFlag(flag) {
+        }
+
+        ~FExecuteGuard() {
+            mFlag.store(false, std::memory_order_release);
+        }
+
+        DISABLE_COPY_MOVE(FExecuteGuard)
+    };
+}
+
 void UChannelPackageNode::SetPackage(const FPackageHandle &pkg) {
     mPackage = pkg;
 }
 
 void UChannelPackageNode::Execute(IActorBase *pActor) const {
     if (pActor != nullptr && mPackage != nullptr) {
+        UPackageTracer::FHandleScope scope(mPackage.Get());
         pActor->OnPackage(mPackage.Get());
     }
 }
 
+EChannelNodeType UChannelPackageNode::GetNodeType() const {
+    return EChannelNodeType::PACKAGE;
+}
+
+uint32_t UChannelPackageNode::GetPackageID() const {
+    return mPackage != nullptr ? mPackage->GetPackageID() : 0;
+}
+
 void UChannelEventNode::SetEventParam(const shared_ptr<IEventParam_Interface> &event) {
     mEvent = event;
 }
@@ -30,20 +115,38 @@ void UChannelTaskNode::Execute(IActorBase *pActor) const {
     }
 }
 
+EChannelNodeType UChannelTaskNode::GetNodeType() const {
+    return EChannelNodeType::TASK;
+}
+
 void UChannelEventNode::Execute(IActorBase *pActor) const {
     if (pActor != nullptr && mEvent != nullptr) {
         pActor->OnEvent(mEvent.get());
     }
 }
 
+EChannelNodeType UChannelEventNode::GetNodeType() const {
+    return EChannelNodeType::EVENT;
+}
+
 IAgentBase::IAgentBase(asio::io_context &context, const size_t channelSize)
     : mContext(context),
       mModule(nullptr),
       mChannel(mContext, channelSize),
-      mTimerManager(mContext) {
+      mTimerManager(mContext),
+      mChannelDepth(0),
+      bExecuting(false),
+      bProcessing(false) {
+    LiveAgentGauge()->Add(1);
 }
 
 IAgentBase::~IAgentBase() {
+    LiveAgentGauge()->Sub(1);
+
+    // The Nodes Left In The Channel Will Never Be Received
+    if (const auto depth = mChannelDepth.exchange(0); depth != 0) {
+        ChannelDepthGauge()->Sub(depth);
+    }
 }
 
 asio::io_context &IAgentBase::GetIOContext() const {
@@ -56,6 +159,18 @@ UServer *IAgentBase::GetServer() const {
     return mModule->GetServer();
 }
 
+std::string IAgentBase::GetAgentName() const {
+    return fmt::format("agent:{:p}", static_cast<const void *>(this));
+}
+
+const char *IAgentBase::GetAgentKind() const {
+    return "agent";
+}
+
+int64_t IAgentBase::GetActorID() const {
+    return -1;
+}
+
 bool IAgentBase::Initial(IModuleBase *pModule, IDataAsset_Interface *pData) {
     mModule = pModule;
 
@@ -77,19 +192,25 @@ void IAgentBase::PushPackage(const FPackageHandle &pkg) {
     if (pkg == nullptr)
         return;
 
+    UPackageTracer::Stamp(pkg.Get(), ETraceHop::ENQUEUE);
+
     // Wrap The Package In Node
     auto node = make_unique<UChannelPackageNode>();
     node->SetPackage(pkg);
 
     SPDLOG_TRACE("{} - Agent[{:p}]", __FUNCTION__, static_cast<void *>(this));
 
+    IncreaseChannelDepth();
+
     // Push To The Channel
-    if (const auto ret = mChannel.try_send_via_dispatch(std::error_code{}, std::move(node)); !ret) {
+    if (const auto ret = TrySendNode(std::move(node)); !ret) {
         auto temp = make_unique<UChannelPackageNode>();
         temp->SetPackage(pkg);
 
         co_spawn(mContext, [self = shared_from_this(), node = std::move(temp)]() mutable -> awaitable<void> {
-            co_await self->mChannel.async_send(std::error_code{}, std::move(node));
+            if (const auto [ec] = co_await self->mChannel.async_send(std::error_code{}, std::move(node)); ec) {
+                self->DecreaseChannelDepth();
+            }
         }, detached);
     }
 }
@@ -107,13 +228,17 @@ void IAgentBase::PushEvent(const shared_ptr<IEventParam_Interface> &event) {
 
     SPDLOG_TRACE("{} - Agent[{:p}]", __FUNCTION__, static_cast<void *>(this));
 
+    IncreaseChannelDepth();
+
     // Push To The Channel
-    if (const auto ret = mChannel.try_send_via_dispatch(std::error_code{}, std::move(node)); !ret) {
+    if (const auto ret = TrySendNode(std::move(node)); !ret) {
         auto temp = make_unique<UChannelEventNode>();
         temp->SetEventParam(event);
 
         co_spawn(mContext, [self = shared_from_this(), node = std::move(temp)]() mutable -> awaitable<void> {
-            co_await self->mChannel.async_send(std::error_code{}, std::move(node));
+            if (const auto [ec] = co_await self->mChannel.async_send(std::error_code{}, std::move(node)); ec) {
+                self->DecreaseChannelDepth();
+            }
         }, detached);
     }
 }
@@ -131,24 +256,126 @@ void IAgentBase::PushTask(const AActorTask &task) {
 
     SPDLOG_TRACE("{} - Agent[{:p}]", __FUNCTION__, static_cast<void *>(this));
 
+    IncreaseChannelDepth();
+
     // Push To The Channel
-    if (const auto ret = mChannel.try_send_via_dispatch(std::error_code{}, std::move(node)); !ret) {
+    if (const auto ret = TrySendNode(std::move(node)); !ret) {
         auto temp = make_unique<UChannelTaskNode>();
         temp->SetTask(task);
 
         co_spawn(mContext, [self = shared_from_this(), node = std::move(temp)]() mutable -> awaitable<void> {
-            co_await self->mChannel.async_send(std::error_code{}, std::move(node));
+            if (const auto [ec] = co_await self->mChannel.async_send(std::error_code{}, std::move(node)); ec) {
+                self->DecreaseChannelDepth();
+            }
         }, detached);
     }
 }
 
+void IAgentBase::PushTaskInline(const AActorTask &task) {
+    if (task == nullptr)
+        return;
+
+    if (TryExecuteInline(EChannelNodeType::TASK, 0, task))
+        return;
+
+    PushTask(task);
+}
+
+bool IAgentBase::TryExecuteInline(const EChannelNodeType type, const uint32_t packageID, const AActorTask &task) {
+    // Only Pushed By Another Actor Executing In This Thread, And Not Too Deep In The Inline Chain
+    if (tExecutingAgent == nullptr || tExecutingAgent == this || tInlineDepth >= MAX_INLINE_DEPTH)
+        return false;
+
+    if (!bProcessing.load(std::memory_order_acquire) || !mChannel.is_open())
+        return false;
+
+    if (!mContext.get_executor().running_in_this_thread())
+        return false;
+
+    if (mChannelDepth.load(std::memory_order_acquire) != 0)
+        return false;
+
+    bool bExecuted = false;
+    ++tInlineDepth;
+
+    try {
+        bExecuted = ExecuteExclusive(type, packageID, task);
+    } catch (const std::exception &e) {
+        bExecuted = true;
+        SPDLOG_ERROR("{} - {}", __FUNCTION__, e.what());
+    }
+
+    --tInlineDepth;
+
+    if (bExecuted) {
+        InlineExecutionCounter()->Increment();
+    }
+
+    return bExecuted;
+}
+
+bool IAgentBase::ExecuteExclusive(const EChannelNodeType type, const uint32_t packageID, const AActorTask &task) {
+    if (!TryAcquireExecuting(bExecuting))
+        return false;
+
+    FExecuteGuard guard(bExecuting);
+
+    // Check Under The Flag, The Node Received But Not Executed Yet Is Still Counted
+    auto *pActor = GetActor();
+    if (pActor == nullptr || mChannelDepth.load(std::memory_order_acquire) != 0)
+        return false;
+
+    FExecutingAgentScope agentScope(this);
+    UContextWatchdog::FExecuteScope scope(this, GetAgentKind(), GetActorID(), packageID);
+    UAgentProfiler::FScope profileScope(mProfile.get(), type, packageID);
+    std::invoke(task, pActor);
+
+    return true;
+}
+
+bool IAgentBase::TrySendNode(unique_ptr<IChannelNode_Interface> &&node) {
+    // Never Resume A Looping In Place Inside An Executing Actor, It Would Run Nested In The Stack Of The Pusher,
+    // Or Wait For The Flag Held Below In This Stack
+    if (tExecutingAgent != nullptr)
+        return mChannel.try_send(std::error_code{}, std::move(node));
+
+    return mChannel.try_send_via_dispatch(std::error_code{}, std::move(node));
+}
+
+int64_t IAgentBase::GetChannelDepth() const {
+    return mChannelDepth.load(std::memory_order_relaxed);
+}
+
 FPackageHandle IAgentBase::BuildPackage() const {
     // If Something Is Not Assigned, Throw The Exception
     if (mModule == nullptr || mPackagePool == nullptr)
         throw std::runtime_error(fmt::format("{} - AgentBase[{:p}] Not Initialized",
             __FUNCTION__, static_cast<const void *>(this)));
 
-    return mPackagePool->Acquire<IPackage_Interface>();
+    auto pkg = mPackagePool->Acquire<IPackage_Interface>();
+
+    // The Package Built While Handling A Sampled Request Carries On Its Trace
+    UPackageTracer::Inherit(pkg.Get());
+
+    return pkg;
+}
+
+FPackageHandle IAgentBase::ForkPackage(const FPackageHandle &pkg) const {
+    if (pkg == nullptr)
+        return {};
+
+    auto fork = BuildPackage();
+    if (!fork->ShareFrom(pkg.Get()))
+        return {};
+
+    return fork;
+}
+
+FPackageHandle IAgentBase::PrepareDelivery(const FPackageHandle &pkg) const {
+    if (pkg == nullptr || !pkg->IsFrozen())
+        return pkg;
+
+    return ForkPackage(pkg);
 }
 
 FTimerHandle IAgentBase::CreateTimer(const ATimerTask &task, const int delay, const int rate) {
@@ -166,10 +393,26 @@ void IAgentBase::CancelAllTimers() {
     mTimerManager.CancelAll();
 }
 
+void IAgentBase::IncreaseChannelDepth() {
+    mChannelDepth.fetch_add(1, std::memory_order_relaxed);
+    ChannelDepthGauge()->Add(1);
+}
+
+void IAgentBase::DecreaseChannelDepth() {
+    mChannelDepth.fetch_sub(1, std::memory_order_relaxed);
+    ChannelDepthGauge()->Sub(1);
+}
 
 awaitable<void> IAgentBase::ProcessChannel() {
     SPDLOG_TRACE("{} - Agent[{:p}] Begin Process Channel", __FUNCTION__, static_cast<const void *>(this));
 
+    // Create Here, The Name Is Ready When The Looping Begins
+    if (mProfile == nullptr) {
+        mProfile = UAgentProfiler::Instance().CreateProfile(GetAgentName());
+    }
+
+    bProcessing.store(true, std::memory_order_release);
+
     try {
         // Looping Condition
         while (mChannel.is_open()) {
@@ -177,15 +420,31 @@ awaitable<void> IAgentBase::ProcessChannel() {
             if (ec || !mChannel.is_open())
                 break;
 
+            ChannelDepthHistogram()->Record(std::max<int64_t>(mChannelDepth.load(std::memory_order_relaxed), 0));
+
+            // Take The Flag Before Uncounting The Node, So No Inline Task Overtakes It;
+            // Held By An Execution In Another Thread Of The Context, Give The Thread Back Instead Of Spinning
+            while (!TryAcquireExecuting(bExecuting)) {
+                co_await asio::post(mContext, asio::use_awaitable);
+            }
+
+            FExecuteGuard guard(bExecuting);
+            DecreaseChannelDepth();
+
             if (node == nullptr)
                 continue;
 
             // Execute The Task
             if (auto *pActor = GetActor()) {
+                FExecutingAgentScope agentScope(this);
+                UContextWatchdog::FExecuteScope scope(this, GetAgentKind(), GetActorID(), node->GetPackageID());
+                UAgentProfiler::FScope profileScope(mProfile.get(), node->GetNodeType(), node->GetPackageID());
                 node->Execute(pActor);
             }
         }
 
+        bProcessing.store(false, std::memory_order_release);
+
         SPDLOG_TRACE("{} - Agent[{:p}] Complete Process Channel, Begin Clean Up",
             __FUNCTION__, static_cast<const void *>(this));
 
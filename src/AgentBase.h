@@ -12,6 +12,7 @@ class IActorBase;
 class IPackage_Interface;
 class IEventParam_Interface;
 class IDataAsset_Interface;
+class UAgentProfile;
 
 using std::unique_ptr;
 using std::shared_ptr;
@@ -21,6 +22,17 @@ using std::make_unique;
 using FPackageHandle = FRecycleHandle<IPackage_Interface>;
 using AActorTask = std::function<void(IActorBase *)>;
 
+/**
+ * The Type Of The Node In Agent Inner Channel
+ */
+enum class EChannelNodeType : uint8_t {
+    PACKAGE,
+    EVENT,
+    TASK,
+    TICKER,
+    UNKNOWN
+};
+
 /**
  * The Interface That Stored In Agent Inner Channel
  */
@@ -34,6 +46,11 @@ public:
 
     /// Implement This Method To Execute The Specific Task
     virtual void Execute(IActorBase *pActor) const = 0;
+
+    [[nodiscard]] virtual EChannelNodeType GetNodeType() const = 0;
+
+    /// The Package ID If The Node Wraps A Package, Otherwise Zero
+    [[nodiscard]] virtual uint32_t GetPackageID() const { return 0; }
 };
 
 /**
@@ -46,6 +63,9 @@ class BASE_API UChannelPackageNode final : public IChannelNode_Interface {
 public:
     void SetPackage(const FPackageHandle &pkg);
     void Execute(IActorBase *pActor) const override;
+
+    [[nodiscard]] EChannelNodeType GetNodeType() const override;
+    [[nodiscard]] uint32_t GetPackageID() const override;
 };
 
 /**
@@ -58,6 +78,8 @@ class BASE_API UChannelEventNode final : public IChannelNode_Interface {
 public:
     void SetEventParam(const shared_ptr<IEventParam_Interface> &event);
     void Execute(IActorBase *pActor) const override;
+
+    [[nodiscard]] EChannelNodeType GetNodeType() const override;
 };
 
 /**
@@ -70,6 +92,8 @@ class BASE_API UChannelTaskNode final : public IChannelNode_Interface {
 public:
     void SetTask(const AActorTask &task);
     void Execute(IActorBase *pActor) const override;
+
+    [[nodiscard]] EChannelNodeType GetNodeType() const override;
 };
 
 /**
@@ -96,7 +120,21 @@ protected:
     /** The Inner Timer Manager **/
     UTimerManager mTimerManager;
 
+    /** The Count Of The Nodes Pushed But Not Executed Yet **/
+    std::atomic_int64_t mChannelDepth;
+
+    /** Held While A Node Or An Inline Task Is Executing, Keeps The Actor Single Threaded **/
+    std::atomic_bool bExecuting;
+
+    /** Set While The Looping Runs, No Inline Task Before The Actor Is Ready Or After It Stops **/
+    std::atomic_bool bProcessing;
+
+    /** The CPU Accounting, Only Created When The Profiler Enabled **/
+    shared_ptr<UAgentProfile> mProfile;
+
 public:
+    static constexpr ATypeTag TYPE_TAG = type_tag::AGENT;
+
     IAgentBase() = delete;
 
     explicit IAgentBase(asio::io_context &context, size_t channelSize = SERVICE_CHANNEL_SIZE);
@@ -104,12 +142,24 @@ public:
 
     DISABLE_COPY_MOVE(IAgentBase)
 
+    /// The Player Agent And The Service Agent Override By DECLARE_TYPE_TAG, The Actors Cast Their Agent By It
+    [[nodiscard]] virtual bool HasTypeTag(const ATypeTag tag) const noexcept { return tag == TYPE_TAG; }
+
     /// Return The IO Thread's Context(PlayerAgent) Or The Worker Thread's Context(ServiceAgent)
     [[nodiscard]] asio::io_context &GetIOContext() const;
 
     /// Return The Pointer Of UServer
     [[nodiscard]] UServer *GetServer() const;
 
+    /// The Readable Name For The Report
+    [[nodiscard]] virtual std::string GetAgentName() const;
+
+    /// The Kind In The Name, In Static Storage So Another Thread Can Hold It
+    [[nodiscard]] virtual const char *GetAgentKind() const;
+
+    /// The Player ID Or The Service ID Of The Actor, -1 If None
+    [[nodiscard]] virtual int64_t GetActorID() const;
+
     /**
      * Override This Method In Derived Class.
      * Create The Channel And Package Pool Instance And Other Resource,
@@ -126,9 +176,26 @@ public:
     /// Push The Function To The Inner Channel
     void PushTask(const AActorTask &task);
 
+    /**
+     * Run The Task Inline When Another Actor Pushes It From A Thread Running The Context Of This Agent,
+     * And No Node Of This Agent Is Waiting Or Executing, So The Order Is Kept; Otherwise Same As PushTask.
+     * Opt-In For The Caller Not Depending On When The Task Runs, Such As The Actor Call Awaiting Its Reply
+     */
+    void PushTaskInline(const AActorTask &task);
+
+    /// Return The Count Of The Nodes Waiting In The Inner Channel
+    [[nodiscard]] int64_t GetChannelDepth() const;
+
     /// Return A Package Handle From The Inner Package Pool
     FPackageHandle BuildPackage() const;
 
+    /// Return A Package From The Inner Package Pool With Its Own Header And The Payload Shared With The Source;
+    /// The Source Is Frozen, Null If The Package Do Not Support Sharing
+    FPackageHandle ForkPackage(const FPackageHandle &pkg) const;
+
+    /// The Package Itself If Not Frozen, Otherwise A Fork Whose Header Is Free To Write For This Delivery
+    FPackageHandle PrepareDelivery(const FPackageHandle &pkg) const;
+
     /**
      * Create A Timer Use Inner TimerManager
      * @param task      The Task Will Be Executed
@@ -151,6 +218,23 @@ protected:
     /// Will Be Called At The End Of The ::ProcessChannel(), You Can Release The Specific Resource Here
     virtual void CleanUp();
 
+    /// Call After The Node Is Sent Or Is Waiting For Sending To The Inner Channel
+    void IncreaseChannelDepth();
+
+    /// Call After The Node Is Received Or Failed To Send
+    void DecreaseChannelDepth();
+
     /// Process The Node In Channel In A Looping Of The Coroutine
     awaitable<void> ProcessChannel();
+
+    /// Execute The Task In The Calling Thread Under The Executing Flag, As The Looping Executes A Node;
+    /// False Without Running It If The Flag Is Held Or Any Node Is Waiting, Then Push It Instead To Keep The Order
+    bool ExecuteExclusive(EChannelNodeType type, uint32_t packageID, const AActorTask &task);
+
+    /// Send The Node Without Waiting, Resume The Looping In Place Unless Called Inside An Executing Actor
+    bool TrySendNode(unique_ptr<IChannelNode_Interface> &&node);
+
+private:
+    /// Execute The Task Pushed By Another Actor In The Calling Thread, False If Not Allowed Now
+    bool TryExecuteInline(EChannelNodeType type, uint32_t packageID, const AActorTask &task);
 };
@@ -95,4 +95,5 @@ inline constexpr int LOGIN_RESPONSE_PACKAGE_ID  = 1003;
 inline constexpr int LOGIN_FAILED_PACKAGE_ID    = 1004;
 inline constexpr int LOGIN_REPEATED_PACKAGE_ID  = 1005;
 inline constexpr int PLATFORM_PACKAGE_ID        = 1006;
-inline constexpr int LOGOUT_REQUEST_PACKAGE_ID  = 1007;
\ No newline at end of file
+inline constexpr int LOGOUT_REQUEST_PACKAGE_ID  = 1007;
+inline constexpr int REPLICATION_PACKAGE_ID     = 1008;
\ No newline at end of file
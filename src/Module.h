@@ -11,6 +11,7 @@ enum class EModuleState {
     CREATED,
     INITIALIZED,
     RUNNING,
+    STOPPING,
     STOPPED,
 };
 
@@ -73,7 +73,8 @@ public:
     requires std::derived_from<T, IModuleBase>
     T *GetModule() const {
         const auto it = mModuleMap.find(typeid(T));
-        return it == mModuleMap.end() ? nullptr : dynamic_cast<T *>(it->second.get());
+        // Keyed By The Type Created In CreateModule
+        return it == mModuleMap.end() ? nullptr : static_cast<T *>(it->second.get());
     }
 
     template<class T, class... Args>
@@ -0,0 +1,285 @@
+#include "InterestGrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+UInterestGrid::UInterestGrid(const float width, const float height, const float cellSize, const float radius)
+    : mWidth(std::max(width, 1.f)),
+      mHeight(std::max(height, 1.f)),
+      mCellSize(std::max(cellSize, 1.f)),
+      mRadius(std::max(radius, 0.f)),
+      mColumns(static_cast<int>(std::ceil(mWidth / mCellSize))),
+      mRows(static_cast<int>(std::ceil(mHeight / mCellSize))),
+      mReach(static_cast<int>(std::ceil(mRadius / mCellSize))) {
+
+    mCells.resize(static_cast<size_t>(mColumns) * mRows);
+    mDirtyFlags.resize(mCells.size(), 0);
+}
+
+UInterestGrid::~UInterestGrid() = default;
+
+bool UInterestGrid::Add(const int64_t id, const float x, const float y, const bool bWatcher) {
+    // NaN Passes The Clamp And Breaks The Cell Index
+    if (!std::isfinite(x) || !std::isfinite(y))
+        return false;
+
+    if (mIndexMap.contains(id))
+        return false;
+
+    const auto index = static_cast<uint32_t>(mEntities.size());
+
+    auto &entity = mEntities.emplace_back();
+    entity.id = id;
+    entity.bWatcher = bWatcher;
+
+    mIndexMap.emplace(id, index);
+
+    const auto px = std::clamp(x, 0.f, mWidth);
+    const auto py = std::clamp(y, 0.f, mHeight);
+
+    InsertToCell(index, CellOf(px, py), px, py);
+    return true;
+}
+
+bool UInterestGrid::Move(const int64_t id, const float x, const float y) {
+    if (!std::isfinite(x) || !std::isfinite(y))
+        return false;
+
+    const auto iter = mIndexMap.find(id);
+    if (iter == mIndexMap.end())
+        return false;
+
+    const auto index = iter->second;
+    const auto &entity = mEntities[index];
+
+    const auto px = std::clamp(x, 0.f, mWidth);
+    const auto py = std::clamp(y, 0.f, mHeight);
+
+    if (const auto cell = CellOf(px, py); cell != entity.cell) {
+        RemoveFromCell(index);
+        InsertToCell(index, cell, px, py);
+    } else {
+        auto &entry = mCells[cell][entity.slot];
+        entry.x = px;
+        entry.y = py;
+        entry.bMoved = true;
+
+        MarkDirty(cell);
+    }
+
+    return true;
+}
+
+bool UInterestGrid::Remove(const int64_t id) {
+    const auto iter = mIndexMap.find(id);
+    if (iter == mIndexMap.end())
+        return false;
+
+    const auto index = iter->second;
+    mIndexMap.erase(iter);
+
+    RemoveFromCell(index);
+
+    // Swap The Last One Into The Hole, Fix Its Index In The Map And In Its Cell
+    if (const auto last = static_cast<uint32_t>(mEntities.size() - 1); index != last) {
+        mEntities[index] = std::move(mEntities[last]);
+
+        const auto &moved = mEntities[index];
+        mIndexMap[moved.id] = index;
+        mCells[moved.cell][moved.slot].index = index;
+    }
+
+    mEntities.pop_back();
+    return true;
+}
+
+bool UInterestGrid::Contains(const int64_t id) const {
+    return mIndexMap.contains(id);
+}
+
+size_t UInterestGrid::Size() const {
+    return mEntities.size();
+}
+
+void UInterestGrid::QueryRange(const float x, const float y, const float radius, const AVisitor &visitor) const {
+    if (visitor == nullptr)
+        return;
+
+    if (!std::isfinite(x) || !std::isfinite(y) || !std::isfinite(radius) || radius < 0.f)
+        return;
+
+    const auto reach = static_cast<int>(std::min(std::ceil(radius / mCellSize), static_cast<float>(std::max(mColumns, mRows))));
+    const auto cell = CellOf(std::clamp(x, 0.f, mWidth), std::clamp(y, 0.f, mHeight));
+    const auto cx = static_cast<int>(cell % mColumns);
+    const auto cy = static_cast<int>(cell / mColumns);
+    const auto squared = radius * radius;
+
+    for (int row = std::max(cy - reach, 0); row <= std::min(cy + reach, mRows - 1); ++row) {
+        for (int col = std::max(cx - reach, 0); col <= std::min(cx + reach, mColumns - 1); ++col) {
+            for (const auto &entry : mCells[row * mColumns + col]) {
+                const auto dx = entry.x - x;
+                const auto dy = entry.y - y;
+
+                if (dx * dx + dy * dy <= squared) {
+                    std::invoke(visitor, FInterestPoint{ entry.id, entry.x, entry.y });
+                }
+            }
+        }
+    }
+}
+
+const std::vector<int64_t> *UInterestGrid::GetVisible(const int64_t id) const {
+    const auto iter = mIndexMap.find(id);
+    if (iter == mIndexMap.end())
+        return nullptr;
+
+    return &mEntities[iter->second].visible;
+}
+
+void UInterestGrid::Tick(const ADiffHandler &handler) {
+    if (!mDirtyCells.empty()) {
+        for (auto &entity : mEntities) {
+            if (!entity.bWatcher)
+                continue;
+
+            // The Moved Watcher Always Dirties Its Own Cell
+            if (!IsSightDirty(entity.cell))
+                continue;
+
+            Recompute(entity);
+
+            if (!mDiff.IsEmpty() && handler != nullptr) {
+                std::invoke(handler, mDiff);
+            }
+        }
+    }
+
+    // The Moved Ones Are Only In The Dirty Cells
+    for (const auto cell : mDirtyCells) {
+        mDirtyFlags[cell] = 0;
+        for (auto &entry : mCells[cell]) {
+            entry.bMoved = false;
+        }
+    }
+    mDirtyCells.clear();
+}
+
+uint32_t UInterestGrid::CellOf(const float x, const float y) const {
+    // The Callers Reject The Non-Finite Ones, Clamp Both Bounds Anyway
+    const auto col = std::clamp(static_cast<int>(x / mCellSize), 0, mColumns - 1);
+    const auto row = std::clamp(static_cast<int>(y / mCellSize), 0, mRows - 1);
+    return static_cast<uint32_t>(row * mColumns + col);
+}
+
+void UInterestGrid::InsertToCell(const uint32_t index, const uint32_t cell, const float x, const float y) {
+    auto &list = mCells[cell];
+
+    auto &entity = mEntities[index];
+    entity.cell = cell;
+    entity.slot = static_cast<uint32_t>(list.size());
+
+    list.push_back({ entity.id, x, y, index, true });
+    MarkDirty(cell);
+}
+
+void UInterestGrid::RemoveFromCell(const uint32_t index) {
+    const auto &entity = mEntities[index];
+    auto &list = mCells[entity.cell];
+
+    if (entity.slot != list.size() - 1) {
+        list[entity.slot] = list.back();
+        mEntities[list[entity.slot].index].slot = entity.slot;
+    }
+
+    list.pop_back();
+    MarkDirty(entity.cell);
+}
+
+const UInterestGrid::FCellEntry &UInterestGrid::EntryOf(const FEntity &entity) const {
+    return mCells[entity.cell][entity.slot];
+}
+
+void UInterestGrid::MarkDirty(const uint32_t cell) {
+    if (mDirtyFlags[cell] != 0)
+        return;
+
+    mDirtyFlags[cell] = 1;
+    mDirtyCells.emplace_back(cell);
+}
+
+bool UInterestGrid::IsSightDirty(const uint32_t cell) const {
+    const auto cx = static_cast<int>(cell % mColumns);
+    const auto cy = static_cast<int>(cell / mColumns);
+
+    for (int row = std::max(cy - mReach, 0); row <= std::min(cy + mReach, mRows - 1); ++row) {
+        for (int col = std::max(cx - mReach, 0); col <= std::min(cx + mReach, mColumns - 1); ++col) {
+            if (mDirtyFlags[row * mColumns + col] != 0)
+                return true;
+        }
+    }
+
+    return false;
+}
+
+void UInterestGrid::Recompute(FEntity &watcher) {
+    mScratch.clear();
+
+    const auto &self = EntryOf(watcher);
+
+    const auto cx = static_cast<int>(watcher.cell % mColumns);
+    const auto cy = static_cast<int>(watcher.cell / mColumns);
+    const auto squared = mRadius * mRadius;
+
+    for (int row = std::max(cy - mReach, 0); row <= std::min(cy + mReach, mRows - 1); ++row) {
+        for (int col = std::max(cx - mReach, 0); col <= std::min(cx + mReach, mColumns - 1); ++col) {
+            for (const auto &entry : mCells[row * mColumns + col]) {
+                const auto dx = entry.x - self.x;
+                const auto dy = entry.y - self.y;
+
+                if (dx * dx + dy * dy <= squared && entry.id != watcher.id) {
+                    mScratch.emplace_back(&entry);
+                }
+            }
+        }
+    }
+
+    std::ranges::sort(mScratch, {}, &FCellEntry::id);
+
+    mDiff.watcher = watcher.id;
+    mDiff.enter.clear();
+    mDiff.leave.clear();
+    mDiff.update.clear();
+
+    mNextVisible.clear();
+    mNextVisible.reserve(mScratch.size());
+
+    // Merge The Sorted Sight Of The Last Tick With The New One
+    const auto &previous = watcher.visible;
+    size_t prev = 0;
+
+    for (const auto *other : mScratch) {
+        const auto id = other->id;
+
+        while (prev < previous.size() && previous[prev] < id) {
+            mDiff.leave.emplace_back(previous[prev++]);
+        }
+
+        if (prev < previous.size() && previous[prev] == id) {
+            ++prev;
+            if (other->bMoved) {
+                mDiff.update.push_back({ id, other->x, other->y });
+            }
+        } else {
+            mDiff.enter.push_back({ id, other->x, other->y });
+        }
+
+        mNextVisible.emplace_back(id);
+    }
+
+    while (prev < previous.size()) {
+        mDiff.leave.emplace_back(previous[prev++]);
+    }
+
+    watcher.visible.swap(mNextVisible);
+}
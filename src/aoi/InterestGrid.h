@@ -0,0 +1,136 @@
+#pragma once
+
+#include "Common.h"
+
+#include <unordered_map>
+#include <functional>
+#include <vector>
+#include <cstdint>
+
+
+/**
+ * The Position Of The Entity In The Diff
+ */
+struct BASE_API FInterestPoint {
+    int64_t id;
+    float x;
+    float y;
+};
+
+/**
+ * What The Watcher Should Be Told Since The Last Tick,
+ * Build One Update Packet Per Watcher From It
+ */
+struct BASE_API FInterestDiff {
+    int64_t watcher = 0;
+
+    std::vector<FInterestPoint> enter;
+    std::vector<int64_t> leave;
+
+    /** Still In Sight And Moved **/
+    std::vector<FInterestPoint> update;
+
+    [[nodiscard]] bool IsEmpty() const {
+        return enter.empty() && leave.empty() && update.empty();
+    }
+};
+
+
+/**
+ * Area Of Interest On A Uniform Grid, Bounded By [0, width) x [0, height);
+ * The Entity Sees Every Other Within The Radius. Move Only Marks The Cells Dirty,
+ * Tick Recomputes The Watchers Around The Dirty Cells And Reports The Enter, Leave And Update.
+ * Not Thread Safe, Owned By One Service
+ */
+class BASE_API UInterestGrid final {
+
+    struct FEntity {
+        int64_t id;
+
+        uint32_t cell;
+
+        /** The Index In The Entry List Of The Cell **/
+        uint32_t slot;
+
+        bool bWatcher;
+
+        /** Sorted, The Result Of The Last Tick **/
+        std::vector<int64_t> visible;
+    };
+
+    /// The Position Is Kept In The Cell, So The Sweep Reads The Cells Contiguously
+    struct FCellEntry {
+        int64_t id;
+        float x;
+        float y;
+        uint32_t index;
+        bool bMoved;
+    };
+
+public:
+    using AVisitor = std::function<void(const FInterestPoint &)>;
+    using ADiffHandler = std::function<void(const FInterestDiff &)>;
+
+    UInterestGrid(float width, float height, float cellSize, float radius);
+    ~UInterestGrid();
+
+    DISABLE_COPY_MOVE(UInterestGrid)
+
+    /// The Watcher Receives The Diff In Tick, The Others Are Only Seen;
+    /// The Non-Finite Position Is Rejected, The Others Are Clamped Into The Bounds
+    bool Add(int64_t id, float x, float y, bool bWatcher = true);
+    bool Move(int64_t id, float x, float y);
+    bool Remove(int64_t id);
+
+    [[nodiscard]] bool Contains(int64_t id) const;
+    [[nodiscard]] size_t Size() const;
+
+    /// Visit The Entities Within The Radius Around The Point, Without The Tick
+    void QueryRange(float x, float y, float radius, const AVisitor &visitor) const;
+
+    /// The Sight Of The Watcher After The Last Tick
+    [[nodiscard]] const std::vector<int64_t> *GetVisible(int64_t id) const;
+
+    /// Diff The Watchers Affected Since The Last Tick, The Handler Is Only Called With The Non-Empty Diff
+    void Tick(const ADiffHandler &handler);
+
+private:
+    [[nodiscard]] uint32_t CellOf(float x, float y) const;
+
+    void InsertToCell(uint32_t index, uint32_t cell, float x, float y);
+    void RemoveFromCell(uint32_t index);
+
+    [[nodiscard]] const FCellEntry &EntryOf(const FEntity &entity) const;
+
+    void MarkDirty(uint32_t cell);
+
+    /// Any Cell In The Sight Of The Cell Is Dirty
+    [[nodiscard]] bool IsSightDirty(uint32_t cell) const;
+
+    void Recompute(FEntity &watcher);
+
+private:
+    const float mWidth;
+    const float mHeight;
+    const float mCellSize;
+    const float mRadius;
+
+    const int mColumns;
+    const int mRows;
+
+    /** The Cells Covered By The Radius In Each Direction **/
+    const int mReach;
+
+    std::vector<FEntity> mEntities;
+    std::unordered_map<int64_t, uint32_t> mIndexMap;
+
+    std::vector<std::vector<FCellEntry>> mCells;
+
+    std::vector<uint8_t> mDirtyFlags;
+    std::vector<uint32_t> mDirtyCells;
+
+    /** Reused Across The Tick, No Allocation In The Steady State **/
+    std::vector<const FCellEntry *> mScratch;
+    std::vector<int64_t> mNextVisible;
+    FInterestDiff mDiff;
+};
@@ -0,0 +1,157 @@
+#pragma once
+
+#include "Common.h"
+#include "Types.h"
+
+#include <spdlog/spdlog.h>
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <variant>
+#include <atomic>
+
+
+/** Give Up Waiting For The Reply After This Long If The Caller Do Not Say **/
+inline constexpr auto ACTOR_CALL_TIMEOUT = std::chrono::seconds(5);
+
+
+/**
+ * The Class And The Return Type Of The Member Function Called By IActorBase::Call;
+ * The Value Is The Return Type, Or std::monostate For The Void One
+ */
+template<class>
+struct TActorMethod;
+
+template<class Return, class Class, class... Params>
+struct TActorMethod<Return (Class::*)(Params...)> {
+    using AClass = Class;
+    using AReturn = Return;
+    using AValue = std::conditional_t<std::is_void_v<Return>, std::monostate, Return>;
+};
+
+template<class Return, class Class, class... Params>
+struct TActorMethod<Return (Class::*)(Params...) const> : TActorMethod<Return (Class::*)(Params...)> {
+};
+
+template<auto Method>
+using TActorCallResult = std::optional<typename TActorMethod<decltype(Method)>::AValue>;
+
+
+namespace actor_call {
+    /// The Process Unique Correlation ID Of The Call
+    inline uint64_t NextCallID() {
+        static std::atomic_uint64_t next{0};
+        return next.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+}
+
+
+/**
+ * Run The Resumption Of The Caller As A Task Of Its Agent;
+ * If The Agent Is Gone The Resumption Is Destroyed Without Running, Which Closes The Call
+ */
+using AActorCallDelivery = std::function<void(std::function<void()> &&)>;
+
+
+/**
+ * The Pending Call, Shared By The Caller And The Task Posted To The Callee;
+ * The Reply Or The Timeout Is Delivered As A Task Of The Caller's Agent, Which Hands It To The One Slot Channel
+ * By Dispatch, So The Caller Resumes Inside Its Own Actor, Never Beside The Channel Looping In Another Thread.
+ * Only The First Of The Reply And The Timeout Counts, The Late One Is Dropped.
+ * A Resumption Dropped Without Running Closes The Channel, So The Caller Wakes With Nothing Instead Of Leaking
+ */
+template<class Value>
+class TActorCallState final : public std::enable_shared_from_this<TActorCallState<Value>> {
+
+    using AReplyChannel = TConcurrentChannel<void(std::error_code, std::optional<Value>)>;
+
+    AReplyChannel mChannel;
+    ASteadyTimer mTimer;
+
+    AActorCallDelivery mDelivery;
+
+    std::atomic_bool bReplied;
+    const uint64_t mCallID;
+
+    /** The ID Still Waited For, Cleared Once The Wait Ends, So A Late Delivery Is Rejected **/
+    std::atomic_uint64_t mPendingID;
+
+    /** The Reply On Its Way To The Caller, Closes The Call If Destroyed Before Delivered **/
+    struct FPendingReply {
+        std::shared_ptr<TActorCallState> state;
+        std::optional<Value> value;
+        uint64_t callID = 0;
+        bool bDelivered = false;
+
+        ~FPendingReply() {
+            if (!bDelivered) {
+                SPDLOG_WARN("{:<20} - Call[{}] Reply Dropped Before Delivered", __FUNCTION__, callID);
+                state->mChannel.close();
+            }
+        }
+    };
+
+public:
+    TActorCallState(const asio::any_io_executor &executor, AActorCallDelivery &&delivery)
+        : mChannel(executor, 1),
+          mTimer(executor),
+          mDelivery(std::move(delivery)),
+          bReplied(false),
+          mCallID(actor_call::NextCallID()),
+          mPendingID(mCallID) {
+    }
+
+    DISABLE_COPY_MOVE(TActorCallState)
+
+    [[nodiscard]] uint64_t GetCallID() const {
+        return mCallID;
+    }
+
+    /// Called In The Callee's Thread, Null If The Callee Is Not The Expected Class Or Failed
+    void Reply(std::optional<Value> &&value) {
+        if (bReplied.exchange(true, std::memory_order_acq_rel))
+            return;
+
+        // The Task Must Be Copyable, Share The Value
+        auto pending = std::make_shared<FPendingReply>(this->shared_from_this(), std::move(value), mCallID);
+
+        std::invoke(mDelivery, [pending] {
+            pending->bDelivered = true;
+
+            auto &state = *pending->state;
+            if (state.mPendingID.load(std::memory_order_acquire) != pending->callID) {
+                SPDLOG_DEBUG("{:<20} - Call[{}] Replied After The Wait Ended, Rejected", __FUNCTION__, pending->callID);
+                return;
+            }
+
+            // In The Thread Of The Caller's Context, The Caller Resumes In Place
+            state.mChannel.try_send_via_dispatch(std::error_code{}, std::move(pending->value));
+        });
+    }
+
+    /// Null If Failed Or Timeout; Await In The Coroutine Running On The Context Of The Caller's Agent
+    awaitable<std::optional<Value>> Wait(const ASteadyDuration timeout) {
+        mTimer.expires_after(timeout);
+        mTimer.async_wait([weak = this->weak_from_this(), func = __FUNCTION__](const std::error_code &ec) {
+            if (ec)
+                return;
+
+            if (const auto self = weak.lock(); self != nullptr && !self->bReplied.load(std::memory_order_acquire)) {
+                SPDLOG_WARN("{:<20} - Call[{}] Not Replied In Time", func, self->mCallID);
+                self->Reply(std::nullopt);
+            }
+        });
+
+        auto [ec, value] = co_await mChannel.async_receive();
+
+        mPendingID.store(0, std::memory_order_release);
+        mTimer.cancel();
+        mChannel.close();
+
+        if (ec)
+            co_return std::nullopt;
+
+        co_return std::move(value);
+    }
+};
@@ -51,7 +51,7 @@ std::vector<uint8_t> &FByteArray::RawRef() {
 }
 
 void FByteArray::FromString(const std::string_view sv) {
-    mByteArray.reserve(sv.size());
+    mByteArray.resize(sv.size());
     std::memcpy(mByteArray.data(), sv.data(), sv.size());
 }
 
@@ -0,0 +1,192 @@
+#include "ContextWatchdog.h"
+#include "monitor/Metrics.h"
+
+#include <asio/post.hpp>
+#include <spdlog/spdlog.h>
+#include <format>
+
+
+namespace {
+    thread_local FExecuteSlot *tExecuteSlot = nullptr;
+
+    int64_t NowMicroseconds() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+UContextWatchdog::UContextWatchdog()
+    : mInterval(0),
+      mThreshold(0),
+      bQuit(false) {
+}
+
+UContextWatchdog::~UContextWatchdog() {
+    Stop();
+}
+
+void UContextWatchdog::SetPoolName(const std::string &name) {
+    mPoolName = name;
+}
+
+void UContextWatchdog::SetInterval(const int ms) {
+    mInterval = ms;
+}
+
+void UContextWatchdog::SetThreshold(const int ms) {
+    mThreshold = ms;
+}
+
+bool UContextWatchdog::IsEnabled() const {
+    return mInterval > 0 && mThreshold > 0;
+}
+
+size_t UContextWatchdog::AddContext(asio::io_context &context, const size_t threads) {
+    auto target = std::make_unique<FWatchTarget>();
+
+    target->context = &context;
+    target->labels = std::format("pool=\"{}\",context=\"{}\"", mPoolName, mTargetList.size());
+
+    for (size_t idx = 0; idx < threads; ++idx) {
+        target->slots.emplace_back(std::make_unique<FExecuteSlot>());
+    }
+
+    auto &registry = UMetricsRegistry::Instance();
+    target->lagHistogram = registry.GetHistogram("uranus_context_lag_microseconds", "The Delay Of The Heartbeat Posted To The IO Context", target->labels, 1);
+    target->stallCounter = registry.GetCounter("uranus_context_stall_total", "The Times The IO Context Lag Crossed The Threshold", target->labels);
+
+    mTargetList.emplace_back(std::move(target));
+    return mTargetList.size() - 1;
+}
+
+FExecuteSlot *UContextWatchdog::GetSlot(const size_t index, const size_t thread) const {
+    if (index >= mTargetList.size())
+        return nullptr;
+
+    const auto &slots = mTargetList[index]->slots;
+    return thread < slots.size() ? slots[thread].get() : nullptr;
+}
+
+void UContextWatchdog::Start() {
+    if (!IsEnabled() || mTargetList.empty() || mThread.joinable())
+        return;
+
+    bQuit = false;
+    mThread = std::thread([this] {
+        WatchLoop();
+    });
+}
+
+void UContextWatchdog::Stop() {
+    {
+        std::unique_lock lock(mMutex);
+        bQuit = true;
+    }
+    mCondVar.notify_all();
+
+    if (mThread.joinable()) {
+        mThread.join();
+    }
+}
+
+void UContextWatchdog::BindThread(FExecuteSlot *slot) {
+    tExecuteSlot = slot;
+}
+
+void UContextWatchdog::WatchLoop() {
+    while (true) {
+        {
+            std::unique_lock lock(mMutex);
+            if (mCondVar.wait_for(lock, std::chrono::milliseconds(mInterval), [this] { return bQuit; }))
+                break;
+        }
+
+        const auto now = NowMicroseconds();
+        for (const auto &target : mTargetList) {
+            Check(*target, now);
+        }
+    }
+}
+
+void UContextWatchdog::Check(FWatchTarget &target, const int64_t now) {
+    if (target.context->stopped())
+        return;
+
+    // Post The Next Heartbeat After The Last One Executed
+    if (!target.bPending.load(std::memory_order_acquire)) {
+        target.bReported = false;
+        target.postTime.store(now, std::memory_order_relaxed);
+        target.bPending.store(true, std::memory_order_release);
+
+        asio::post(*target.context, [pTarget = &target] {
+            const auto lag = NowMicroseconds() - pTarget->postTime.load(std::memory_order_relaxed);
+            pTarget->lagHistogram->Record(std::max<int64_t>(lag, 0));
+            pTarget->bPending.store(false, std::memory_order_release);
+        });
+
+        return;
+    }
+
+    const auto lag = now - target.postTime.load(std::memory_order_relaxed);
+    if (target.bReported || lag < static_cast<int64_t>(mThreshold) * 1000)
+        return;
+
+    // Report Once For Every Stall
+    target.bReported = true;
+    target.stallCounter->Increment();
+
+    SPDLOG_WARN("{} - IO Context[{}] Stalled {}ms", __FUNCTION__, target.labels, lag / 1000);
+
+    for (size_t idx = 0; idx < target.slots.size(); ++idx) {
+        const auto &slot = target.slots[idx];
+
+        // Paired With The Release Store Of The Agent, The Identity Published Before It Is Visible
+        if (slot->agent.load(std::memory_order_acquire) == nullptr)
+            continue;
+
+        const auto *kind = slot->kind.load(std::memory_order_relaxed);
+        const auto cost = now - slot->beginTime.load(std::memory_order_relaxed);
+
+        SPDLOG_WARN("{} - IO Context[{}] Thread[{}] Executing Agent[{}:{}] Package[{}] For {}ms",
+            __FUNCTION__, target.labels, idx, kind != nullptr ? kind : "agent", slot->actorID.load(std::memory_order_relaxed),
+            slot->packageID.load(std::memory_order_relaxed), cost / 1000);
+    }
+}
+
+UContextWatchdog::FExecuteScope::FExecuteScope(const void *agent, const char *kind, const int64_t actorID, const uint32_t packageID)
+    : mSlot(tExecuteSlot),
+      mOuterAgent(nullptr),
+      mOuterKind(nullptr),
+      mOuterActorID(-1),
+      mOuterPackageID(0),
+      mOuterBeginTime(0) {
+    if (mSlot == nullptr)
+        return;
+
+    // Only Written By This Thread, The Relaxed Loads Are Enough
+    mOuterAgent = mSlot->agent.load(std::memory_order_relaxed);
+    mOuterKind = mSlot->kind.load(std::memory_order_relaxed);
+    mOuterActorID = mSlot->actorID.load(std::memory_order_relaxed);
+    mOuterPackageID = mSlot->packageID.load(std::memory_order_relaxed);
+    mOuterBeginTime = mSlot->beginTime.load(std::memory_order_relaxed);
+
+    mSlot->kind.store(kind, std::memory_order_relaxed);
+    mSlot->actorID.store(actorID, std::memory_order_relaxed);
+    mSlot->packageID.store(packageID, std::memory_order_relaxed);
+    mSlot->beginTime.store(NowMicroseconds(), std::memory_order_relaxed);
+    mSlot->agent.store(agent, std::memory_order_release);
+}
+
+UContextWatchdog::FExecuteScope::~FExecuteScope() {
+    if (mSlot == nullptr)
+        return;
+
+    if (mOuterAgent != nullptr) {
+        mSlot->kind.store(mOuterKind, std::memory_order_relaxed);
+        mSlot->actorID.store(mOuterActorID, std::memory_order_relaxed);
+        mSlot->packageID.store(mOuterPackageID, std::memory_order_relaxed);
+        mSlot->beginTime.store(mOuterBeginTime, std::memory_order_relaxed);
+    }
+
+    mSlot->agent.store(mOuterAgent, std::memory_order_release);
+}
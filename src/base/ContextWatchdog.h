@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Common.h"
+
+#include <asio/io_context.hpp>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <mutex>
+
+
+class UMetricHistogram;
+class UMetricCounter;
+
+
+/**
+ * What The IO Thread Is Executing, Written By The Agent Before Every Channel Node;
+ * The Agent Is Identified By Value, The Watchdog Thread Never Touches The Agent Owned By Another Thread
+ */
+struct alignas(64) FExecuteSlot {
+    std::atomic<const void *> agent{nullptr};
+    std::atomic<const char *> kind{nullptr};
+    std::atomic_int64_t actorID{-1};
+    std::atomic_uint32_t packageID{0};
+    std::atomic_int64_t beginTime{0};
+};
+
+/**
+ * Measure The Event-Loop Lag Of The IO Contexts By Posting A Heartbeat And Timing Its Execution,
+ * Report The Lag Histogram, And The Executing Agent And Package When The Lag Crosses The Threshold
+ */
+class BASE_API UContextWatchdog final {
+
+    struct FWatchTarget {
+        asio::io_context *context = nullptr;
+        std::string labels;
+
+        /** One Slot Per Thread Running The Context **/
+        std::vector<std::unique_ptr<FExecuteSlot>> slots;
+
+        std::atomic_bool bPending{false};
+        std::atomic_int64_t postTime{0};
+        bool bReported = false;
+
+        UMetricHistogram *lagHistogram = nullptr;
+        UMetricCounter *stallCounter = nullptr;
+    };
+
+public:
+    UContextWatchdog();
+    ~UContextWatchdog();
+
+    DISABLE_COPY_MOVE(UContextWatchdog)
+
+    /// The Name Of The Owner Pool, Used As The Metric Label
+    void SetPoolName(const std::string &name);
+
+    /// The Heartbeat Interval In Milliseconds
+    void SetInterval(int ms);
+
+    /// Report The Stall When The Heartbeat Not Executed In Threshold Milliseconds
+    void SetThreshold(int ms);
+
+    [[nodiscard]] bool IsEnabled() const;
+
+    /// Add The Context Before Start, Return Its Index
+    size_t AddContext(asio::io_context &context, size_t threads);
+
+    /// The Slot Of The Thread Running The Context, Bind It In That Thread
+    [[nodiscard]] FExecuteSlot *GetSlot(size_t index, size_t thread) const;
+
+    void Start();
+    void Stop();
+
+    /// Bind The Slot To The Calling Thread, Null To Unbind
+    static void BindThread(FExecuteSlot *slot);
+
+    /**
+     * Publish The Executing Agent And Package Into The Slot Of The Current Thread,
+     * Nothing To Do If The Thread Is Not Watched; The Scopes Nest,
+     * The Outer One Is Published Again When The Inner Inline Execution Ends
+     */
+    class BASE_API FExecuteScope final {
+
+    public:
+        /// The Kind Must Be In Static Storage, Read By The Watchdog Thread At Any Time
+        FExecuteScope(const void *agent, const char *kind, int64_t actorID, uint32_t packageID);
+        ~FExecuteScope();
+
+        DISABLE_COPY_MOVE(FExecuteScope)
+
+    private:
+        FExecuteSlot *mSlot;
+
+        const void *mOuterAgent;
+        const char *mOuterKind;
+        int64_t mOuterActorID;
+        uint32_t mOuterPackageID;
+        int64_t mOuterBeginTime;
+    };
+
+private:
+    void WatchLoop();
+    void Check(FWatchTarget &target, int64_t now);
+
+private:
+    std::string mPoolName;
+    int mInterval;
+    int mThreshold;
+
+    std::vector<std::unique_ptr<FWatchTarget>> mTargetList;
+
+    std::thread mThread;
+    std::mutex mMutex;
+    std::condition_variable mCondVar;
+    bool bQuit;
+};
@@ -1,111 +1,375 @@
 #pragma once
 
-#include <unordered_set>
+#include "Common.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
 #include <atomic>
-#include <mutex>
+#include <array>
+#include <bit>
 
-template<class Type, bool bConcurrent>
+
+/**
+ * The Single Thread Identity Allocator, The IDs Begin With 1;
+ * The Free IDs Are Marked In A Two-Level Bitmap And The Lowest One Is Reused First,
+ * So The IDs Stay Dense And Nothing Is Allocated Per Recycle.
+ * Every Recycle Bumps The Generation Of The ID, Compare It To Detect The Stale Holder
+ */
+template<class Type>
 requires std::is_integral_v<Type>
-class TIdentAllocator {
+class TBitmapIdentAllocator final {
+
+    static constexpr size_t WORD_BITS = 64;
 
-    struct FEmptyMutex {};
+public:
+    TBitmapIdentAllocator()
+        : mHint(0),
+          mNext(0),
+          mUsage(0) {
+    }
+
+    /// The Same As ::Allocate(), Keep The Interface Of The Concurrent One
+    Type AllocateTS() { return Allocate(); }
+    Type Allocate();
 
-    using AAllocatorMutex   = std::conditional_t<bConcurrent, std::mutex, FEmptyMutex>;
-    using AIntegralType     = std::conditional_t<bConcurrent, std::atomic<Type>, Type>;
+    /// The Same As ::Recycle(), Keep The Interface Of The Concurrent One
+    void RecycleTS(Type id) { Recycle(id); }
+
+    /// The Unknown ID And The ID Already Recycled Are Ignored
+    void Recycle(Type id);
+
+    [[nodiscard]] Type GetUsage() const;
+
+    [[nodiscard]] uint32_t GetGeneration(Type id) const;
+
+    /// The ID Is In Use And Not Recycled Since The Generation Was Taken
+    [[nodiscard]] bool IsValid(Type id, uint32_t generation) const;
+
+private:
+    /** Bit Set For The Free ID, Indexed By ID - 1 **/
+    std::vector<uint64_t> mFreeBits;
+
+    /** Bit Set For The Word Of mFreeBits That Has Any Free ID **/
+    std::vector<uint64_t> mSummary;
+
+    /** Indexed By ID - 1, The Size Is The Count Of The IDs Ever Issued **/
+    std::vector<uint32_t> mGenerations;
+
+    /** No Free ID Below This Word Of mSummary **/
+    size_t mHint;
+
+    Type mNext;
+    Type mUsage;
+};
+
+
+/**
+ * The Lock-Free Identity Allocator, The IDs Begin With 1;
+ * The Free IDs Are Linked In A Tagged Treiber Stack Over The Slot Segments,
+ * The Segments Grow Geometrically And Never Move Until Destruction.
+ * Every Recycle Bumps The Generation Of The ID, Compare It To Detect The Stale Holder
+ */
+template<class Type>
+requires std::is_integral_v<Type>
+class TLockFreeIdentAllocator final {
+
+    static constexpr size_t FIRST_SEGMENT_SIZE = 64;
+
+    /** The Segments Cover Just Under 2^32 Slots, The Index Fits The Low Half Of The Stack Head **/
+    static constexpr size_t MAX_SEGMENT_COUNT = 26;
+    static constexpr size_t MAX_SLOT_COUNT = FIRST_SEGMENT_SIZE * ((static_cast<size_t>(1) << MAX_SEGMENT_COUNT) - 1);
+
+    static constexpr uint64_t HEAD_INDEX_MASK = 0xFFFFFFFF;
+
+    struct FSlot {
+        /** The Index + 1 Of The Next Free Slot, Zero For The Bottom **/
+        std::atomic_uint32_t next;
+
+        /** The Generation Shifted Left By One, The Lowest Bit Is Set While In Use **/
+        std::atomic_uint32_t stamp;
+    };
 
 public:
+    TLockFreeIdentAllocator();
+    ~TLockFreeIdentAllocator();
+
+    DISABLE_COPY_MOVE(TLockFreeIdentAllocator)
+
     Type AllocateTS();
-    Type Allocate();
 
+    /// The Same As ::AllocateTS(), Keep The Interface Of The Single Thread One
+    Type Allocate() { return AllocateTS(); }
+
+    /// The Unknown ID And The ID Already Recycled Are Ignored
     void RecycleTS(Type id);
-    void Recycle(Type id);
 
-    Type GetUsage() const;
+    /// The Same As ::RecycleTS(), Keep The Interface Of The Single Thread One
+    void Recycle(Type id) { RecycleTS(id); }
+
+    [[nodiscard]] Type GetUsage() const;
+
+    [[nodiscard]] uint32_t GetGeneration(Type id) const;
+
+    /// The ID Is In Use And Not Recycled Since The Generation Was Taken
+    [[nodiscard]] bool IsValid(Type id, uint32_t generation) const;
 
 private:
-    std::unordered_set<Type>    mHashSet;
-    AAllocatorMutex             mMutex;
-    AIntegralType               mNext;
-    AIntegralType               mUsage;
+    /// The Segment Index And The Offset Inside It
+    static std::pair<size_t, size_t> Locate(size_t index);
+
+    /// Null If The Segment Is Not Created Yet
+    [[nodiscard]] FSlot *FindSlot(size_t index) const;
+
+    /// Create The Segment If Needed
+    FSlot &EnsureSlot(size_t index);
+
+private:
+    std::array<std::atomic<FSlot *>, MAX_SEGMENT_COUNT> mSegments;
+
+    /** The ABA Tag In The High Half, The Index + 1 Of The Top Free Slot In The Low Half **/
+    std::atomic_uint64_t mFreeHead;
+
+    std::atomic_uint64_t mNext;
+    std::atomic_int64_t mUsage;
 };
 
+
+/**
+ * The Identity Allocator Used By The Timer Manager And The Service Module,
+ * The Concurrent One Is Lock-Free
+ */
 template<class Type, bool bConcurrent>
 requires std::is_integral_v<Type>
-inline Type TIdentAllocator<Type, bConcurrent>::AllocateTS() {
-    if constexpr (bConcurrent) {
-        std::unique_lock lock(mMutex);
-        if (const auto iter = mHashSet.begin(); iter != mHashSet.end()) {
-            const auto res = *iter;
-            mHashSet.erase(iter);
+using TIdentAllocator = std::conditional_t<bConcurrent, TLockFreeIdentAllocator<Type>, TBitmapIdentAllocator<Type>>;
 
-            ++mUsage;
-            return res;
-        }
-    } else {
-        if (const auto iter = mHashSet.begin(); iter != mHashSet.end()) {
-            const auto res = *iter;
-            mHashSet.erase(iter);
 
-            ++mUsage;
-            return res;
+template<class Type>
+requires std::is_integral_v<Type>
+Type TBitmapIdentAllocator<Type>::Allocate() {
+    for (; mHint < mSummary.size(); ++mHint) {
+        if (mSummary[mHint] == 0)
+            continue;
+
+        const size_t word = mHint * WORD_BITS + std::countr_zero(mSummary[mHint]);
+        const size_t bit = std::countr_zero(mFreeBits[word]);
+
+        // Clear The Lowest Set Bit
+        mFreeBits[word] &= mFreeBits[word] - 1;
+        if (mFreeBits[word] == 0) {
+            mSummary[mHint] &= ~(static_cast<uint64_t>(1) << (word % WORD_BITS));
         }
+
+        ++mUsage;
+        return static_cast<Type>(word * WORD_BITS + bit + 1);
     }
 
+    mGenerations.emplace_back(0);
+
     ++mUsage;
     return ++mNext;
 }
 
-template<class Type, bool bConcurrent>
+template<class Type>
 requires std::is_integral_v<Type>
-Type TIdentAllocator<Type, bConcurrent>::Allocate() {
-    if (const auto iter = mHashSet.begin(); iter != mHashSet.end()) {
-        const auto res = *iter;
-        mHashSet.erase(iter);
+void TBitmapIdentAllocator<Type>::Recycle(Type id) {
+    // Zero And Negative Wrap Around To The Huge Index
+    const auto index = static_cast<size_t>(id) - 1;
+    if (index >= mGenerations.size())
+        return;
 
-        ++mUsage;
-        return res;
+    const size_t word = index / WORD_BITS;
+    const auto mask = static_cast<uint64_t>(1) << (index % WORD_BITS);
+
+    if (word >= mFreeBits.size()) {
+        mFreeBits.resize((mGenerations.size() + WORD_BITS - 1) / WORD_BITS, 0);
+        mSummary.resize((mFreeBits.size() + WORD_BITS - 1) / WORD_BITS, 0);
     }
 
-    ++mUsage;
-    return ++mNext;
+    if (mFreeBits[word] & mask)
+        return;
+
+    mFreeBits[word] |= mask;
+    mSummary[word / WORD_BITS] |= static_cast<uint64_t>(1) << (word % WORD_BITS);
+    mHint = std::min(mHint, word / WORD_BITS);
+
+    ++mGenerations[index];
+    --mUsage;
 }
 
-template<class Type, bool bConcurrent>
+template<class Type>
+requires std::is_integral_v<Type>
+Type TBitmapIdentAllocator<Type>::GetUsage() const {
+    return mUsage;
+}
+
+template<class Type>
+requires std::is_integral_v<Type>
+uint32_t TBitmapIdentAllocator<Type>::GetGeneration(Type id) const {
+    const auto index = static_cast<size_t>(id) - 1;
+    return index < mGenerations.size() ? mGenerations[index] : 0;
+}
+
+template<class Type>
 requires std::is_integral_v<Type>
-inline void TIdentAllocator<Type, bConcurrent>::RecycleTS(Type id) {
-    if constexpr (bConcurrent) {
-        std::unique_lock lock(mMutex);
-        mHashSet.emplace(id);
-    } else {
-        mHashSet.emplace(id);
+bool TBitmapIdentAllocator<Type>::IsValid(Type id, const uint32_t generation) const {
+    const auto index = static_cast<size_t>(id) - 1;
+    if (index >= mGenerations.size())
+        return false;
+
+    if (const size_t word = index / WORD_BITS; word < mFreeBits.size() && (mFreeBits[word] & (static_cast<uint64_t>(1) << (index % WORD_BITS))))
+        return false;
+
+    return mGenerations[index] == generation;
+}
+
+template<class Type>
+requires std::is_integral_v<Type>
+TLockFreeIdentAllocator<Type>::TLockFreeIdentAllocator()
+    : mFreeHead(0),
+      mNext(0),
+      mUsage(0) {
+    for (auto &segment : mSegments) {
+        segment.store(nullptr, std::memory_order_relaxed);
     }
+}
 
-    --mUsage;
-    if constexpr (bConcurrent) {
-        mUsage = mUsage.load() > 0 ? mUsage.load() : 0;
-    } else {
-        mUsage = mUsage > 0 ? mUsage : 0;
+template<class Type>
+requires std::is_integral_v<Type>
+TLockFreeIdentAllocator<Type>::~TLockFreeIdentAllocator() {
+    for (auto &segment : mSegments) {
+        delete[] segment.exchange(nullptr, std::memory_order_acquire);
     }
 }
 
-template<class Type, bool bConcurrent>
+template<class Type>
 requires std::is_integral_v<Type>
-inline void TIdentAllocator<Type, bConcurrent>::Recycle(Type id) {
-    mHashSet.emplace(id);
+std::pair<size_t, size_t> TLockFreeIdentAllocator<Type>::Locate(const size_t index) {
+    // The Segment N Holds FIRST_SEGMENT_SIZE << N Slots
+    const size_t segment = std::bit_width(index / FIRST_SEGMENT_SIZE + 1) - 1;
+    const size_t offset = index - FIRST_SEGMENT_SIZE * ((static_cast<size_t>(1) << segment) - 1);
+    return { segment, offset };
+}
 
-    --mUsage;
-    if constexpr (bConcurrent) {
-        mUsage = mUsage.load() > 0 ? mUsage.load() : 0;
-    } else {
-        mUsage = mUsage > 0 ? mUsage : 0;
+template<class Type>
+requires std::is_integral_v<Type>
+typename TLockFreeIdentAllocator<Type>::FSlot *TLockFreeIdentAllocator<Type>::FindSlot(const size_t index) const {
+    const auto [segment, offset] = Locate(index);
+    if (segment >= MAX_SEGMENT_COUNT)
+        return nullptr;
+
+    if (auto *slots = mSegments[segment].load(std::memory_order_acquire))
+        return slots + offset;
+
+    return nullptr;
+}
+
+template<class Type>
+requires std::is_integral_v<Type>
+typename TLockFreeIdentAllocator<Type>::FSlot &TLockFreeIdentAllocator<Type>::EnsureSlot(const size_t index) {
+    const auto [segment, offset] = Locate(index);
+
+    auto *slots = mSegments[segment].load(std::memory_order_acquire);
+    if (slots == nullptr) {
+        auto *created = new FSlot[FIRST_SEGMENT_SIZE << segment]{};
+
+        // Another Thread May Create The Same Segment At The Same Time
+        if (mSegments[segment].compare_exchange_strong(slots, created, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            slots = created;
+        } else {
+            delete[] created;
+        }
     }
+
+    return slots[offset];
 }
 
-template<class Type, bool bConcurrent>
+template<class Type>
 requires std::is_integral_v<Type>
-inline Type TIdentAllocator<Type, bConcurrent>::GetUsage() const {
-    if constexpr (bConcurrent) {
-        return mUsage.load();
+Type TLockFreeIdentAllocator<Type>::AllocateTS() {
+    uint64_t head = mFreeHead.load(std::memory_order_acquire);
+
+    while ((head & HEAD_INDEX_MASK) != 0) {
+        const auto top = static_cast<uint32_t>(head & HEAD_INDEX_MASK);
+        FSlot *slot = FindSlot(top - 1);
+
+        // The Slot Is Never Freed, Reading It After Popped By Others Only Fails The CAS
+        const uint64_t next = ((head >> 32) + 1) << 32 | slot->next.load(std::memory_order_relaxed);
+
+        if (mFreeHead.compare_exchange_weak(head, next, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            // The Popped Slot Is Owned, No Other Writer Of The Stamp
+            slot->stamp.store(slot->stamp.load(std::memory_order_relaxed) | 1, std::memory_order_release);
+            mUsage.fetch_add(1, std::memory_order_relaxed);
+            return static_cast<Type>(top);
+        }
     }
-    return mUsage;
+
+    const auto index = mNext.fetch_add(1, std::memory_order_relaxed);
+    if (index >= MAX_SLOT_COUNT)
+        throw std::length_error("TLockFreeIdentAllocator::AllocateTS - Identity Exhausted");
+
+    EnsureSlot(index).stamp.store(1, std::memory_order_release);
+    mUsage.fetch_add(1, std::memory_order_relaxed);
+
+    return static_cast<Type>(index + 1);
+}
+
+template<class Type>
+requires std::is_integral_v<Type>
+void TLockFreeIdentAllocator<Type>::RecycleTS(Type id) {
+    const auto index = static_cast<size_t>(id) - 1;
+    if (index >= mNext.load(std::memory_order_acquire))
+        return;
+
+    FSlot *slot = FindSlot(index);
+    if (slot == nullptr)
+        return;
+
+    // Only One Of The Concurrent Recycles Wins, It Also Bumps The Generation
+    uint32_t stamp = slot->stamp.load(std::memory_order_acquire);
+    do {
+        if ((stamp & 1) == 0)
+            return;
+    } while (!slot->stamp.compare_exchange_weak(stamp, stamp + 1, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    uint64_t head = mFreeHead.load(std::memory_order_relaxed);
+    uint64_t top;
+    do {
+        slot->next.store(static_cast<uint32_t>(head & HEAD_INDEX_MASK), std::memory_order_relaxed);
+        top = ((head >> 32) + 1) << 32 | (index + 1);
+    } while (!mFreeHead.compare_exchange_weak(head, top, std::memory_order_release, std::memory_order_relaxed));
+
+    mUsage.fetch_sub(1, std::memory_order_relaxed);
+}
+
+template<class Type>
+requires std::is_integral_v<Type>
+Type TLockFreeIdentAllocator<Type>::GetUsage() const {
+    return static_cast<Type>(mUsage.load(std::memory_order_relaxed));
+}
+
+template<class Type>
+requires std::is_integral_v<Type>
+uint32_t TLockFreeIdentAllocator<Type>::GetGeneration(Type id) const {
+    const auto index = static_cast<size_t>(id) - 1;
+    if (index >= mNext.load(std::memory_order_acquire))
+        return 0;
+
+    if (const FSlot *slot = FindSlot(index))
+        return slot->stamp.load(std::memory_order_acquire) >> 1;
+
+    return 0;
+}
+
+template<class Type>
+requires std::is_integral_v<Type>
+bool TLockFreeIdentAllocator<Type>::IsValid(Type id, const uint32_t generation) const {
+    const auto index = static_cast<size_t>(id) - 1;
+    if (index >= mNext.load(std::memory_order_acquire))
+        return false;
+
+    if (const FSlot *slot = FindSlot(index))
+        return slot->stamp.load(std::memory_order_acquire) == (generation << 1 | 1);
+
+    return false;
 }
@@ -21,10 +21,23 @@ UMultiIOContextPool::~UMultiIOContextPool() {
     }
 }
 
+void UMultiIOContextPool::SetUpWatchdog(const std::string &name, const int interval, const int threshold) {
+    mWatchdog.SetPoolName(name);
+    mWatchdog.SetInterval(interval);
+    mWatchdog.SetThreshold(threshold);
+}
+
 void UMultiIOContextPool::Start(const size_t count) {
     mNodeList = std::vector<FPoolNode>(count);
     for (auto &node: mNodeList) {
-        node.thread = std::thread([&node] {
+        FExecuteSlot *slot = nullptr;
+        if (mWatchdog.IsEnabled()) {
+            slot = mWatchdog.GetSlot(mWatchdog.AddContext(node.context, 1), 0);
+        }
+
+        node.thread = std::thread([&node, slot] {
+            UContextWatchdog::BindThread(slot);
+
             asio::signal_set signals(node.context, SIGINT, SIGTERM);
             signals.async_wait([&node](auto, auto) {
                 node.guard.reset();
@@ -34,9 +47,13 @@ void UMultiIOContextPool::Start(const size_t count) {
             node.context.run();
         });
     }
+
+    mWatchdog.Start();
 }
 
 void UMultiIOContextPool::Stop() {
+    mWatchdog.Stop();
+
     for (auto &node: mNodeList) {
         node.guard.reset();
         node.context.stop();
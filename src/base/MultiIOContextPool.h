@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Common.h"
+#include "ContextWatchdog.h"
 
 #include <asio/io_context.hpp>
 #include <vector>
@@ -24,6 +25,9 @@ public:
 
     DISABLE_COPY_MOVE(UMultiIOContextPool)
 
+    /// Enable The Stall Detector Of Every Context, Call Before Start
+    void SetUpWatchdog(const std::string &name, int interval, int threshold);
+
     void Start(size_t count);
     void Stop();
 
@@ -32,4 +36,6 @@ public:
 private:
     std::vector<FPoolNode> mNodeList;
     std::atomic_size_t mNextIndex;
+
+    UContextWatchdog mWatchdog;
 };
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Common.h"
+#include "PackageTrace.h"
+#include "TypeTag.h"
 
 #include <cstdint>
 
@@ -8,11 +10,16 @@
 class BASE_API IPackage_Interface {
 
 public:
+    static constexpr ATypeTag TYPE_TAG = type_tag::PACKAGE;
+
     IPackage_Interface() = default;
     virtual ~IPackage_Interface() = default;
 
     DISABLE_COPY_MOVE(IPackage_Interface)
 
+    /// The Implement Overrides By DECLARE_TYPE_TAG, The Codec And The Handlers Cast By It
+    [[nodiscard]] virtual bool HasTypeTag(const ATypeTag tag) const noexcept { return tag == TYPE_TAG; }
+
     virtual void SetPackageID(uint32_t id) = 0;
     virtual void SetSource(int32_t source) = 0;
     virtual void SetTarget(int32_t target) = 0;
@@ -20,6 +27,24 @@ public:
     [[nodiscard]] virtual uint32_t GetPackageID() const = 0;
     [[nodiscard]] virtual int32_t GetSource() const = 0;
     [[nodiscard]] virtual int32_t GetTarget() const = 0;
+
+    /// The Player Whose Client Sent The Package, Stamped By Its Agent On The Delivery And Never Encoded;
+    /// The Services Trust This Instead Of Any ID In The Payload, -1 If Not From A Client
+    virtual void SetSenderPlayer(int64_t pid) {}
+    [[nodiscard]] virtual int64_t GetSenderPlayer() const { return -1; }
+
+    /// The Latency Trace Of This Package, Null If The Implement Do Not Support
+    [[nodiscard]] virtual FPackageTrace *GetTrace() { return nullptr; }
+
+    /// Make The Payload Immutable And Shareable, Call By The Owner Before Handing It To Many Receivers;
+    /// The Header Of A Frozen Package Is Never Changed By The Router, It Forks One For Each Delivery
+    virtual void Freeze() {}
+
+    [[nodiscard]] virtual bool IsFrozen() const { return false; }
+
+    /// Copy The Header And Share The Frozen Payload Of The Other Without Copying,
+    /// False If The Implement Do Not Support Or The Other Is Not The Same Type
+    virtual bool ShareFrom(IPackage_Interface *other) { return false; }
 };
 
 template<class Type>
@@ -17,6 +17,9 @@ public:
     virtual awaitable<bool> Encode(IPackage_Interface *pkg) = 0;
     virtual awaitable<bool> Decode(IPackage_Interface *pkg) = 0;
 
+    /// Write The Prebuilt Frame As Is, Only The Stream Layer Like TLS Applies Per Connection
+    virtual awaitable<bool> WriteFrame(const AFrameBuffer &frame) = 0;
+
     virtual ATcpSocket &GetSocket() = 0;
 
     const ATcpSocket::executor_type &GetExecutor() {
@@ -30,7 +33,7 @@ class TPackageCodec : public IPackageCodec_Interface {
 
 public:
     awaitable<bool> Encode(IPackage_Interface *pkg) override {
-        if (auto temp = dynamic_cast<Type *>(pkg)) {
+        if (auto temp = TagCast<Type>(pkg)) {
             const auto ret = co_await this->EncodeT(temp);
             co_return ret;
         }
@@ -38,7 +41,7 @@ public:
     }
 
     awaitable<bool> Decode(IPackage_Interface *pkg) override {
-        if (auto temp = dynamic_cast<Type *>(pkg)) {
+        if (auto temp = TagCast<Type>(pkg)) {
             const auto ret = co_await this->DecodeT(temp);
             co_return ret;
         }
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Common.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+
+/**
+ * The Hops Of A Player Request Through The Actor Pipeline
+ */
+enum class ETraceHop : uint8_t {
+    READ,           // Decoded In UPlayerAgent::ReadPackage
+    ROUTE,          // Entered URouteModule::PostPackage
+    ENQUEUE,        // Sent To The Agent Channel
+    EXECUTE,        // Received From The Channel, Before IActorBase::OnPackage
+    HANDLED,        // IActorBase::OnPackage Returned
+    REPLY,          // The Reply Sent To UPlayerAgent::mOutput
+    WRITE,          // The Reply Encoded To The Socket
+    COUNT
+};
+
+/**
+ * The Timestamps Stamped Into The Package At Each Hop, Only For The Sampled Request.
+ * The Reply Built While Handling The Request Inherits Its Trace
+ */
+struct BASE_API FPackageTrace {
+    /** The Package ID Of The Request, Kept In The Reply **/
+    uint32_t packageID = 0;
+
+    bool bSampled = false;
+
+    /** Steady Clock In Nanoseconds, Zero For The Hop Not Passed **/
+    std::array<int64_t, static_cast<size_t>(ETraceHop::COUNT)> stamps{};
+
+    void Reset() {
+        packageID = 0;
+        bSampled = false;
+        stamps.fill(0);
+    }
+
+    void Stamp(const ETraceHop hop) {
+        stamps[static_cast<size_t>(hop)] = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    [[nodiscard]] int64_t GetStamp(const ETraceHop hop) const {
+        return stamps[static_cast<size_t>(hop)];
+    }
+};
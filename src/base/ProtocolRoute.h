@@ -3,6 +3,10 @@
 #include "Package.h"
 
 #include <unordered_map>
+#include <functional>
+#include <initializer_list>
+#include <concepts>
+#include <array>
 
 
 template<CPackageType Type, typename Functor>
@@ -30,3 +34,66 @@ public:
 private:
     std::unordered_map<uint32_t, Functor> mProtocolMap;
 };
+
+
+/**
+ * The Dense Dispatch Table Of The Plain Function Pointers, Indexed By ID - Begin;
+ * Built At Compile Time And Shared By All The Instances,
+ * The ID Out Of The Range Or Registered Twice Fails The Compilation
+ */
+template<CPackageType Type, uint32_t Begin, uint32_t End, class... Args>
+requires (Begin < End)
+class TProtocolTable final {
+
+public:
+    using AHandler = void (*)(uint32_t, Type *, Args...);
+
+    struct FEntry {
+        uint32_t id;
+        AHandler handler;
+    };
+
+    consteval TProtocolTable(const std::initializer_list<FEntry> entries)
+        : mHandlers{} {
+        for (const auto &[id, handler] : entries) {
+            if (id < Begin || id >= End)
+                throw "Protocol ID Out Of Range";
+
+            if (mHandlers[id - Begin] != nullptr)
+                throw "Protocol ID Registered Twice";
+
+            mHandlers[id - Begin] = handler;
+        }
+    }
+
+    /// Adapt The Typed Handler, The Package Decodes The Message Once And Shares It With All The Receivers
+    template<class Message, void (*Handler)(const Message &, Type *, Args...)>
+    requires requires (Type *pkg) { { pkg->template Decode<Message>() } -> std::convertible_to<const Message *>; }
+    static void Typed(uint32_t, Type *pkg, Args... args) {
+        if (const auto *message = pkg->template Decode<Message>()) {
+            Handler(*message, pkg, args...);
+        }
+    }
+
+    [[nodiscard]] constexpr bool Contains(const uint32_t id) const {
+        return id - Begin < End - Begin && mHandlers[id - Begin] != nullptr;
+    }
+
+    /// One Bounds Check Plus One Indirect Call, Return False If No Handler
+    bool OnReceivePackage(Type *pkg, Args... args) const {
+        // The ID Below Begin Wraps Around And Fails The Same Check
+        const uint32_t index = pkg->GetPackageID() - Begin;
+        if (index >= End - Begin)
+            return false;
+
+        const auto handler = mHandlers[index];
+        if (handler == nullptr)
+            return false;
+
+        handler(pkg->GetPackageID(), pkg, args...);
+        return true;
+    }
+
+private:
+    std::array<AHandler, End - Begin> mHandlers;
+};
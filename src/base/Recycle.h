@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "Common.h"
+#include "TypeTag.h"
 
 #include <concepts>
 #ifdef __linux__
@@ -30,11 +31,16 @@ protected:
     virtual void Clear() = 0;
 
 public:
+    static constexpr ATypeTag TYPE_TAG = type_tag::RECYCLE;
+
     IRecycle_Interface() = default;
     virtual ~IRecycle_Interface() = default;
 
     DISABLE_COPY_MOVE(IRecycle_Interface)
 
+    /** The Derived Class Overrides By DECLARE_TYPE_TAG */
+    [[nodiscard]] virtual bool HasTypeTag(const ATypeTag tag) const noexcept { return tag == TYPE_TAG; }
+
     /** Depth Copy Object Data */
     virtual bool CopyFrom(IRecycle_Interface *other);
 
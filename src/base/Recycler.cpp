@@ -1,9 +1,23 @@
 #include "Recycler.h"
+#include "monitor/Metrics.h"
 
 #include <cassert>
 #include <spdlog/spdlog.h>
 
 
+namespace {
+    UMetricGauge *RecyclerUsageGauge() {
+        static auto *gauge = UMetricsRegistry::Instance().GetGauge("uranus_recycler_usage", "The Elements Acquired From All The Recyclers");
+        return gauge;
+    }
+
+    UMetricGauge *RecyclerIdleGauge() {
+        static auto *gauge = UMetricsRegistry::Instance().GetGauge("uranus_recycler_idle", "The Elements Idle In All The Recyclers");
+        return gauge;
+    }
+}
+
+
 namespace detail {
     FControlBlock::FControlBlock(IRecyclerBase *pRecycler)
         : mRefCount(1),
@@ -126,6 +140,11 @@ IRecyclerBase::IRecyclerBase(asio::io_context &ctx)
 IRecyclerBase::~IRecyclerBase() {
     mShrinkTimer.cancel();
 
+    if (const auto usage = mUsage.load(); usage >= 0) {
+        RecyclerUsageGauge()->Sub(usage);
+        RecyclerIdleGauge()->Sub(static_cast<int64_t>(mQueue.size()));
+    }
+
     while (!mQueue.empty()) {
         auto *pNode = mQueue.front();
         mQueue.pop();
@@ -153,6 +172,8 @@ void IRecyclerBase::Initial(const size_t capacity) {
     }
 
     mUsage = 0;
+    RecyclerIdleGauge()->Add(static_cast<int64_t>(mQueue.size()));
+
     SPDLOG_TRACE("{} - Recycler Initial", __FUNCTION__);
 }
 
@@ -184,6 +205,9 @@ detail::IElementNodeBase *IRecyclerBase::AcquireNode() {
             mQueue.pop();
             mUsage.fetch_add(1, std::memory_order_relaxed);
 
+            RecyclerUsageGauge()->Add(1);
+            RecyclerIdleGauge()->Sub(1);
+
             pResult->OnAcquire();
             pResult->Get()->Initial();
 
@@ -199,8 +223,10 @@ detail::IElementNodeBase *IRecyclerBase::AcquireNode() {
     if (num <= 0)
         throw std::runtime_error("Recycler expand num equal zero");
 
-    // The Last One Directly Return
-    std::vector<detail::IElementNodeBase *> nodes(num - 1);
+    // The First One Directly Return, The Rest Push To The Queue
+    std::vector<detail::IElementNodeBase *> nodes;
+    nodes.reserve(num - 1);
+
     detail::IElementNodeBase *pResult = nullptr;
 
     while (num-- > 0) {
@@ -211,8 +237,7 @@ detail::IElementNodeBase *IRecyclerBase::AcquireNode() {
 
         pElem->Get()->OnCreate();
 
-        // If The Last One, As The Result
-        if (num == 1) {
+        if (pResult == nullptr) {
             pResult = pElem;
             continue;
         }
@@ -236,6 +261,9 @@ detail::IElementNodeBase *IRecyclerBase::AcquireNode() {
 
     mUsage.fetch_add(1, std::memory_order_relaxed);
 
+    RecyclerUsageGauge()->Add(1);
+    RecyclerIdleGauge()->Add(static_cast<int64_t>(nodes.size()));
+
     pResult->OnAcquire();
     pResult->Get()->Initial();
 
@@ -283,14 +311,19 @@ void IRecyclerBase::Shrink() {
 
     std::unique_lock lock(mMutex);
 
+    int64_t released = 0;
     while (num-- > 0 && !mQueue.empty()) {
         auto *pNode = mQueue.front();
         mQueue.pop();
 
         pNode->DestroyElement();
         pNode->Destroy();
+
+        ++released;
     }
 
+    RecyclerIdleGauge()->Sub(released);
+
     SPDLOG_TRACE("{:<20} - Recycler[{:p}] Shrink Finished",
         __FUNCTION__, static_cast<void *>(this));
 }
@@ -329,6 +362,9 @@ void IRecyclerBase::Recycle(detail::IElementNodeBase *pNode) {
     pNode->OnRecycle();
     mUsage.fetch_sub(1, std::memory_order_relaxed);
 
+    RecyclerUsageGauge()->Sub(1);
+    RecyclerIdleGauge()->Add(1);
+
     std::unique_lock lock(mMutex);
     mQueue.emplace(pNode);
 
@@ -338,11 +374,9 @@ void IRecyclerBase::Recycle(detail::IElementNodeBase *pNode) {
     if (bShrinking)
         return;
 
-    {
-        std::shared_lock localLock(mMutex);
-        if (const auto total = mQueue.size() + mUsage; total < mShrinkCount)
-            return;
-    }
+    // Already Hold The Unique Lock, Do Not Lock Again
+    if (const auto total = mQueue.size() + mUsage; total < mShrinkCount)
+        return;
 
     bShrinking = true;
     co_spawn(mCtx, [this]() mutable -> awaitable<void> {
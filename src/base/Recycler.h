@@ -62,14 +62,26 @@ namespace detail {
         [[nodiscard]] virtual IRecycle_Interface *Get() noexcept = 0;
         [[nodiscard]] virtual const IRecycle_Interface *Get() const noexcept = 0;
 
+        /// The Node Knows The Element Type, Resolve The Tag To The Address Of The Element As That Type
+        [[nodiscard]] virtual void *CastByTag(ATypeTag tag) noexcept = 0;
+
+        /// Cast By The Type Tag If Both Sides Are Tagged, Otherwise By dynamic_cast
         template<class Type>
         Type *GetT() noexcept {
-            return dynamic_cast<Type *>(Get());
+            if constexpr (std::is_convertible_v<IRecycle_Interface *, Type *>) {
+                return Get();
+            } else {
+                if constexpr (CTaggedType<Type>) {
+                    if (auto *pResult = CastByTag(Type::TYPE_TAG))
+                        return static_cast<Type *>(pResult);
+                }
+                return dynamic_cast<Type *>(Get());
+            }
         }
 
         template<class Type>
         const Type *GetT() const noexcept {
-            return dynamic_cast<const Type *>(Get());
+            return const_cast<IElementNodeBase *>(this)->GetT<Type>();
         }
 
         [[nodiscard]] IRecyclerBase *GetRecycler() const noexcept;
@@ -189,11 +201,12 @@ public:
     }
 
     template<class T>
-    [[nodiscard]] Type *GetT() const noexcept {
-        if constexpr (std::is_same_v<std::remove_extent_t<T>, ElementType>) {
+    [[nodiscard]] T *GetT() const noexcept {
+        if constexpr (std::is_convertible_v<ElementType *, T *>) {
             return mElement;
+        } else {
+            return mNode != nullptr ? mNode->template GetT<T>() : nullptr;
         }
-        return dynamic_cast<T *>(Get());
     }
 
     [[nodiscard]] bool IsValid() const noexcept {
@@ -211,7 +224,7 @@ public:
 
     template<class T>
     FRecycleHandle<T> CastTo() const noexcept {
-        if (auto *pElement = dynamic_cast<FRecycleHandle<T>::ElementType *>(mElement)) {
+        if (auto *pElement = GetT<typename FRecycleHandle<T>::ElementType>()) {
             return FRecycleHandle<T>{ *this, pElement };
         }
         return {};
@@ -387,6 +400,10 @@ namespace detail {
             return static_cast<const IRecycle_Interface *>(GetT());
         }
 
+        [[nodiscard]] void *CastByTag(const ATypeTag tag) noexcept override {
+            return type_tag::Resolve(GetT(), tag);
+        }
+
         void DestroyElement() noexcept override {
             (*GetT()).~Type();
         }
@@ -451,6 +468,10 @@ namespace detail {
             return static_cast<const IRecycle_Interface *>(mElement);
         }
 
+        [[nodiscard]] void *CastByTag(const ATypeTag tag) noexcept override {
+            return type_tag::Resolve(mElement, tag);
+        }
+
         template<typename T>
         T *GetT() noexcept {
             if constexpr (std::is_same_v<std::remove_extent_t<T>, ElementType>) {
@@ -16,14 +16,31 @@ USingleIOContextPool::~USingleIOContextPool() {
     }
 }
 
+void USingleIOContextPool::SetUpWatchdog(const std::string &name, const int interval, const int threshold) {
+    mWatchdog.SetPoolName(name);
+    mWatchdog.SetInterval(interval);
+    mWatchdog.SetThreshold(threshold);
+}
+
 void USingleIOContextPool::Start(const size_t capacity) {
+    // All The Threads Run The Same Context, One Slot Per Thread
+    size_t index = 0;
+    if (mWatchdog.IsEnabled()) {
+        index = mWatchdog.AddContext(mIOContext, capacity);
+    }
+
     mThreadList = std::vector<std::thread>(capacity);
-    for (auto &val: mThreadList) {
-        val = std::thread([this] {
+    for (size_t idx = 0; idx < capacity; ++idx) {
+        auto *slot = mWatchdog.GetSlot(index, idx);
+
+        mThreadList[idx] = std::thread([this, slot] {
+            UContextWatchdog::BindThread(slot);
             mIOContext.run();
         });
     }
 
+    mWatchdog.Start();
+
     asio::signal_set signals(mIOContext, SIGINT, SIGTERM);
     signals.async_wait([this](auto, auto) {
         mIOContext.stop();
@@ -31,6 +48,8 @@ void USingleIOContextPool::Start(const size_t capacity) {
 }
 
 void USingleIOContextPool::Stop() {
+    mWatchdog.Stop();
+
     if (mIOContext.stopped())
         return;
 
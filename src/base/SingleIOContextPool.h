@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Common.h"
+#include "ContextWatchdog.h"
 
 #include <asio/io_context.hpp>
 #include <vector>
@@ -14,6 +15,9 @@ public:
 
     DISABLE_COPY_MOVE(USingleIOContextPool);
 
+    /// Enable The Stall Detector, Call Before Start
+    void SetUpWatchdog(const std::string &name, int interval, int threshold);
+
     void Start(size_t capacity = 4);
     void Stop();
 
@@ -23,6 +27,8 @@ private:
     asio::io_context mIOContext;
     asio::executor_work_guard<asio::io_context::executor_type> mGuard;
     std::vector<std::thread> mThreadList;
+
+    UContextWatchdog mWatchdog;
 };
 
 
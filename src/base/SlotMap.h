@@ -0,0 +1,248 @@
+#pragma once
+
+#include "Common.h"
+
+#include <functional>
+#include <stdexcept>
+#include <optional>
+#include <vector>
+
+
+/**
+ * The Handle Of The Element In TSlotMap, The Slot Index And Its Generation;
+ * The Generation Is Bumped When The Slot Is Erased, So The Stale Handle Finds Nothing
+ */
+struct BASE_API FSlotHandle final {
+
+    static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+    /** The Generation Keeps 31 Bits, The Packed ID Stays Positive **/
+    static constexpr uint32_t GENERATION_MASK = 0x7FFFFFFF;
+
+    /** The Compact ID Fits The 32 Bits Source And Target Of The Package, 20 Bits Index And 11 Bits Generation **/
+    static constexpr uint32_t COMPACT_INDEX_BITS = 20;
+    static constexpr uint32_t COMPACT_INDEX_LIMIT = (1 << COMPACT_INDEX_BITS) - 1;
+    static constexpr uint32_t COMPACT_GENERATION_MASK = 0x7FF;
+
+    uint32_t index = INVALID_INDEX;
+    uint32_t generation = 0;
+
+    [[nodiscard]] constexpr bool IsValid() const {
+        return index != INVALID_INDEX;
+    }
+
+    /// Pack Into A Positive Integer, Zero For The Invalid Handle
+    [[nodiscard]] constexpr int64_t ToID() const {
+        if (!IsValid())
+            return 0;
+        return static_cast<int64_t>(generation & GENERATION_MASK) << 32 | (static_cast<int64_t>(index) + 1);
+    }
+
+    static constexpr FSlotHandle FromID(const int64_t id) {
+        if (id <= 0 || (id & 0xFFFFFFFF) == 0)
+            return {};
+        return { static_cast<uint32_t>(id & 0xFFFFFFFF) - 1, static_cast<uint32_t>(id >> 32) };
+    }
+
+    /// Pack Into A Positive 32 Bits Integer, Zero For The Invalid Handle Or The Index Out Of Range;
+    /// Only For The Slot Map Created With COMPACT_GENERATION_MASK
+    [[nodiscard]] constexpr int64_t ToCompactID() const {
+        if (!IsValid() || index >= COMPACT_INDEX_LIMIT)
+            return 0;
+        return static_cast<int64_t>(generation & COMPACT_GENERATION_MASK) << COMPACT_INDEX_BITS | (static_cast<int64_t>(index) + 1);
+    }
+
+    static constexpr FSlotHandle FromCompactID(const int64_t id) {
+        if (id <= 0 || id > INT32_MAX || (id & COMPACT_INDEX_LIMIT) == 0)
+            return {};
+        return { static_cast<uint32_t>(id & COMPACT_INDEX_LIMIT) - 1, static_cast<uint32_t>(id >> COMPACT_INDEX_BITS) };
+    }
+
+    constexpr bool operator==(const FSlotHandle &rhs) const = default;
+};
+
+
+/**
+ * The Generational Slot Map, The Elements Are Stored In A Dense Array;
+ * Looking Up By The Handle Is An Array Index Plus A Generation Compare,
+ * The Erased Slots Are Linked In The Free List And Reused First.
+ * Not Thread Safe, Guard It With The Mutex Of The Owner
+ */
+template<class Type>
+class TSlotMap final {
+
+    struct FSlot {
+        std::optional<Type> value;
+        uint32_t generation = 0;
+        uint32_t nextFree = FSlotHandle::INVALID_INDEX;
+    };
+
+public:
+    /// The Generation Wraps Around Inside The Mask, Narrow It For The Compact ID
+    explicit TSlotMap(const uint32_t generationMask = FSlotHandle::GENERATION_MASK)
+        : mGenerationMask(generationMask),
+          mFreeHead(FSlotHandle::INVALID_INDEX),
+          mSize(0) {
+    }
+
+    template<class... Args>
+    FSlotHandle Emplace(Args &&... args);
+
+    FSlotHandle Insert(Type value) {
+        return Emplace(std::move(value));
+    }
+
+    /// Null If The Handle Is Stale
+    [[nodiscard]] Type *Find(FSlotHandle handle);
+    [[nodiscard]] const Type *Find(FSlotHandle handle) const;
+
+    /// The Current Handle Of The Occupied Slot, Invalid If The Slot Is Free
+    [[nodiscard]] FSlotHandle GetHandle(uint32_t index) const;
+
+    [[nodiscard]] bool Contains(const FSlotHandle handle) const {
+        return Find(handle) != nullptr;
+    }
+
+    /// Return False If The Handle Is Stale
+    bool Erase(FSlotHandle handle);
+
+    /// Erase All, The Handles Taken Before Are All Stale
+    void Clear();
+
+    [[nodiscard]] size_t Size() const {
+        return mSize;
+    }
+
+    [[nodiscard]] bool IsEmpty() const {
+        return mSize == 0;
+    }
+
+    /// Visit All The Elements In Slot Order, Stop If The Functor Returns False
+    template<class Functor>
+    void Foreach(Functor &&func);
+
+    template<class Functor>
+    void Foreach(Functor &&func) const;
+
+private:
+    std::vector<FSlot> mSlots;
+    const uint32_t mGenerationMask;
+    uint32_t mFreeHead;
+    size_t mSize;
+};
+
+
+template<class Type>
+template<class ... Args>
+FSlotHandle TSlotMap<Type>::Emplace(Args &&...args) {
+    uint32_t index;
+
+    if (mFreeHead != FSlotHandle::INVALID_INDEX) {
+        index = mFreeHead;
+        mFreeHead = mSlots[index].nextFree;
+    } else {
+        if (mSlots.size() >= FSlotHandle::INVALID_INDEX - 1)
+            throw std::length_error("TSlotMap::Emplace - Slot Exhausted");
+
+        index = static_cast<uint32_t>(mSlots.size());
+        mSlots.emplace_back();
+    }
+
+    auto &slot = mSlots[index];
+    slot.value.emplace(std::forward<Args>(args)...);
+    slot.nextFree = FSlotHandle::INVALID_INDEX;
+
+    ++mSize;
+    return { index, slot.generation };
+}
+
+template<class Type>
+Type *TSlotMap<Type>::Find(const FSlotHandle handle) {
+    if (handle.index >= mSlots.size())
+        return nullptr;
+
+    auto &slot = mSlots[handle.index];
+    if (slot.generation != handle.generation || !slot.value.has_value())
+        return nullptr;
+
+    return &slot.value.value();
+}
+
+template<class Type>
+const Type *TSlotMap<Type>::Find(const FSlotHandle handle) const {
+    if (handle.index >= mSlots.size())
+        return nullptr;
+
+    const auto &slot = mSlots[handle.index];
+    if (slot.generation != handle.generation || !slot.value.has_value())
+        return nullptr;
+
+    return &slot.value.value();
+}
+
+template<class Type>
+FSlotHandle TSlotMap<Type>::GetHandle(const uint32_t index) const {
+    if (index >= mSlots.size() || !mSlots[index].value.has_value())
+        return {};
+
+    return { index, mSlots[index].generation };
+}
+
+template<class Type>
+bool TSlotMap<Type>::Erase(const FSlotHandle handle) {
+    if (Find(handle) == nullptr)
+        return false;
+
+    auto &slot = mSlots[handle.index];
+    slot.value.reset();
+    slot.generation = (slot.generation + 1) & mGenerationMask;
+
+    slot.nextFree = mFreeHead;
+    mFreeHead = handle.index;
+
+    --mSize;
+    return true;
+}
+
+template<class Type>
+void TSlotMap<Type>::Clear() {
+    for (uint32_t index = 0; index < mSlots.size(); ++index) {
+        if (mSlots[index].value.has_value()) {
+            Erase({ index, mSlots[index].generation });
+        }
+    }
+}
+
+template<class Type>
+template<class Functor>
+void TSlotMap<Type>::Foreach(Functor &&func) {
+    for (uint32_t index = 0; index < mSlots.size(); ++index) {
+        auto &slot = mSlots[index];
+        if (!slot.value.has_value())
+            continue;
+
+        if constexpr (std::is_same_v<std::invoke_result_t<Functor, FSlotHandle, Type &>, bool>) {
+            if (!std::invoke(func, FSlotHandle{ index, slot.generation }, slot.value.value()))
+                return;
+        } else {
+            std::invoke(func, FSlotHandle{ index, slot.generation }, slot.value.value());
+        }
+    }
+}
+
+template<class Type>
+template<class Functor>
+void TSlotMap<Type>::Foreach(Functor &&func) const {
+    for (uint32_t index = 0; index < mSlots.size(); ++index) {
+        const auto &slot = mSlots[index];
+        if (!slot.value.has_value())
+            continue;
+
+        if constexpr (std::is_same_v<std::invoke_result_t<Functor, FSlotHandle, const Type &>, bool>) {
+            if (!std::invoke(func, FSlotHandle{ index, slot.generation }, slot.value.value()))
+                return;
+        } else {
+            std::invoke(func, FSlotHandle{ index, slot.generation }, slot.value.value());
+        }
+    }
+}
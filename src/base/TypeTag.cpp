@@ -0,0 +1,42 @@
+#include "TypeTag.h"
+
+#include <spdlog/spdlog.h>
+
+#include <unordered_map>
+#include <string>
+#include <atomic>
+#include <mutex>
+
+
+namespace {
+    std::atomic_size_t gConflictCount{0};
+}
+
+
+bool type_tag::Register(const ATypeTag tag, const char *name) {
+    static std::mutex mutex;
+
+    // The Roots Declare Their Tags By Hand
+    static std::unordered_map<ATypeTag, std::string> registry = {
+        { RECYCLE, "IRecycle_Interface" },
+        { PACKAGE, "IPackage_Interface" },
+        { ACTOR,   "IActorBase" },
+        { AGENT,   "IAgentBase" },
+    };
+
+    std::unique_lock lock(mutex);
+
+    // The Same Class Is Registered Again By Each Library Including It;
+    // Never Throw, It Runs In The Static Initializer Of The Library Being Loaded
+    if (const auto [iter, bInserted] = registry.try_emplace(tag, name); !bInserted && iter->second != name) {
+        SPDLOG_CRITICAL("{} - Type Tag[{}] Of {} Already Declared By {}", __FUNCTION__, tag, name, iter->second);
+        gConflictCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    return true;
+}
+
+size_t type_tag::GetConflictCount() {
+    return gConflictCount.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "Common.h"
+
+#include <type_traits>
+#include <concepts>
+#include <cstdint>
+
+
+/**
+ * The Integer ID Of The Class Taking Part In The Per Message Dispatch, Replaces dynamic_cast There;
+ * The Class Declares Its Own TYPE_TAG And The Tagged Bases It Derives From,
+ * The Check Is A Few Integer Compares And The Cast After It Is A static_cast
+ */
+using ATypeTag = uint32_t;
+
+namespace type_tag {
+    inline constexpr ATypeTag RECYCLE       = 1;
+    inline constexpr ATypeTag PACKAGE       = 2;
+    inline constexpr ATypeTag PACKET        = 3;
+    inline constexpr ATypeTag ACTOR         = 4;
+    inline constexpr ATypeTag SERVICE       = 5;
+    inline constexpr ATypeTag PLAYER        = 6;
+    inline constexpr ATypeTag AGENT         = 7;
+    inline constexpr ATypeTag PLAYER_AGENT  = 8;
+    inline constexpr ATypeTag SERVICE_AGENT = 9;
+
+    /** The Classes Of The Game Count Up From Here, Each One Must Be Unique, Checked When Its Library Loaded **/
+    inline constexpr ATypeTag USER          = 1024;
+
+    /// Record The Tag Declared By The Class, Log And Return False If Another Class Declared It;
+    /// The Roots Are Recorded Inside
+    BASE_API bool Register(ATypeTag tag, const char *name);
+
+    /// The Count Of The Conflicts Found So Far, The Loader Compares It Around Loading A Library To Refuse It
+    BASE_API size_t GetConflictCount();
+
+    /// Initialized At Start Up, Referenced By HasTypeTag; Not A Member, So It Stays Out Of The DLL Interface
+    template<class Type>
+    inline const bool bRegistered = Register(Type::TYPE_TAG, Type::TYPE_NAME);
+}
+
+/** The List Of The Tagged Direct Bases, Each One Declares Its Own **/
+template<class... Bases>
+struct TTaggedBases {
+};
+
+/// The Tag Must Be Declared By The Class Itself, The One Inherited From The Base Does Not Count
+template<class Type>
+concept CTaggedType = requires {
+    { std::remove_cv_t<Type>::TYPE_TAG } -> std::convertible_to<ATypeTag>;
+    requires std::is_same_v<decltype(&std::remove_cv_t<Type>::HasTypeTag), bool (std::remove_cv_t<Type>::*)(ATypeTag) const noexcept>;
+};
+
+
+namespace type_tag {
+    template<class Type>
+    constexpr bool IsTagOf(ATypeTag tag) noexcept;
+
+    template<class... Bases>
+    constexpr bool IsTagOfAny(const ATypeTag tag, TTaggedBases<Bases...>) noexcept {
+        return (IsTagOf<Bases>(tag) || ...);
+    }
+
+    /// True If The Tag Is Of The Type Or Any Of Its Tagged Bases
+    template<class Type>
+    constexpr bool IsTagOf(const ATypeTag tag) noexcept {
+        if (tag == Type::TYPE_TAG)
+            return true;
+
+        if constexpr (requires { typename Type::ATaggedBases; }) {
+            return IsTagOfAny(tag, typename Type::ATaggedBases{});
+        }
+        return false;
+    }
+
+    template<class Type>
+    void *Resolve(Type *obj, ATypeTag tag) noexcept;
+
+    template<class Type, class... Bases>
+    void *ResolveAny(Type *obj, const ATypeTag tag, TTaggedBases<Bases...>) noexcept {
+        void *result = nullptr;
+        (void)((result = Resolve<Bases>(static_cast<Bases *>(obj), tag), result != nullptr) || ...);
+        return result;
+    }
+
+    /// The Address Of The Object As The Tagged Type, Also Crossing To The Other Base; Null If Not One
+    template<class Type>
+    void *Resolve(Type *obj, const ATypeTag tag) noexcept {
+        if constexpr (CTaggedType<Type>) {
+            if (tag == Type::TYPE_TAG)
+                return obj;
+
+            if constexpr (requires { typename Type::ATaggedBases; }) {
+                return ResolveAny(obj, tag, typename Type::ATaggedBases{});
+            }
+        }
+        return nullptr;
+    }
+}
+
+
+/**
+ * Declare The Tag In The Public Section Of The Class Under A Tagged Root Like IActorBase Or IPackage_Interface,
+ * Together With Its Tagged Direct Bases; The Root Declares TYPE_TAG And The Virtual HasTypeTag By Hand.
+ * The Tag Is Registered At Start Up, Two Classes With The Same Tag Would Make TagCast Return The Wrong One,
+ * So The Library Declaring The Conflict Is Refused By Its Loader
+ */
+#define DECLARE_TYPE_TAG(type, tag, ...) \
+    static constexpr ATypeTag TYPE_TAG = tag; \
+    static constexpr const char *TYPE_NAME = #type; \
+    using ATaggedBases = TTaggedBases<__VA_ARGS__>; \
+    [[nodiscard]] bool HasTypeTag(const ATypeTag other) const noexcept override { \
+        (void)type_tag::bRegistered<type>; \
+        return type_tag::IsTagOf<type>(other); \
+    }
+
+
+/**
+ * Cast Down From The Tagged Root By The Tag, Or Up Implicitly;
+ * Fall Back To dynamic_cast If The Type Is Not Tagged Or Not Reachable By static_cast
+ */
+template<class Type, class Base>
+Type *TagCast(Base *ptr) noexcept {
+    if constexpr (std::is_convertible_v<Base *, Type *>) {
+        return ptr;
+    } else if constexpr (CTaggedType<Type> && std::derived_from<Type, Base> && requires { ptr->HasTypeTag(ATypeTag{}); }) {
+        return ptr != nullptr && ptr->HasTypeTag(Type::TYPE_TAG) ? static_cast<Type *>(ptr) : nullptr;
+    } else {
+        return dynamic_cast<Type *>(ptr);
+    }
+}
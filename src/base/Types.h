@@ -4,6 +4,8 @@
 #include <asio/experimental/channel.hpp>
 #include <asio/experimental/concurrent_channel.hpp>
 #include <chrono>
+#include <memory>
+#include <vector>
 
 
 using DefaultToken = asio::as_tuple_t<asio::use_awaitable_t<>>;
@@ -33,3 +35,6 @@ using TChannel = DefaultToken::as_default_on_t<asio::experimental::channel<T>>;
 template<typename T>
 using TConcurrentChannel = DefaultToken::as_default_on_t<asio::experimental::concurrent_channel<T>>;
 
+/** The Package Framed In Wire Order, Built Once And Shared Read-Only By All The Connections It Is Written To **/
+using AFrameBuffer = std::shared_ptr<const std::vector<uint8_t>>;
+
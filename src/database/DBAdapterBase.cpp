@@ -1,6 +1,7 @@
 #include "DBAdapterBase.h"
 
 #include "DataAccess.h"
+#include "DBTaskBase.h"
 
 IDBAdapterBase::IDBAdapterBase()
     : mDataAccess(nullptr) {
@@ -23,8 +24,25 @@ void IDBAdapterBase::Initial(const IDataAsset_Interface *data) {
 void IDBAdapterBase::Stop() {
 }
 
-void IDBAdapterBase::PushTask(std::unique_ptr<IDBTaskBase> &&task) const {
+void IDBAdapterBase::ExecuteBatch(IDBContext_Interface *context, std::vector<std::unique_ptr<IDBTaskBase>> &tasks) {
+    for (const auto &task : tasks) {
+        if (task != nullptr) {
+            task->Execute(context);
+        }
+    }
+}
+
+std::unique_ptr<IDBTaskBase> IDBAdapterBase::CreateSaveTask(const std::string &col, const std::string &key, std::string doc) {
+    return nullptr;
+}
+
+std::unique_ptr<IDBTaskBase> IDBAdapterBase::CreateLoadTask(const std::string &col, const std::string &key, ADBLoadCallback &&callback) {
+    return nullptr;
+}
+
+bool IDBAdapterBase::PushTask(std::unique_ptr<IDBTaskBase> &&task) const {
     if (mDataAccess) {
-        mDataAccess->PushTask(std::move(task));
+        return mDataAccess->PushTask(std::move(task));
     }
+    return false;
 }
@@ -1,13 +1,28 @@
 #pragma once
 
 #include "Common.h"
+#include "DBTaskBase.h"
 
+#include <functional>
+#include <optional>
 #include <memory>
+#include <vector>
+#include <type_traits>
+#include <asio.hpp>
 
 class IDataAsset_Interface;
 struct IDBContext_Interface;
 class UDataAccess;
-class IDBTaskBase;
+
+/** Tell The Missing Document From The Failed Read, The Failure Must Never Be Taken As The New One **/
+enum class EDBLoadStatus : uint8_t {
+    FOUND,
+    NOT_FOUND,
+    FAILED
+};
+
+/** The Document Is Only Set With FOUND **/
+using ADBLoadCallback = std::function<void(EDBLoadStatus, std::string)>;
 
 class BASE_API IDBAdapterBase {
 
@@ -28,6 +43,62 @@ public:
 
     virtual IDBContext_Interface *AcquireContext() = 0;
 
+    /**
+     * Execute The Buffered Tasks Of The Same Database And Collection,
+     * The Default Implement Executes Them One By One In Order,
+     * Override This To Use The Native Bulk Operation Of The Database
+     */
+    virtual void ExecuteBatch(IDBContext_Interface *context, std::vector<std::unique_ptr<IDBTaskBase>> &tasks);
+
+    /// Create The Batchable Task To Upsert One Document By Key, Return Null If The Adapter Not Support
+    [[nodiscard]] virtual std::unique_ptr<IDBTaskBase> CreateSaveTask(const std::string &col, const std::string &key, std::string doc);
+
+    /// Create The Task To Read One Document By Key, The Callback Is Invoked In The Worker Thread;
+    /// Return Null If The Adapter Not Support
+    [[nodiscard]] virtual std::unique_ptr<IDBTaskBase> CreateLoadTask(const std::string &col, const std::string &key, ADBLoadCallback &&callback);
+
+    /**
+     * Create The Task By The Factory With A Completion Callback And Push It,
+     * The Handler Will Be Resumed On Its Own Associated Executor With The Result.
+     * The Factory Is Called As std::unique_ptr<IDBTaskBase>(Callback &&), And The Task Must Invoke
+     * The Callback Exactly Once, Also When Executed With Null Context Which Means Failure;
+     * The Factory Returning Null Must Leave The Callback Untouched, The Handler Is Completed With Result{}
+     */
+    template<class Result, class Factory, asio::completion_token_for<void(Result)> CompletionToken>
+    auto PushTaskAsync(Factory &&factory, CompletionToken &&token);
+
 protected:
-    void PushTask(std::unique_ptr<IDBTaskBase> &&task) const;
-};
\ No newline at end of file
+    /// Return False If The Task Was Not Accepted, Then The Task Is Not Moved
+    bool PushTask(std::unique_ptr<IDBTaskBase> &&task) const;
+};
+
+
+template<class Result, class Factory, asio::completion_token_for<void(Result)> CompletionToken>
+inline auto IDBAdapterBase::PushTaskAsync(Factory &&factory, CompletionToken &&token) {
+    static_assert(std::is_default_constructible_v<Result>, "The Default Result Means Failure");
+
+    auto init = [this](asio::completion_handler_for<void(Result)> auto handler, auto func) {
+        auto work = asio::make_work_guard(handler);
+
+        auto callback = [handler = std::move(handler), work = std::move(work)](Result result) mutable {
+            auto alloc = asio::get_associated_allocator(handler, asio::recycling_allocator<void>());
+            asio::dispatch(work.get_executor(), asio::bind_allocator(alloc, [handler = std::move(handler), result = std::move(result)]() mutable {
+                std::move(handler)(std::move(result));
+            }));
+        };
+
+        // The Factory Only Takes The Callback Into The Task It Creates
+        std::unique_ptr<IDBTaskBase> task = std::invoke(func, std::move(callback));
+        if (task == nullptr) {
+            std::invoke(callback, Result{});
+            return;
+        }
+
+        // Not Accepted, Execute With Null Context To Complete The Handler With Failure
+        if (!this->PushTask(std::move(task))) {
+            task->Execute(nullptr);
+        }
+    };
+
+    return asio::async_initiate<CompletionToken, void(Result)>(init, token, std::forward<Factory>(factory));
+}
\ No newline at end of file
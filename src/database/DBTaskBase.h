@@ -14,6 +14,9 @@ protected:
     std::string mDatabase;
     std::string mCollection;
 
+    int64_t mShardKey = 0;
+    bool bShardKey = false;
+
 public:
     IDBTaskBase() = default;
     virtual ~IDBTaskBase() = default;
@@ -31,6 +34,22 @@ public:
     void SetCollection(const std::string &collection) { mCollection = collection; }
     [[nodiscard]] const std::string &GetCollectionName() const { return mCollection; }
 
+    /// The Tasks With The Same Shard Key Will Be Executed By The Same Worker In Order,
+    /// Usually Use The Player ID
+    void SetShardKey(const int64_t key) { mShardKey = key; bShardKey = true; }
+    [[nodiscard]] int64_t GetShardKey() const { return mShardKey; }
+    [[nodiscard]] bool HasShardKey() const { return bShardKey; }
+
+    /// Return True If The Task Can Be Buffered And Grouped Into A Bulk Operation Of Its Collection
+    [[nodiscard]] virtual bool IsBatchable() const { return false; }
+
+    /// Return The Key Of The Single Document The Task Writes Or Reads, Routes It To The Worker Of The Document;
+    /// The Buffered Writes With Same Key In One Collection Will Be Coalesced And Only The Latest Executed
+    [[nodiscard]] virtual std::string GetDocumentKey() const { return {}; }
+
+    /// Called When The Task Was Replaced By A Later Task With Same Document Key And Will Never Be Executed
+    virtual void OnCoalesced() {}
+
     virtual void Execute(IDBContext_Interface *context) = 0;
 };
 
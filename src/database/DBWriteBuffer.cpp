@@ -0,0 +1,250 @@
+#include "DBWriteBuffer.h"
+#include "DBAdapterBase.h"
+
+#include <spdlog/spdlog.h>
+
+
+inline constexpr size_t DEFAULT_BATCH_SIZE = 64;
+inline constexpr int DEFAULT_FLUSH_INTERVAL = 200;
+
+
+UDBBatchTask::UDBBatchTask(
+    IDBAdapterBase *adapter,
+    UDBWriteBuffer *owner,
+    std::string db,
+    std::string col,
+    std::vector<std::unique_ptr<IDBTaskBase>> &&tasks,
+    const ASteadyTimePoint first)
+    : IDBTaskBase(std::move(db), std::move(col)),
+      mAdapter(adapter),
+      mOwner(owner),
+      mFirstTime(first),
+      mTaskList(std::move(tasks)) {
+}
+
+size_t UDBBatchTask::GetTaskCount() const {
+    return mTaskList.size();
+}
+
+void UDBBatchTask::Execute(IDBContext_Interface *context) {
+    if (mAdapter == nullptr || mTaskList.empty())
+        return;
+
+    const auto begin = std::chrono::steady_clock::now();
+    mAdapter->ExecuteBatch(context, mTaskList);
+    const auto end = std::chrono::steady_clock::now();
+
+    if (mOwner != nullptr) {
+        mOwner->RecordFlush(mTaskList.size(), end - mFirstTime, end - begin);
+    }
+}
+
+UDBWriteBuffer::UDBWriteBuffer()
+    : mAdapter(nullptr),
+      mBatchSize(DEFAULT_BATCH_SIZE),
+      mFlushInterval(std::chrono::milliseconds(DEFAULT_FLUSH_INTERVAL)),
+      mPendingCount(0),
+      mTotalLatency(0) {
+}
+
+UDBWriteBuffer::~UDBWriteBuffer() {
+}
+
+void UDBWriteBuffer::SetUpAdapter(IDBAdapterBase *adapter) {
+    mAdapter = adapter;
+}
+
+void UDBWriteBuffer::SetBatchSize(const size_t size) {
+    mBatchSize = size > 0 ? size : 1;
+}
+
+size_t UDBWriteBuffer::GetBatchSize() const {
+    return mBatchSize;
+}
+
+void UDBWriteBuffer::SetFlushInterval(const ASteadyDuration interval) {
+    mFlushInterval = interval;
+}
+
+ASteadyDuration UDBWriteBuffer::GetFlushInterval() const {
+    return mFlushInterval;
+}
+
+std::unique_ptr<IDBTaskBase> UDBWriteBuffer::Push(std::unique_ptr<IDBTaskBase> &&task) {
+    if (task == nullptr)
+        return nullptr;
+
+    // The Task Replaced By The New One, Notify It Out Of The Lock
+    std::unique_ptr<IDBTaskBase> coalesced;
+    std::unique_ptr<IDBTaskBase> batch;
+
+    {
+        std::unique_lock lock(mMutex);
+
+        ACollectionKey key{ task->GetDatabaseName(), task->GetCollectionName() };
+        auto &node = mCollectionMap[key];
+
+        if (node.tasks.empty()) {
+            node.firstTime = std::chrono::steady_clock::now();
+        }
+
+        // Coalesce With The Buffered Task Of The Same Document
+        if (auto docKey = task->GetDocumentKey(); !docKey.empty()) {
+            if (const auto iter = node.keyIndex.find(docKey); iter != node.keyIndex.end()) {
+                coalesced = std::move(node.tasks[iter->second]);
+                node.tasks[iter->second] = std::move(task);
+            } else {
+                node.keyIndex.emplace(std::move(docKey), node.tasks.size());
+                node.tasks.emplace_back(std::move(task));
+                ++mPendingCount;
+            }
+        } else {
+            node.tasks.emplace_back(std::move(task));
+            ++mPendingCount;
+        }
+
+        // Reach The Batch Size, Pack It Directly
+        if (node.tasks.size() >= mBatchSize) {
+            batch = PackCollection(key, node);
+            mCollectionMap.erase(key);
+        }
+    }
+
+    if (coalesced != nullptr) {
+        coalesced->OnCoalesced();
+
+        std::unique_lock lock(mStatsMutex);
+        ++mStats.coalescedCount;
+    }
+
+    return batch;
+}
+
+std::vector<std::unique_ptr<IDBTaskBase>> UDBWriteBuffer::Collect(const ASteadyTimePoint now) {
+    std::vector<std::unique_ptr<IDBTaskBase>> result;
+
+    std::unique_lock lock(mMutex);
+    for (auto iter = mCollectionMap.begin(); iter != mCollectionMap.end();) {
+        if (iter->second.tasks.empty() || now - iter->second.firstTime >= mFlushInterval) {
+            if (auto batch = PackCollection(iter->first, iter->second)) {
+                result.emplace_back(std::move(batch));
+            }
+            mCollectionMap.erase(iter++);
+            continue;
+        }
+        ++iter;
+    }
+
+    return result;
+}
+
+std::unique_ptr<IDBTaskBase> UDBWriteBuffer::CollectCollection(const std::string &db, const std::string &col) {
+    const ACollectionKey key{ db, col };
+
+    std::unique_lock lock(mMutex);
+    const auto iter = mCollectionMap.find(key);
+    if (iter == mCollectionMap.end())
+        return nullptr;
+
+    auto batch = PackCollection(iter->first, iter->second);
+    mCollectionMap.erase(iter);
+
+    return batch;
+}
+
+std::unique_ptr<IDBTaskBase> UDBWriteBuffer::CollectDocument(const std::string &db, const std::string &col, const std::string &key) {
+    const ACollectionKey colKey{ db, col };
+
+    std::unique_lock lock(mMutex);
+    const auto iter = mCollectionMap.find(colKey);
+    if (iter == mCollectionMap.end())
+        return nullptr;
+
+    auto &node = iter->second;
+
+    const auto docIter = node.keyIndex.find(key);
+    if (docIter == node.keyIndex.end())
+        return nullptr;
+
+    const auto index = docIter->second;
+    node.keyIndex.erase(docIter);
+
+    std::vector<std::unique_ptr<IDBTaskBase>> tasks;
+    tasks.emplace_back(std::move(node.tasks[index]));
+    node.tasks.erase(node.tasks.begin() + static_cast<ptrdiff_t>(index));
+
+    // The Tasks Behind It Move Forward
+    for (auto &[docKey, pos] : node.keyIndex) {
+        if (pos > index) {
+            --pos;
+        }
+    }
+
+    --mPendingCount;
+
+    auto batch = std::make_unique<UDBBatchTask>(mAdapter, this, db, col, std::move(tasks), node.firstTime);
+
+    if (node.tasks.empty()) {
+        mCollectionMap.erase(iter);
+    }
+
+    return batch;
+}
+
+std::vector<std::unique_ptr<IDBTaskBase>> UDBWriteBuffer::CollectAll() {
+    std::vector<std::unique_ptr<IDBTaskBase>> result;
+
+    std::unique_lock lock(mMutex);
+    for (auto &[key, node] : mCollectionMap) {
+        if (auto batch = PackCollection(key, node)) {
+            result.emplace_back(std::move(batch));
+        }
+    }
+    mCollectionMap.clear();
+
+    return result;
+}
+
+size_t UDBWriteBuffer::GetPendingCount() const {
+    std::unique_lock lock(mMutex);
+    return mPendingCount;
+}
+
+FDBFlushStats UDBWriteBuffer::GetFlushStats() const {
+    std::unique_lock lock(mStatsMutex);
+    return mStats;
+}
+
+std::unique_ptr<IDBTaskBase> UDBWriteBuffer::PackCollection(const ACollectionKey &key, FCollectionNode &node) {
+    if (node.tasks.empty())
+        return nullptr;
+
+    mPendingCount -= node.tasks.size();
+
+    return std::make_unique<UDBBatchTask>(
+        mAdapter, this,
+        key.first, key.second,
+        std::move(node.tasks),
+        node.firstTime);
+}
+
+void UDBWriteBuffer::RecordFlush(const size_t count, const ASteadyDuration latency, const ASteadyDuration execute) {
+    const auto latencyUs = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    const auto executeUs = std::chrono::duration_cast<std::chrono::microseconds>(execute).count();
+
+    std::unique_lock lock(mStatsMutex);
+
+    ++mStats.flushCount;
+    mStats.taskCount += count;
+
+    mStats.lastLatency = latencyUs;
+    mStats.maxLatency = std::max(mStats.maxLatency, latencyUs);
+
+    mTotalLatency += latencyUs;
+    mStats.averageLatency = mTotalLatency / static_cast<int64_t>(mStats.flushCount);
+
+    mStats.lastExecute = executeUs;
+    mStats.maxExecute = std::max(mStats.maxExecute, executeUs);
+
+    SPDLOG_TRACE("{} - Flush {} Tasks, Latency[{}us], Execute[{}us]", __FUNCTION__, count, latencyUs, executeUs);
+}
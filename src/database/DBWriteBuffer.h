@@ -0,0 +1,134 @@
+#pragma once
+
+#include "DBTaskBase.h"
+#include "base/Types.h"
+
+#include <absl/container/flat_hash_map.h>
+#include <memory>
+#include <vector>
+#include <mutex>
+
+
+class IDBAdapterBase;
+class UDBWriteBuffer;
+
+
+/**
+ * The Flush Statistic Of The Write Buffer,
+ * The Latency Is From The First Task Buffered To The Batch Executed,
+ * All The Durations Are In Microsecond
+ */
+struct BASE_API FDBFlushStats {
+    uint64_t flushCount     = 0;
+    uint64_t taskCount      = 0;
+    uint64_t coalescedCount = 0;
+
+    int64_t lastLatency     = 0;
+    int64_t maxLatency      = 0;
+    int64_t averageLatency  = 0;
+
+    int64_t lastExecute     = 0;
+    int64_t maxExecute      = 0;
+};
+
+/**
+ * The Bulk Operation Of The Tasks With The Same Database And Collection,
+ * Executed By The Adapter In The Worker Thread
+ */
+class BASE_API UDBBatchTask final : public IDBTaskBase {
+
+    /** The Adapter To Execute The Bulk Operation **/
+    IDBAdapterBase *mAdapter;
+
+    /** The Owner Buffer To Record Statistic **/
+    UDBWriteBuffer *mOwner;
+
+    /** The Time Point Of The First Task Buffered **/
+    ASteadyTimePoint mFirstTime;
+
+    std::vector<std::unique_ptr<IDBTaskBase>> mTaskList;
+
+public:
+    UDBBatchTask() = delete;
+
+    UDBBatchTask(IDBAdapterBase *adapter, UDBWriteBuffer *owner, std::string db, std::string col,
+                 std::vector<std::unique_ptr<IDBTaskBase>> &&tasks, ASteadyTimePoint first);
+
+    ~UDBBatchTask() override = default;
+
+    [[nodiscard]] size_t GetTaskCount() const;
+
+    void Execute(IDBContext_Interface *context) override;
+};
+
+/**
+ * Buffer The Write Tasks Per Database And Collection.
+ * The Tasks With The Same Document Key Will Be Coalesced In The Window,
+ * And The Collection Will Be Packed Into One Batch Task When It Reaches
+ * The Batch Size Or Its Oldest Task Exceeds The Flush Interval
+ */
+class BASE_API UDBWriteBuffer final {
+
+    friend class UDBBatchTask;
+
+    using ACollectionKey = std::pair<std::string, std::string>;
+
+    struct FCollectionNode {
+        std::vector<std::unique_ptr<IDBTaskBase>> tasks;
+        absl::flat_hash_map<std::string, size_t> keyIndex;
+        ASteadyTimePoint firstTime;
+    };
+
+public:
+    UDBWriteBuffer();
+    ~UDBWriteBuffer();
+
+    DISABLE_COPY_MOVE(UDBWriteBuffer)
+
+    void SetUpAdapter(IDBAdapterBase *adapter);
+
+    void SetBatchSize(size_t size);
+    [[nodiscard]] size_t GetBatchSize() const;
+
+    void SetFlushInterval(ASteadyDuration interval);
+    [[nodiscard]] ASteadyDuration GetFlushInterval() const;
+
+    /// Buffer The Task, Return The Batch Task If Its Collection Reaches The Batch Size
+    [[nodiscard]] std::unique_ptr<IDBTaskBase> Push(std::unique_ptr<IDBTaskBase> &&task);
+
+    /// Pack The Collections Whose Oldest Task Exceeds The Flush Interval
+    [[nodiscard]] std::vector<std::unique_ptr<IDBTaskBase>> Collect(ASteadyTimePoint now);
+
+    /// Pack The Buffered Tasks Of One Collection, Return Null If Nothing Buffered
+    [[nodiscard]] std::unique_ptr<IDBTaskBase> CollectCollection(const std::string &db, const std::string &col);
+
+    /// Pack The Buffered Task Of One Document Alone, The Rest Of Its Collection Stays; Return Null If Not Buffered
+    [[nodiscard]] std::unique_ptr<IDBTaskBase> CollectDocument(const std::string &db, const std::string &col, const std::string &key);
+
+    /// Pack All The Buffered Collections
+    [[nodiscard]] std::vector<std::unique_ptr<IDBTaskBase>> CollectAll();
+
+    /// Return The Count Of The Buffered Tasks
+    [[nodiscard]] size_t GetPendingCount() const;
+
+    [[nodiscard]] FDBFlushStats GetFlushStats() const;
+
+private:
+    std::unique_ptr<IDBTaskBase> PackCollection(const ACollectionKey &key, FCollectionNode &node);
+
+    void RecordFlush(size_t count, ASteadyDuration latency, ASteadyDuration execute);
+
+private:
+    IDBAdapterBase *mAdapter;
+
+    size_t mBatchSize;
+    ASteadyDuration mFlushInterval;
+
+    absl::flat_hash_map<ACollectionKey, FCollectionNode> mCollectionMap;
+    size_t mPendingCount;
+    mutable std::mutex mMutex;
+
+    FDBFlushStats mStats;
+    int64_t mTotalLatency;
+    mutable std::mutex mStatsMutex;
+};
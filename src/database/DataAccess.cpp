@@ -3,11 +3,14 @@
 #include "DBContext.h"
 #include "Server.h"
 #include "config/Config.h"
+#include "monitor/Metrics.h"
 
+#include <absl/hash/hash.h>
 #include <spdlog/spdlog.h>
 
 UDataAccess::UDataAccess()
-    : mNextIndex(0) {
+    : mNextIndex(0),
+      bFlushQuit(false) {
 }
 
 void UDataAccess::Initial() {
@@ -20,54 +23,139 @@ void UDataAccess::Initial() {
     const auto *module = GetServer()->GetModule<UConfig>();
     assert(module != nullptr);
 
-    const auto *startUp = std::invoke(mInitConfig, module->GetServerConfig());
+    const auto &cfg = module->GetServerConfig();
+
+    const auto *startUp = std::invoke(mInitConfig, cfg);
     mAdapter->Initial(startUp);
 
-    mWorkerList = std::vector<FWorkerNode>(2);
+    auto workerCount = cfg["database"]["pool"].as<int>();
+    if (workerCount <= 0) {
+        SPDLOG_WARN("{} - Invalid Database Pool Size {}, Use 1 Worker", __FUNCTION__, workerCount);
+        workerCount = 1;
+    }
+
+    const auto batchSize = cfg["database"]["write_behind"]["batch_size"].as<size_t>();
+    const auto flushInterval = std::chrono::milliseconds(cfg["database"]["write_behind"]["flush_interval"].as<int>());
+
+    mWorkerList = std::vector<FWorkerNode>(workerCount);
     for (auto &worker: mWorkerList) {
+        // Set Up The Write-Behind Buffer
+        worker.buffer.SetUpAdapter(mAdapter.get());
+        worker.buffer.SetBatchSize(batchSize);
+        worker.buffer.SetFlushInterval(flushInterval);
+
         worker.thread = std::thread([this, &worker] {
             auto *ctx = mAdapter->AcquireContext();
 
-            while (worker.deque.IsRunning() && mState == EModuleState::RUNNING) {
-                worker.deque.Wait();
-
-                if (!worker.deque.IsRunning() || mState != EModuleState::RUNNING)
-                    break;
+            auto &registry = UMetricsRegistry::Instance();
+            auto *waitHistogram = registry.GetHistogram("uranus_db_queue_wait_microseconds", "The Database Task Waiting In The Worker Queue");
+            auto *executeHistogram = registry.GetHistogram("uranus_db_execute_microseconds", "The Database Task Execution");
 
+            const auto execute = [&worker, ctx, waitHistogram, executeHistogram](FTaskNode &&node) {
+                const auto begin = std::chrono::steady_clock::now();
                 try {
-                    const auto node = std::move(worker.deque.PopFront());
-                    node->Execute(ctx);
+                    node.task->Execute(ctx);
                 } catch (const std::exception &e) {
                     SPDLOG_ERROR("UDataAccess::RunInThread - Exception: {}", e.what());
                 }
+                const auto end = std::chrono::steady_clock::now();
+
+                const auto waitUs = std::chrono::duration_cast<std::chrono::microseconds>(begin - node.enqueueTime).count();
+                const auto executeUs = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+
+                waitHistogram->Record(std::max<int64_t>(waitUs, 0));
+                executeHistogram->Record(std::max<int64_t>(executeUs, 0));
+
+                std::unique_lock lock(worker.statsMutex);
+                auto &stats = worker.stats;
+
+                ++stats.executedCount;
+
+                stats.lastWait = waitUs;
+                stats.maxWait = std::max(stats.maxWait, waitUs);
+
+                worker.totalWait += waitUs;
+                stats.averageWait = worker.totalWait / static_cast<int64_t>(stats.executedCount);
+
+                stats.lastExecute = executeUs;
+                stats.maxExecute = std::max(stats.maxExecute, executeUs);
+            };
+
+            // Only Quit By The Deque, Or The Worker Will Exit Before The Module Running
+            while (worker.deque.IsRunning()) {
+                worker.deque.Wait();
+
+                if (!worker.deque.IsRunning())
+                    break;
+
+                std::invoke(execute, worker.deque.PopFront());
+            }
+
+            // Execute The Rest Tasks, Include The Flushed Write-Behind Batches
+            while (!worker.deque.IsEmpty()) {
+                std::invoke(execute, worker.deque.PopFront());
             }
 
-            worker.deque.Clear();
             delete ctx;
         });
     }
 
+    mFlushThread = std::thread([this] {
+        FlushLoop();
+    });
+
     delete startUp;
     mState = EModuleState::INITIALIZED;
 }
 
 void UDataAccess::Stop() {
-    if (mState == EModuleState::STOPPED)
+    if (mState >= EModuleState::STOPPING)
         return;
 
+    // Refuse The New Tasks Before The Drain, The Ones Already Past The Check Recheck It Under The Dispatch Mutex
+    mState = EModuleState::STOPPING;
+
+    // Stop The Flush Thread
+    {
+        std::unique_lock lock(mFlushMutex);
+        bFlushQuit = true;
+    }
+    mFlushCond.notify_all();
+
+    if (mFlushThread.joinable()) {
+        mFlushThread.join();
+    }
+
+    // Hand Over All The Buffered Writes Before The Workers Quit
+    for (size_t idx = 0; idx < mWorkerList.size(); ++idx) {
+        std::unique_lock lock(mWorkerList[idx].dispatchMutex);
+        for (auto &batch : mWorkerList[idx].buffer.CollectAll()) {
+            DispatchTask(idx, std::move(batch));
+        }
+    }
+
     mState = EModuleState::STOPPED;
 
     mAdapter->Stop();
 
-    for (auto &[thread, deque]: mWorkerList) {
-        deque.Quit();
+    for (auto &worker: mWorkerList) {
+        worker.deque.Quit();
     }
 }
 
 UDataAccess::~UDataAccess() {
-    for (auto &[thread, deque]: mWorkerList) {
-        if (thread.joinable()) {
-            thread.join();
+    if (mFlushThread.joinable()) {
+        {
+            std::unique_lock lock(mFlushMutex);
+            bFlushQuit = true;
+        }
+        mFlushCond.notify_all();
+        mFlushThread.join();
+    }
+
+    for (auto &worker: mWorkerList) {
+        if (worker.thread.joinable()) {
+            worker.thread.join();
         }
     }
 }
@@ -82,14 +170,199 @@ IDBAdapterBase *UDataAccess::GetAdapter() const {
     return mAdapter.get();
 }
 
-void UDataAccess::PushTask(std::unique_ptr<IDBTaskBase> &&task) {
+bool UDataAccess::SaveDocument(const std::string &col, const std::string &key, std::string doc, const int64_t shardKey) {
+    if (mState != EModuleState::RUNNING || mAdapter == nullptr)
+        return false;
+
+    auto task = mAdapter->CreateSaveTask(col, key, std::move(doc));
+    if (task == nullptr)
+        return false;
+
+    if (shardKey >= 0) {
+        task->SetShardKey(shardKey);
+    }
+
+    return PushTask(std::move(task));
+}
+
+bool UDataAccess::LoadDocument(const std::string &col, const std::string &key, ADBLoadCallback callback, const int64_t shardKey) {
+    if (mState != EModuleState::RUNNING || mAdapter == nullptr || callback == nullptr)
+        return false;
+
+    auto task = mAdapter->CreateLoadTask(col, key, std::move(callback));
+    if (task == nullptr)
+        return false;
+
+    if (shardKey >= 0) {
+        task->SetShardKey(shardKey);
+    }
+
+    return PushTask(std::move(task));
+}
+
+FDBFlushStats UDataAccess::GetFlushStats() const {
+    FDBFlushStats result;
+    int64_t totalLatency = 0;
+
+    for (const auto &worker : mWorkerList) {
+        const auto stats = worker.buffer.GetFlushStats();
+
+        result.flushCount += stats.flushCount;
+        result.taskCount += stats.taskCount;
+        result.coalescedCount += stats.coalescedCount;
+
+        result.lastLatency = std::max(result.lastLatency, stats.lastLatency);
+        result.maxLatency = std::max(result.maxLatency, stats.maxLatency);
+        totalLatency += stats.averageLatency * static_cast<int64_t>(stats.flushCount);
+
+        result.lastExecute = std::max(result.lastExecute, stats.lastExecute);
+        result.maxExecute = std::max(result.maxExecute, stats.maxExecute);
+    }
+
+    if (result.flushCount > 0) {
+        result.averageLatency = totalLatency / static_cast<int64_t>(result.flushCount);
+    }
+
+    return result;
+}
+
+size_t UDataAccess::GetPendingWriteCount() const {
+    size_t count = 0;
+    for (const auto &worker : mWorkerList) {
+        count += worker.buffer.GetPendingCount();
+    }
+    return count;
+}
+
+size_t UDataAccess::GetWorkerCount() const {
+    return mWorkerList.size();
+}
+
+std::vector<FDBWorkerStats> UDataAccess::GetWorkerStats() const {
+    std::vector<FDBWorkerStats> result;
+    result.reserve(mWorkerList.size());
+
+    for (const auto &worker : mWorkerList) {
+        FDBWorkerStats stats;
+        {
+            std::unique_lock lock(worker.statsMutex);
+            stats = worker.stats;
+        }
+
+        stats.queueDepth = worker.deque.Size();
+        stats.pendingWrite = worker.buffer.GetPendingCount();
+
+        result.emplace_back(stats);
+    }
+
+    return result;
+}
+
+bool UDataAccess::PushTask(std::unique_ptr<IDBTaskBase> &&task) {
     if (mState != EModuleState::RUNNING)
+        return false;
+
+    if (task == nullptr || mWorkerList.empty())
+        return false;
+
+    if (!CheckShardKeyUsage(task.get()))
+        return false;
+
+    const auto index = SelectWorker(task.get());
+    auto &worker = mWorkerList[index];
+
+    std::unique_lock lock(worker.dispatchMutex);
+
+    // Stop Drains The Buffer Under This Mutex, Nothing Buffered After It Would Ever Be Written
+    if (mState != EModuleState::RUNNING)
+        return false;
+
+    if (!task->IsBatchable()) {
+        // Flush The Buffered Write Of The Same Document First, So The Task Runs After It;
+        // Without The Document Key It May Touch Any Of The Collection, Flush All Of Them
+        std::unique_ptr<IDBTaskBase> batch;
+        if (const auto key = task->GetDocumentKey(); !key.empty()) {
+            batch = worker.buffer.CollectDocument(task->GetDatabaseName(), task->GetCollectionName(), key);
+        } else {
+            batch = worker.buffer.CollectCollection(task->GetDatabaseName(), task->GetCollectionName());
+        }
+
+        if (batch != nullptr) {
+            DispatchTask(index, std::move(batch));
+        }
+
+        DispatchTask(index, std::move(task));
+        return true;
+    }
+
+    // Buffer The Write And Dispatch The Batch If Reached The Batch Size
+    if (auto batch = worker.buffer.Push(std::move(task))) {
+        DispatchTask(index, std::move(batch));
+    }
+
+    return true;
+}
+
+size_t UDataAccess::SelectWorker(const IDBTaskBase *task) {
+    const auto count = mWorkerList.size();
+
+    if (task->HasShardKey())
+        return static_cast<size_t>(absl::HashOf(task->GetShardKey()) % count);
+
+    if (const auto key = task->GetDocumentKey(); !key.empty())
+        return static_cast<size_t>(absl::HashOf(task->GetCollectionName(), key) % count);
+
+    return mNextIndex.fetch_add(1, std::memory_order_relaxed) % count;
+}
+
+bool UDataAccess::CheckShardKeyUsage(const IDBTaskBase *task) {
+    // Not Routed By The Document, Nothing To Keep In Order
+    if (task->GetDocumentKey().empty())
+        return true;
+
+    std::unique_lock lock(mShardKeyMutex);
+
+    const auto [iter, bInserted] = mShardKeyUsage.try_emplace(
+        std::make_pair(task->GetDatabaseName(), task->GetCollectionName()), task->HasShardKey());
+
+    if (bInserted || iter->second == task->HasShardKey())
+        return true;
+
+    SPDLOG_ERROR("{} - Collection[{}.{}] Keyed {} The Shard Key Before, Task Refused",
+        __FUNCTION__, task->GetDatabaseName(), task->GetCollectionName(), iter->second ? "With" : "Without");
+
+    return false;
+}
+
+void UDataAccess::DispatchTask(const size_t index, std::unique_ptr<IDBTaskBase> &&task) {
+    if (index >= mWorkerList.size())
         return;
 
+    mWorkerList[index].deque.PushBack({ std::move(task), std::chrono::steady_clock::now() });
+}
+
+void UDataAccess::FlushLoop() {
     if (mWorkerList.empty())
         return;
-    auto &[thread, deque] = mWorkerList[mNextIndex++];
-    mNextIndex = mNextIndex % mWorkerList.size();
 
-    deque.PushBack(std::move(task));
+    const auto interval = mWorkerList.front().buffer.GetFlushInterval();
+
+    // Check Twice In One Interval, So The Latency Will Not Exceed 1.5 Times Of It
+    const auto gap = interval / 2 > ASteadyDuration::zero() ? interval / 2 : std::chrono::milliseconds(1);
+
+    while (true) {
+        {
+            std::unique_lock lock(mFlushMutex);
+            if (mFlushCond.wait_for(lock, gap, [this] { return bFlushQuit; }))
+                break;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        for (size_t idx = 0; idx < mWorkerList.size(); ++idx) {
+            std::unique_lock lock(mWorkerList[idx].dispatchMutex);
+            for (auto &batch : mWorkerList[idx].buffer.Collect(now)) {
+                DispatchTask(idx, std::move(batch));
+            }
+        }
+    }
 }
@@ -3,15 +3,37 @@
 #include "Module.h"
 #include "base/ConcurrentDeque.h"
 #include "DBAdapterBase.h"
+#include "DBWriteBuffer.h"
 
+#include <absl/container/flat_hash_map.h>
 #include <thread>
 #include <vector>
 #include <functional>
+#include <condition_variable>
 #include <yaml-cpp/yaml.h>
 
 
 class IDBTaskBase;
 
+
+/**
+ * The Statistic Of One Database Worker,
+ * The Wait Is From The Task Dispatched To It Started, All The Durations Are In Microsecond
+ */
+struct BASE_API FDBWorkerStats {
+    size_t queueDepth       = 0;
+    size_t pendingWrite     = 0;
+    uint64_t executedCount  = 0;
+
+    int64_t lastWait        = 0;
+    int64_t maxWait         = 0;
+    int64_t averageWait     = 0;
+
+    int64_t lastExecute     = 0;
+    int64_t maxExecute      = 0;
+};
+
+
 class BASE_API UDataAccess final : public IModuleBase {
 
     DECLARE_MODULE(UDataAccess)
@@ -39,20 +61,83 @@ public:
 
     [[nodiscard]] IDBAdapterBase *GetAdapter() const;
 
+    /// Upsert One Document Through The Write-Behind Buffer, The Shard Key Keeps The Writes Of One Owner In Order,
+    /// Return False If The Adapter Not Support Or The Module Is Not Running
+    bool SaveDocument(const std::string &col, const std::string &key, std::string doc, int64_t shardKey = -1);
+
+    /// Read One Document After The Writes Of It Pushed Before, Pass The Same Shard Key As Saved With;
+    /// The Callback Is Invoked In The Worker Thread, Return False And Never Invoke It If Not Accepted
+    bool LoadDocument(const std::string &col, const std::string &key, ADBLoadCallback callback, int64_t shardKey = -1);
+
+    /// Forward To IDBAdapterBase::PushTaskAsync
+    template<class Result, class Factory, asio::completion_token_for<void(Result)> CompletionToken>
+    auto PushTaskAsync(Factory &&factory, CompletionToken &&token);
+
+    /// Return The Statistic Of All The Write-Behind Buffers
+    [[nodiscard]] FDBFlushStats GetFlushStats() const;
+
+    /// Return The Count Of The Tasks Waiting In The Write-Behind Buffers
+    [[nodiscard]] size_t GetPendingWriteCount() const;
+
+    [[nodiscard]] size_t GetWorkerCount() const;
+
+    /// Return The Queue Depth And Latency Of Every Worker
+    [[nodiscard]] std::vector<FDBWorkerStats> GetWorkerStats() const;
+
 private:
-    void PushTask(std::unique_ptr<IDBTaskBase> &&task);
+    /// The Batchable Task Goes To The Write-Behind Buffer Of Its Worker, Others Dispatch To Worker Directly,
+    /// Return False And Leave The Task Untouched If The Module Is Not Running
+    bool PushTask(std::unique_ptr<IDBTaskBase> &&task);
+
+    /// Select The Worker By The Shard Key, Then The Collection And Document Key,
+    /// Round-Robin If The Task Has Neither
+    size_t SelectWorker(const IDBTaskBase *task);
+
+    /// The Keyed Tasks Of One Collection Must All Use The Shard Key Or All Not, Or One Document Is Routed To
+    /// Two Workers And Its Load May Overtake Its Save; The First Keyed Task Decides, Return False If Disagreed
+    bool CheckShardKeyUsage(const IDBTaskBase *task);
+
+    /// Dispatch The Task To The Worker
+    void DispatchTask(size_t index, std::unique_ptr<IDBTaskBase> &&task);
+
+    /// Flush The Expired Collections In The Write-Behind Buffer Periodically
+    void FlushLoop();
 
 private:
     std::unique_ptr<IDBAdapterBase> mAdapter;
 
+    std::thread mFlushThread;
+    std::mutex mFlushMutex;
+    std::condition_variable mFlushCond;
+    bool bFlushQuit;
+
+    struct FTaskNode {
+        std::unique_ptr<IDBTaskBase> task;
+        ASteadyTimePoint enqueueTime;
+    };
+
     struct FWorkerNode {
         std::thread thread;
-        TConcurrentDeque<std::unique_ptr<IDBTaskBase>, true> deque;
+        TConcurrentDeque<FTaskNode, true> deque;
+
+        /** Buffer And Coalesce The Write Tasks Routed To This Worker **/
+        UDBWriteBuffer buffer;
+
+        /** Keep The Collected Batch And The Following Task In Order While Dispatching **/
+        std::mutex dispatchMutex;
+
+        FDBWorkerStats stats;
+        int64_t totalWait = 0;
+        mutable std::mutex statsMutex;
     };
 
     std::vector<FWorkerNode> mWorkerList;
     std::atomic_size_t mNextIndex;
 
+    /** If The Keyed Tasks Of The Database And Collection Use The Shard Key **/
+    absl::flat_hash_map<std::pair<std::string, std::string>, bool> mShardKeyUsage;
+    std::mutex mShardKeyMutex;
+
     std::function<IDataAsset_Interface *(const YAML::Node &)> mInitConfig;
 };
 
@@ -64,3 +149,7 @@ inline void UDataAccess::SetDatabaseAdapter() {
     mAdapter = std::make_unique<Type>();
 }
 
+template<class Result, class Factory, asio::completion_token_for<void(Result)> CompletionToken>
+inline auto UDataAccess::PushTaskAsync(Factory &&factory, CompletionToken &&token) {
+    return mAdapter->template PushTaskAsync<Result>(std::forward<Factory>(factory), std::forward<CompletionToken>(token));
+}
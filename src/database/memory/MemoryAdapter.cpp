@@ -0,0 +1,88 @@
+#include "MemoryAdapter.h"
+#include "MemoryStartUpData.h"
+#include "MemoryContext.h"
+
+#include <spdlog/spdlog.h>
+
+
+UMemoryAdapter::UMemoryAdapter()
+    : mDatabaseName("uranus"),
+      bQuit(false) {
+}
+
+UMemoryAdapter::~UMemoryAdapter() {
+}
+
+void UMemoryAdapter::Initial(const IDataAsset_Interface *data) {
+    const auto *startUp = dynamic_cast<const FMemoryStartUpData *>(data);
+    if (startUp == nullptr)
+        return;
+
+    if (!startUp->mDatabaseName.empty()) {
+        mDatabaseName = startUp->mDatabaseName;
+    }
+}
+
+void UMemoryAdapter::Stop() {
+    bQuit = true;
+}
+
+IDBContext_Interface *UMemoryAdapter::AcquireContext() {
+    const auto res = new FMemoryContext(&mStorage);
+    return res;
+}
+
+void UMemoryAdapter::ExecuteBatch(IDBContext_Interface *context, std::vector<std::unique_ptr<IDBTaskBase>> &tasks) {
+    if (tasks.empty())
+        return;
+
+    // All The Tasks In One Batch Share The Same Database And Collection
+    const auto &db = tasks.front()->GetDatabaseName();
+    const auto &col = tasks.front()->GetCollectionName();
+
+    std::vector<memory::IDBTask_Write *> writes;
+    std::vector<bool> results;
+
+    writes.reserve(tasks.size());
+    results.reserve(tasks.size());
+
+    for (const auto &task : tasks) {
+        if (auto *write = dynamic_cast<memory::IDBTask_Write *>(task.get())) {
+            writes.emplace_back(write);
+        } else if (task != nullptr) {
+            // Not The Memory Write Task, Fallback To Execute Alone
+            task->Execute(context);
+        }
+    }
+
+    if (writes.empty())
+        return;
+
+    mStorage.Bulk(db, col, [&writes, &results](UMemoryStorage::ACollection &collection) {
+        for (auto *write : writes) {
+            results.emplace_back(write->Apply(collection));
+        }
+    });
+
+    for (size_t idx = 0; idx < writes.size(); ++idx) {
+        writes[idx]->Complete(results[idx]);
+    }
+
+    SPDLOG_TRACE("{} - Bulk Write {} Documents To {}.{}", __FUNCTION__, writes.size(), db, col);
+}
+
+std::unique_ptr<IDBTaskBase> UMemoryAdapter::CreateSaveTask(const std::string &col, const std::string &key, std::string doc) {
+    return std::make_unique<memory::TDBTask_Save<ACallback>>(mDatabaseName, col, ACallback(EmptyCallback), key, std::move(doc));
+}
+
+std::unique_ptr<IDBTaskBase> UMemoryAdapter::CreateLoadTask(const std::string &col, const std::string &key, ADBLoadCallback &&callback) {
+    return std::make_unique<memory::TDBTask_Load<ADBLoadCallback>>(mDatabaseName, col, std::move(callback), key);
+}
+
+UMemoryStorage &UMemoryAdapter::GetStorage() {
+    return mStorage;
+}
+
+const std::string &UMemoryAdapter::GetDatabaseName() const {
+    return mDatabaseName;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "database/DBAdapterBase.h"
+#include "MemoryTaskDef.h"
+#include "MemoryStorage.h"
+
+#include <atomic>
+
+
+/**
+ * The Database Adapter Storing Documents In Process Memory,
+ * Used For Development And Testing Without A Running Database
+ */
+class BASE_API UMemoryAdapter final : public IDBAdapterBase {
+
+    using ACallback = std::decay_t<decltype(EmptyCallback)>;
+
+public:
+    UMemoryAdapter();
+    ~UMemoryAdapter() override;
+
+    void Initial(const IDataAsset_Interface *data) override;
+    void Stop() override;
+
+    IDBContext_Interface *AcquireContext() override;
+
+    /// Apply All The Write Tasks Of The Batch Under One Lock Of The Collection
+    void ExecuteBatch(IDBContext_Interface *context, std::vector<std::unique_ptr<IDBTaskBase>> &tasks) override;
+
+    [[nodiscard]] std::unique_ptr<IDBTaskBase> CreateSaveTask(const std::string &col, const std::string &key, std::string doc) override;
+    [[nodiscard]] std::unique_ptr<IDBTaskBase> CreateLoadTask(const std::string &col, const std::string &key, ADBLoadCallback &&callback) override;
+
+    template<class Callback = ACallback>
+    void PushSave(const std::string &col, const std::string &key, std::string doc, Callback &&cb = Callback{}) {
+        using AHandler = std::decay_t<Callback>;
+        auto task = std::make_unique<memory::TDBTask_Save<AHandler>>(mDatabaseName, col, AHandler(std::forward<Callback>(cb)), key, std::move(doc));
+        this->PushTask(std::move(task));
+    }
+
+    template<class Callback = ACallback>
+    void PushRemove(const std::string &col, const std::string &key, Callback &&cb = Callback{}) {
+        using AHandler = std::decay_t<Callback>;
+        auto task = std::make_unique<memory::TDBTask_Remove<AHandler>>(mDatabaseName, col, AHandler(std::forward<Callback>(cb)), key);
+        this->PushTask(std::move(task));
+    }
+
+    template<class Callback = ACallback>
+    void PushLoad(const std::string &col, const std::string &key, Callback &&cb = Callback{}) {
+        using AHandler = std::decay_t<Callback>;
+        auto task = std::make_unique<memory::TDBTask_Load<AHandler>>(mDatabaseName, col, AHandler(std::forward<Callback>(cb)), key);
+        this->PushTask(std::move(task));
+    }
+
+    template<asio::completion_token_for<void(bool)> CompletionToken>
+    auto AsyncSave(const std::string &col, const std::string &key, std::string doc, CompletionToken &&token) {
+        return this->PushTaskAsync<bool>([this, col, key, doc = std::move(doc)]<class Callback>(Callback &&cb) mutable {
+            return std::make_unique<memory::TDBTask_Save<Callback>>(mDatabaseName, col, std::forward<Callback>(cb), key, std::move(doc));
+        }, std::forward<CompletionToken>(token));
+    }
+
+    template<asio::completion_token_for<void(bool)> CompletionToken>
+    auto AsyncRemove(const std::string &col, const std::string &key, CompletionToken &&token) {
+        return this->PushTaskAsync<bool>([this, col, key]<class Callback>(Callback &&cb) {
+            return std::make_unique<memory::TDBTask_Remove<Callback>>(mDatabaseName, col, std::forward<Callback>(cb), key);
+        }, std::forward<CompletionToken>(token));
+    }
+
+    template<asio::completion_token_for<void(std::optional<std::string>)> CompletionToken>
+    auto AsyncLoad(const std::string &col, const std::string &key, CompletionToken &&token) {
+        return this->PushTaskAsync<std::optional<std::string>>([this, col, key]<class Callback>(Callback &&cb) {
+            return std::make_unique<memory::TDBTask_Load<Callback>>(mDatabaseName, col, std::forward<Callback>(cb), key);
+        }, std::forward<CompletionToken>(token));
+    }
+
+    [[nodiscard]] UMemoryStorage &GetStorage();
+    [[nodiscard]] const std::string &GetDatabaseName() const;
+
+private:
+    UMemoryStorage mStorage;
+    std::string mDatabaseName;
+
+    std::atomic_bool bQuit;
+};
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "database/DBContext.h"
+
+class UMemoryStorage;
+
+struct BASE_API FMemoryContext final : public IDBContext_Interface {
+    UMemoryStorage *storage;
+
+    explicit FMemoryContext(UMemoryStorage *s)
+        : storage(s) {
+    }
+
+    [[nodiscard]] const char *GetTypeName() const override {
+        return "FMemoryContext";
+    }
+};
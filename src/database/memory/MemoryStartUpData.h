@@ -0,0 +1,14 @@
+#pragma once
+
+#include "base/DataAsset.h"
+
+#include <string>
+
+class BASE_API FMemoryStartUpData final : public IDataAsset_Interface {
+public:
+    std::string mDatabaseName;
+
+    [[nodiscard]] const char *GetTypeName() const override {
+        return "FMemoryStartUpData";
+    }
+};
@@ -0,0 +1,75 @@
+#include "MemoryStorage.h"
+
+
+UMemoryStorage::UMemoryStorage()
+    : mWriteCount(0),
+      mBulkCount(0) {
+}
+
+UMemoryStorage::~UMemoryStorage() {
+}
+
+std::optional<std::string> UMemoryStorage::Find(const std::string &db, const std::string &col, const std::string &key) const {
+    std::shared_lock lock(mMutex);
+
+    const auto colIter = mCollectionMap.find(std::make_pair(db, col));
+    if (colIter == mCollectionMap.end())
+        return std::nullopt;
+
+    const auto iter = colIter->second.find(key);
+    if (iter == colIter->second.end())
+        return std::nullopt;
+
+    return iter->second;
+}
+
+void UMemoryStorage::Save(const std::string &db, const std::string &col, const std::string &key, std::string doc) {
+    {
+        std::unique_lock lock(mMutex);
+        mCollectionMap[std::make_pair(db, col)].insert_or_assign(key, std::move(doc));
+    }
+    mWriteCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool UMemoryStorage::Remove(const std::string &db, const std::string &col, const std::string &key) {
+    mWriteCount.fetch_add(1, std::memory_order_relaxed);
+
+    std::unique_lock lock(mMutex);
+    const auto colIter = mCollectionMap.find(std::make_pair(db, col));
+    if (colIter == mCollectionMap.end())
+        return false;
+
+    return colIter->second.erase(key) > 0;
+}
+
+void UMemoryStorage::Bulk(const std::string &db, const std::string &col, const std::function<void(ACollection &)> &func) {
+    if (func == nullptr)
+        return;
+
+    {
+        std::unique_lock lock(mMutex);
+        std::invoke(func, mCollectionMap[std::make_pair(db, col)]);
+    }
+
+    mWriteCount.fetch_add(1, std::memory_order_relaxed);
+    mBulkCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+size_t UMemoryStorage::Count(const std::string &db, const std::string &col) const {
+    std::shared_lock lock(mMutex);
+    const auto iter = mCollectionMap.find(std::make_pair(db, col));
+    return iter == mCollectionMap.end() ? 0 : iter->second.size();
+}
+
+uint64_t UMemoryStorage::GetWriteCount() const {
+    return mWriteCount.load(std::memory_order_relaxed);
+}
+
+uint64_t UMemoryStorage::GetBulkCount() const {
+    return mBulkCount.load(std::memory_order_relaxed);
+}
+
+void UMemoryStorage::Clear() {
+    std::unique_lock lock(mMutex);
+    mCollectionMap.clear();
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Common.h"
+
+#include <absl/container/flat_hash_map.h>
+#include <shared_mutex>
+#include <mutex>
+#include <functional>
+#include <optional>
+#include <atomic>
+#include <string>
+
+
+/**
+ * The In-Memory Document Storage,
+ * Documents Are Stored As String By Database, Collection And Key.
+ * Use For Testing And Running Without A Real Database
+ */
+class BASE_API UMemoryStorage final {
+
+public:
+    using ACollection = absl::flat_hash_map<std::string, std::string>;
+
+    UMemoryStorage();
+    ~UMemoryStorage();
+
+    DISABLE_COPY_MOVE(UMemoryStorage)
+
+    [[nodiscard]] std::optional<std::string> Find(const std::string &db, const std::string &col, const std::string &key) const;
+
+    void Save(const std::string &db, const std::string &col, const std::string &key, std::string doc);
+    bool Remove(const std::string &db, const std::string &col, const std::string &key);
+
+    /// Lock The Collection Once And Apply All The Writes In The Function
+    void Bulk(const std::string &db, const std::string &col, const std::function<void(ACollection &)> &func);
+
+    [[nodiscard]] size_t Count(const std::string &db, const std::string &col) const;
+
+    /// The Count Of The Single Writes, Bulk Operation Is Counted As One
+    [[nodiscard]] uint64_t GetWriteCount() const;
+    [[nodiscard]] uint64_t GetBulkCount() const;
+
+    void Clear();
+
+private:
+    absl::flat_hash_map<std::pair<std::string, std::string>, ACollection> mCollectionMap;
+    mutable std::shared_mutex mMutex;
+
+    std::atomic_uint64_t mWriteCount;
+    std::atomic_uint64_t mBulkCount;
+};
@@ -0,0 +1,184 @@
+#pragma once
+
+#include "database/DBTaskBase.h"
+#include "database/DBAdapterBase.h"
+#include "MemoryContext.h"
+#include "MemoryStorage.h"
+
+#include <optional>
+#include <type_traits>
+
+
+namespace memory {
+
+    /**
+     * The Base Of The Single Document Write Task,
+     * The Adapter Applies A Batch Of Them Under One Lock Of The Collection
+     */
+    class BASE_API IDBTask_Write : public IDBTaskBase {
+
+    protected:
+        std::string mKey;
+
+    public:
+        IDBTask_Write() = delete;
+
+        IDBTask_Write(std::string db, std::string col, std::string key)
+            : IDBTaskBase(std::move(db), std::move(col)),
+              mKey(std::move(key)) {
+        }
+
+        ~IDBTask_Write() override = default;
+
+        [[nodiscard]] bool IsBatchable() const override { return true; }
+        [[nodiscard]] std::string GetDocumentKey() const override { return mKey; }
+
+        /// Write To The Collection, Called With The Collection Locked
+        virtual bool Apply(UMemoryStorage::ACollection &collection) = 0;
+
+        /// Invoke The Callback, Called After The Collection Unlocked
+        virtual void Complete(bool bSuccess) = 0;
+
+        void Execute(IDBContext_Interface *ctx) override {
+            const auto *context = dynamic_cast<FMemoryContext *>(ctx);
+            if (context == nullptr || context->storage == nullptr) {
+                Complete(false);
+                return;
+            }
+
+            bool bSuccess = false;
+            context->storage->Bulk(mDatabase, mCollection, [this, &bSuccess](UMemoryStorage::ACollection &collection) {
+                bSuccess = Apply(collection);
+            });
+
+            Complete(bSuccess);
+        }
+    };
+
+    template<class Callback>
+    class TDBTask_Save final : public IDBTask_Write {
+
+        Callback mCallback;
+        std::string mDocument;
+
+    public:
+        TDBTask_Save() = delete;
+
+        TDBTask_Save(
+            std::string db,
+            std::string col,
+            Callback &&cb,
+            std::string key,
+            std::string doc
+        ): IDBTask_Write(
+               std::move(db),
+               std::move(col),
+               std::move(key)
+           ),
+           mCallback(std::forward<Callback>(cb)),
+           mDocument(std::move(doc)) {
+        }
+
+        ~TDBTask_Save() override = default;
+
+        bool Apply(UMemoryStorage::ACollection &collection) override {
+            collection.insert_or_assign(mKey, std::move(mDocument));
+            return true;
+        }
+
+        void Complete(const bool bSuccess) override {
+            std::invoke(mCallback, bSuccess);
+        }
+
+        /// The Newer Document Of The Same Key Covers This One
+        void OnCoalesced() override {
+            std::invoke(mCallback, true);
+        }
+    };
+
+    template<class Callback>
+    class TDBTask_Remove final : public IDBTask_Write {
+
+        Callback mCallback;
+
+    public:
+        TDBTask_Remove() = delete;
+
+        TDBTask_Remove(
+            std::string db,
+            std::string col,
+            Callback &&cb,
+            std::string key
+        ): IDBTask_Write(
+               std::move(db),
+               std::move(col),
+               std::move(key)
+           ),
+           mCallback(std::forward<Callback>(cb)) {
+        }
+
+        ~TDBTask_Remove() override = default;
+
+        bool Apply(UMemoryStorage::ACollection &collection) override {
+            return collection.erase(mKey) > 0;
+        }
+
+        void Complete(const bool bSuccess) override {
+            std::invoke(mCallback, bSuccess);
+        }
+
+        void OnCoalesced() override {
+            std::invoke(mCallback, true);
+        }
+    };
+
+    template<class Callback>
+    class TDBTask_Load final : public TDBTaskBase<Callback> {
+
+        std::string mKey;
+
+    public:
+        TDBTask_Load() = delete;
+
+        TDBTask_Load(
+            std::string db,
+            std::string col,
+            Callback &&cb,
+            std::string key
+        ): TDBTaskBase<Callback>(
+               std::move(db),
+               std::move(col),
+               std::forward<Callback>(cb)
+           ),
+           mKey(std::move(key)) {
+        }
+
+        ~TDBTask_Load() override = default;
+
+        /// Lands On The Worker Buffering The Writes Of The Same Document, So The Read Runs After Them
+        [[nodiscard]] std::string GetDocumentKey() const override { return mKey; }
+
+        void Execute(IDBContext_Interface *ctx) override {
+            const auto *context = dynamic_cast<FMemoryContext *>(ctx);
+            if (context == nullptr || context->storage == nullptr) {
+                Complete(EDBLoadStatus::FAILED, std::nullopt);
+                return;
+            }
+
+            auto result = context->storage->Find(IDBTaskBase::mDatabase, IDBTaskBase::mCollection, mKey);
+            const auto status = result.has_value() ? EDBLoadStatus::FOUND : EDBLoadStatus::NOT_FOUND;
+
+            Complete(status, std::move(result));
+        }
+
+    private:
+        /// ADBLoadCallback Takes The Status, The Handler Of AsyncLoad Only The Document
+        void Complete(const EDBLoadStatus status, std::optional<std::string> &&doc) {
+            if constexpr (std::is_invocable_v<Callback &, EDBLoadStatus, std::string>) {
+                std::invoke(TDBTaskBase<Callback>::mCallback, status, std::move(doc).value_or(std::string{}));
+            } else {
+                std::invoke(TDBTaskBase<Callback>::mCallback, std::move(doc));
+            }
+        }
+    };
+}
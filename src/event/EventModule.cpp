@@ -4,6 +4,7 @@
 
 #include <spdlog/spdlog.h>
 #include <ranges>
+#include <vector>
 
 
 void UEventModule::Initial() {
@@ -37,12 +38,15 @@ void UEventModule::Dispatch(const std::shared_ptr<IEventParam_Interface> &event)
     if (event->GetEventType() < 0)
         return;
 
+    // Push Out Of The Lock, The Listener May Handle The Event Inline And Listen Again
+    std::vector<shared_ptr<IAgentBase>> listeners;
+
     {
         std::shared_lock lock(mServiceListenerMutex);
         if (const auto iter = mServiceListenerMap.find(event->GetEventType()); iter != mServiceListenerMap.end()) {
             for (const auto &weak : iter->second | std::views::values) {
-                if (const auto context = weak.lock()) {
-                    context->PushEvent(event);
+                if (auto context = weak.lock()) {
+                    listeners.emplace_back(std::move(context));
                 }
             }
         }
@@ -52,13 +56,17 @@ void UEventModule::Dispatch(const std::shared_ptr<IEventParam_Interface> &event)
         std::shared_lock lock(mPlayerListenerMutex);
         if (const auto iter = mPlayerListenerMap.find(event->GetEventType()); iter != mPlayerListenerMap.end()) {
             for (const auto &weak : iter->second | std::views::values) {
-                if (const auto agent = weak.lock()) {
-                    agent->PushEvent(event);
+                if (auto agent = weak.lock()) {
+                    listeners.emplace_back(std::move(agent));
                 }
             }
         }
     }
 
+    for (const auto &agent : listeners) {
+        agent->PushEvent(event);
+    }
+
     RemoveExpiredServices();
     RemoveExpiredPlayers();
 }
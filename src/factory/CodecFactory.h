@@ -8,6 +8,7 @@
 
 class IRecyclerBase;
 class IPackageCodec_Interface;
+class IPackage_Interface;
 
 using std::shared_ptr;
 using std::unique_ptr;
@@ -27,4 +28,7 @@ public:
 
     virtual IPackageCodec_Interface *CreatePackageCodec(ATcpSocket socket) = 0;
     virtual IRecyclerBase *CreatePackagePool(asio::io_context &ctx) = 0;
+
+    /// Frame The Package Once For Writing To Many Connections, Null If Not The Package Type Of The Codec
+    [[nodiscard]] virtual AFrameBuffer EncodeFrame(IPackage_Interface *pkg) const = 0;
 };
@@ -5,6 +5,7 @@
 #include "base/AgentHandler.h"
 #include "base/PackageCodec.h"
 #include "login/LoginAuth.h"
+#include "monitor/Metrics.h"
 
 #include <spdlog/spdlog.h>
 
@@ -183,6 +184,55 @@ void UGateway::ForeachPlayer(const std::function<bool(const shared_ptr<UPlayerAg
     }
 }
 
+void UGateway::Broadcast(const std::vector<int64_t> &list, const AFrameBuffer &frame) const {
+    if (mState != EModuleState::RUNNING)
+        return;
+
+    if (list.empty() || frame == nullptr)
+        return;
+
+    std::vector<shared_ptr<UPlayerAgent>> agents;
+
+    {
+        std::shared_lock lock(mPlayerMutex);
+        agents.reserve(list.size());
+        for (const auto &pid : list) {
+            if (const auto iter = mPlayerMap.find(pid); iter != mPlayerMap.end()) {
+                agents.push_back(iter->second);
+            }
+        }
+    }
+
+    DispatchFrame(agents, frame);
+}
+
+void UGateway::BroadcastAll(const AFrameBuffer &frame) const {
+    if (mState != EModuleState::RUNNING)
+        return;
+
+    if (frame == nullptr)
+        return;
+
+    std::vector<shared_ptr<UPlayerAgent>> agents;
+
+    {
+        std::shared_lock lock(mPlayerMutex);
+        agents.reserve(mPlayerMap.size());
+        for (const auto &agent : mPlayerMap | std::views::values) {
+            agents.push_back(agent);
+        }
+    }
+
+    DispatchFrame(agents, frame);
+}
+
+void UGateway::DispatchFrame(const std::vector<shared_ptr<UPlayerAgent>> &agents, const AFrameBuffer &frame) {
+    // The Output Is A Concurrent Channel, No Hop To The Context Of The Agent
+    for (const auto &agent : agents) {
+        agent->SendFrame(frame);
+    }
+}
+
 void UGateway::Initial() {
     if (mState != EModuleState::CREATED)
         throw std::logic_error(std::format("{} - Module[{}] Not In CREATED State", __FUNCTION__, GetModuleName()));
@@ -193,6 +243,12 @@ void UGateway::Initial() {
     // Load The Library
     mPlayerFactory->Initial();
 
+    // Watch The Event-Loop Lag Of Every Connection Context
+    const auto &cfg = GetServer()->GetServerConfig();
+    mIOContextPool.SetUpWatchdog("gateway",
+        cfg["server"]["watchdog"]["interval"].as<int>(),
+        cfg["server"]["watchdog"]["threshold"].as<int>());
+
     // Run The IO Context Pool
     mIOContextPool.Start(4);
 
@@ -226,6 +282,10 @@ void UGateway::Stop() {
 }
 
 awaitable<void> UGateway::WaitForClient(const uint16_t port) {
+    auto &registry = UMetricsRegistry::Instance();
+    auto *acceptCounter = registry.GetCounter("uranus_accept_total", "The Accepted Client Connections");
+    auto *rejectCounter = registry.GetCounter("uranus_accept_rejected_total", "The Client Connections Rejected By The Blacklist");
+
     try {
         mAcceptor->open(asio::ip::tcp::v4());
         mAcceptor->bind({asio::ip::tcp::v4(), port});
@@ -242,11 +302,14 @@ awaitable<void> UGateway::WaitForClient(const uint16_t port) {
             }
 
             if (socket.is_open()) {
+                acceptCounter->Increment();
+
                 // Check If The IP Address In Blacklist
                 if (auto *login = GetServer()->GetModule<ULoginAuth>(); login != nullptr) {
                     if (!login->VerifyAddress(socket.remote_endpoint())) {
                         SPDLOG_WARN("Reject Client From {}", socket.remote_endpoint().address().to_string());
                         socket.close();
+                        rejectCounter->Increment();
                         continue;
                     }
                 }
@@ -87,12 +87,21 @@ public:
 
     void ForeachPlayer(const std::function<bool(const shared_ptr<UPlayerAgent> &)> &func) const;
 
+    /// Send The Frame To The Login Players, Enqueued To Their Agents From The Caller
+    void Broadcast(const std::vector<int64_t> &list, const AFrameBuffer &frame) const;
+
+    /// Send The Frame To All The Login Players
+    void BroadcastAll(const AFrameBuffer &frame) const;
+
 protected:
     void Initial() override;
     void Start() override;
     void Stop() override;
 
 private:
+    /// Enqueue The Frame To The Output Channel Of Every Agent From The Caller, In Order With The Unicast
+    static void DispatchFrame(const std::vector<shared_ptr<UPlayerAgent>> &agents, const AFrameBuffer &frame);
+
     awaitable<void> WaitForClient(uint16_t port);
     awaitable<void> CollectCachedPlayer();
 };
@@ -9,6 +9,8 @@
 #include "event/EventModule.h"
 #include "service/ServiceAgent.h"
 #include "route/RouteModule.h"
+#include "monitor/PackageTracer.h"
+#include "internal/Packet.h"
 
 #include <asio/experimental/awaitable_operators.hpp>
 #include <spdlog/spdlog.h>
@@ -32,8 +34,8 @@ UPlayerAgent::UPlayerAgent(unique_ptr<IPackageCodec_Interface> &&codec)
     GetSocket().set_option(asio::ip::tcp::no_delay(true));
     GetSocket().set_option(asio::ip::tcp::socket::keep_alive(true));
 
-    // Define The Key
-    mKey = fmt::format("{}-{}", RemoteAddress().to_string(), utils::UnixTime());
+    // Define The Key, With The Port To Tell Apart The Connections From The Same Host In One Second
+    mKey = fmt::format("{}:{}-{}", RemoteAddress().to_string(), GetSocket().remote_endpoint().port(), utils::UnixTime());
 }
 
 UPlayerAgent::~UPlayerAgent() {
@@ -66,6 +68,18 @@ int64_t UPlayerAgent::GetPlayerID() const {
     return mPlayer->GetPlayerID();
 }
 
+std::string UPlayerAgent::GetAgentName() const {
+    return std::format("{}:{}", GetAgentKind(), GetActorID());
+}
+
+const char *UPlayerAgent::GetAgentKind() const {
+    return "player";
+}
+
+int64_t UPlayerAgent::GetActorID() const {
+    return GetPlayerID();
+}
+
 void UPlayerAgent::SetExpireSecond(const int sec) {
     mExpiration = std::chrono::seconds(sec);
 }
@@ -124,13 +138,16 @@ void UPlayerAgent::SetUpPlayer(FPlayerHandle &&plr) {
     if (!IsSocketOpen() || !mChannel.is_open())
         return;
 
-    if (!mPlayer)
+    if (mPlayer)
         throw std::runtime_error(std::format("{} - Other Player Already Exists", __FUNCTION__));
 
     // Assign The Player
     mPlayer = std::move(plr);
     mPlayer->SetUpAgent(this);
 
+    // The Client Of This Connection Holds Nothing Replicated Yet
+    mReplicator.Reset();
+
     mReceiveTime = std::chrono::steady_clock::now();
 
     co_spawn(mContext, [self = SharedFromThis()]() -> awaitable<void> {
@@ -145,6 +162,7 @@ void UPlayerAgent::SetUpPlayer(FPlayerHandle &&plr) {
 
         // Initial The Player Instance
         self->mPlayer->Initial();
+        self->mPlayer->OnLogin();
 
         // Start The Process Looping
         co_await self->ProcessChannel();
@@ -164,8 +182,14 @@ void UPlayerAgent::PostPackage(const FPackageHandle &pkg) const {
     if (!router)
         return;
 
-    pkg->SetSource(PLAYER_TARGET_ID);
-    router->PostPackage(pkg);
+    // Do Not Write The Header Of The Frozen Package, Others May Hold It
+    const auto delivery = PrepareDelivery(pkg);
+    if (delivery == nullptr)
+        return;
+
+    delivery->SetSource(PLAYER_TARGET_ID);
+    delivery->SetSenderPlayer(GetPlayerID());
+    router->PostPackage(delivery);
 }
 
 void UPlayerAgent::PostPackage(const std::string &name, const FPackageHandle &pkg) const {
@@ -176,8 +200,13 @@ void UPlayerAgent::PostPackage(const std::string &name, const FPackageHandle &pk
     if (!router)
         return;
 
-    pkg->SetSource(PLAYER_TARGET_ID);
-    router->PostPackage(name, pkg);
+    const auto delivery = PrepareDelivery(pkg);
+    if (delivery == nullptr)
+        return;
+
+    delivery->SetSource(PLAYER_TARGET_ID);
+    delivery->SetSenderPlayer(GetPlayerID());
+    router->PostPackage(name, delivery);
 }
 
 void UPlayerAgent::PostTask(const int64_t target, const AActorTask &task) const {
@@ -236,15 +265,49 @@ void UPlayerAgent::SendPackage(const FPackageHandle &pkg) {
     if (pkg == nullptr || pkg->GetTarget() != CLIENT_TARGET_ID)
         return;
 
-    if (const bool ret = mOutput.try_send_via_dispatch(std::error_code{}, pkg); !ret && mOutput.is_open()) {
+    UPackageTracer::Stamp(pkg.Get(), ETraceHop::REPLY);
+
+    if (const bool ret = mOutput.try_send_via_dispatch(std::error_code{}, pkg, nullptr); !ret && mOutput.is_open()) {
         co_spawn(mContext, [self = SharedFromThis(), pkg]() -> awaitable<void> {
-            co_await self->mOutput.async_send(std::error_code{}, pkg);
+            co_await self->mOutput.async_send(std::error_code{}, pkg, nullptr);
         }, detached);
     }
 }
 
+void UPlayerAgent::SendFrame(const AFrameBuffer &frame) {
+    if (frame == nullptr)
+        return;
+
+    if (const bool ret = mOutput.try_send_via_dispatch(std::error_code{}, FPackageHandle{}, frame); !ret && mOutput.is_open()) {
+        co_spawn(mContext, [self = SharedFromThis(), frame]() -> awaitable<void> {
+            co_await self->mOutput.async_send(std::error_code{}, FPackageHandle{}, frame);
+        }, detached);
+    }
+}
+
+void UPlayerAgent::Replicate(const std::vector<const UReplicaObject *> &objects, const FPackageHandle &pkg) {
+    const auto pkt = pkg.CastTo<FPacket>();
+    if (pkt == nullptr)
+        return;
+
+    std::string payload;
+    if (!mReplicator.Collect(objects, payload))
+        return;
+
+    pkt->SetPackageID(REPLICATION_PACKAGE_ID);
+    pkt->SetSource(SERVER_SOURCE_ID);
+    pkt->SetTarget(CLIENT_TARGET_ID);
+    pkt->SetData(payload);
+
+    SendPackage(pkg);
+}
+
+UReplicator &UPlayerAgent::GetReplicator() {
+    return mReplicator;
+}
+
 void UPlayerAgent::OnLoginFailed(const int code, const std::string &desc) {
-    if (mHandler != nullptr)
+    if (mHandler == nullptr)
         throw std::logic_error(std::format("{} - Handler Is Null Pointer", __FUNCTION__));
 
     bCachable = false;
@@ -264,7 +327,7 @@ void UPlayerAgent::OnLoginFailed(const int code, const std::string &desc) {
 }
 
 void UPlayerAgent::OnRepeated(const std::string &addr) {
-    if (mHandler != nullptr)
+    if (mHandler == nullptr)
         throw std::logic_error(std::format("{} - Handler Is Null Pointer", __FUNCTION__));
 
     // Do Not Recycle This Player Instance
@@ -302,12 +365,21 @@ weak_ptr<UPlayerAgent> UPlayerAgent::WeakFromThis() {
 awaitable<void> UPlayerAgent::WritePackage() {
     try {
         while (IsSocketOpen() && mOutput.is_open()) {
-            const auto [ec, pkg] = co_await mOutput.async_receive();
+            const auto [ec, pkg, frame] = co_await mOutput.async_receive();
             if (ec) {
                 Disconnect();
                 break;
             }
 
+            // The Broadcast Frame Is Already Framed, Only Pass Through The Stream
+            if (frame != nullptr) {
+                if (const auto ret = co_await mCodec->WriteFrame(frame); !ret) {
+                    Disconnect();
+                    break;
+                }
+                continue;
+            }
+
             if (pkg == nullptr || pkg->GetTarget() != CLIENT_TARGET_ID)
                 continue;
 
@@ -316,6 +388,17 @@ awaitable<void> UPlayerAgent::WritePackage() {
                 break;
             }
 
+            UPackageTracer::Finish(pkg.Get());
+
+            // The Stream Is Reliable And Ordered, The Client Holds The Replicated State Once Written
+            if (pkg->GetPackageID() == REPLICATION_PACKAGE_ID) {
+                if (const auto pkt = pkg.CastTo<FPacket>()) {
+                    if (const auto sequence = UReplicator::ReadSequence(pkt->RawPayload())) {
+                        mReplicator.Acknowledge(*sequence);
+                    }
+                }
+            }
+
             // Can Do Something Here
 
             // If Send The Below Protocol, Disconnect The Socket
@@ -343,6 +426,8 @@ awaitable<void> UPlayerAgent::ReadPackage() {
                 break;
             }
 
+            UPackageTracer::Begin(pkg.Get());
+
             const auto now = std::chrono::steady_clock::now();
 
             // Run The Login Branch
@@ -371,8 +456,15 @@ awaitable<void> UPlayerAgent::ReadPackage() {
                 } break;
                 default: {
                     if (const auto target = pkg->GetTarget(); target == PLAYER_TARGET_ID) {
-                        // Run Directly
-                        mPlayer->OnPackage(pkg.Get());
+                        // Run Directly Under The Executing Flag, Behind The Nodes Still Waiting In The Channel
+                        const bool bDirect = ExecuteExclusive(EChannelNodeType::PACKAGE, pkg->GetPackageID(), [&pkg](IActorBase *pActor) {
+                            UPackageTracer::FHandleScope scope(pkg.Get());
+                            pActor->OnPackage(pkg.Get());
+                        });
+
+                        if (!bDirect) {
+                            PushPackage(pkg);
+                        }
                     } else if (target > 0) {
                         // Post Package To Service
                         PostPackage(pkg);
@@ -2,6 +2,7 @@
 
 #include "AgentBase.h"
 #include "factory/PlayerHandle.h"
+#include "replication/Replicator.h"
 
 
 class IAgentHandler;
@@ -15,7 +16,8 @@ class IPackageCodec_Interface;
  */
 class BASE_API UPlayerAgent final : public IAgentBase {
 
-    using APackageChannel = TConcurrentChannel<void(std::error_code, FPackageHandle)>;
+    /** Either The Package To Encode Or The Prebuilt Frame Of A Broadcast **/
+    using APackageChannel = TConcurrentChannel<void(std::error_code, FPackageHandle, AFrameBuffer)>;
 
     /** The Socket Inside, Use To Read/Write Package Data **/
     unique_ptr<IPackageCodec_Interface> mCodec;
@@ -38,6 +40,9 @@ class BASE_API UPlayerAgent final : public IAgentBase {
     /** The Inner Player Instance **/
     FPlayerHandle mPlayer;
 
+    /** The Replicated State The Client Holds, Acknowledged Once The Package Is Written **/
+    UReplicator mReplicator;
+
     /** The Unique Key To The Socket, Use Before Player Login **/
     std::string mKey;
 
@@ -48,6 +53,8 @@ class BASE_API UPlayerAgent final : public IAgentBase {
     bool bRepeated;
 
 public:
+    DECLARE_TYPE_TAG(UPlayerAgent, type_tag::PLAYER_AGENT, IAgentBase)
+
     explicit UPlayerAgent(unique_ptr<IPackageCodec_Interface> &&codec);
     ~UPlayerAgent() override;
 
@@ -80,6 +87,10 @@ public:
     /// Get The Player ID After Player Login
     [[nodiscard]] int64_t GetPlayerID() const;
 
+    [[nodiscard]] std::string GetAgentName() const override;
+    [[nodiscard]] const char *GetAgentKind() const override;
+    [[nodiscard]] int64_t GetActorID() const override;
+
     /// Move The Player Instance From This Agent
     [[nodiscard]] FPlayerHandle ExtractPlayer();
 
@@ -107,6 +118,15 @@ public:
     /// Send Package To Client
     void SendPackage(const FPackageHandle &pkg);
 
+    /// Send The Frame Shared With Other Agents To Client, Written Without Encoding Again
+    void SendFrame(const AFrameBuffer &frame);
+
+    /// Send The Deltas Of The Objects Against The State The Client Holds, Nothing Sent If None Changed;
+    /// Thread Safe, The Package Is Built By The Caller In Its Own Agent
+    void Replicate(const std::vector<const UReplicaObject *> &objects, const FPackageHandle &pkg);
+
+    [[nodiscard]] UReplicator &GetReplicator();
+
     /// Handle Fail To Login
     void OnLoginFailed(int code, const std::string &desc);
 
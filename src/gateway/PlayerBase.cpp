@@ -30,14 +30,37 @@ void IPlayerBase::Save() {
 void IPlayerBase::OnReset() {
 }
 
+FPackageHandle IPlayerBase::BuildPackage() const {
+    return GetAgent()->BuildPackage();
+}
+
 void IPlayerBase::SendPackage(const FPackageHandle &pkg) const {
     if (pkg == nullptr)
         return;
 
-    pkg->SetSource(PLAYER_TARGET_ID);
-    pkg->SetTarget(CLIENT_TARGET_ID);
+    auto *agent = GetAgentT<UPlayerAgent>();
+
+    // Do Not Write The Header Of The Frozen Package, Others May Hold It
+    const auto delivery = agent->PrepareDelivery(pkg);
+    if (delivery == nullptr)
+        return;
+
+    delivery->SetSource(PLAYER_TARGET_ID);
+    delivery->SetTarget(CLIENT_TARGET_ID);
+
+    agent->SendPackage(delivery);
+}
+
+void IPlayerBase::Replicate(const std::vector<const UReplicaObject *> &objects) const {
+    if (objects.empty())
+        return;
+
+    auto *agent = GetAgentT<UPlayerAgent>();
+    agent->Replicate(objects, agent->BuildPackage());
+}
 
-    GetAgentT<UPlayerAgent>()->SendPackage(pkg);
+void IPlayerBase::ForgetReplica(const int64_t id) const {
+    GetAgentT<UPlayerAgent>()->GetReplicator().Forget(id);
 }
 
 void IPlayerBase::PostPackage(const FPackageHandle &pkg) const {
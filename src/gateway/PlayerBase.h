@@ -4,6 +4,7 @@
 #include "timer/TimerHandle.h"
 
 #include <functional>
+#include <vector>
 
 class UServer;
 class UPlayerAgent;
@@ -11,6 +12,7 @@ class IServiceBase;
 class IPackage_Interface;
 class IDataAsset_Interface;
 class IEventParam_Interface;
+class UReplicaObject;
 
 using AActorTask = std::function<void(IActorBase *)>;
 
@@ -27,6 +29,8 @@ class BASE_API IPlayerBase : public IActorBase {
     int64_t mPlayerID;
 
 public:
+    DECLARE_TYPE_TAG(IPlayerBase, type_tag::PLAYER, IActorBase)
+
     IPlayerBase();
     ~IPlayerBase() override;
 
@@ -40,9 +44,18 @@ public:
     virtual void Save();
     virtual void OnReset();
 
+    /// Return A Package Handle From Agent
+    [[nodiscard]] FPackageHandle BuildPackage() const;
+
     /// Send Package To The Client
     void SendPackage(const FPackageHandle &pkg) const;
 
+    /// Send The Deltas Of The Objects To The Client, Nothing Sent If None Changed
+    void Replicate(const std::vector<const UReplicaObject *> &objects) const;
+
+    /// The Object Is Removed From The Client, Sent In Full If It Comes Back
+    void ForgetReplica(int64_t id) const;
+
     /// Send Package To Service With Set Target In Package
     void PostPackage(const FPackageHandle &pkg) const;
 
@@ -86,7 +99,7 @@ private:
 template<class Type, class Callback, class ... Args> requires std::derived_from<Type, IServiceBase>
 inline void IPlayerBase::PostTaskT(const int64_t target, Callback &&func, Args &&...args) {
     auto task = [func = std::forward<Callback>(func), ...args = std::forward<Args>(args)](IActorBase *pActor) {
-        if (auto *pService = dynamic_cast<Type *>(pActor)) {
+        if (auto *pService = TagCast<Type>(pActor)) {
             std::invoke(func, pService, std::forward<Args>(args)...);
         }
     };
@@ -97,7 +110,7 @@ inline void IPlayerBase::PostTaskT(const int64_t target, Callback &&func, Args &
 template<class Type, class Callback, class ... Args> requires std::derived_from<Type, IServiceBase>
 inline void IPlayerBase::PostTaskT(const std::string &name, Callback &&func, Args &&...args) {
     auto task = [func = std::forward<Callback>(func), ...args = std::forward<Args>(args)](IActorBase *pActor) {
-        if (auto *pService = dynamic_cast<Type *>(pActor)) {
+        if (auto *pService = TagCast<Type>(pActor)) {
             std::invoke(func, pService, std::forward<Args>(args)...);
         }
     };
@@ -29,3 +29,31 @@ IPackageCodec_Interface *UCodecFactory::CreatePackageCodec(ATcpSocket socket) {
 IRecyclerBase *UCodecFactory::CreatePackagePool(asio::io_context &ctx) {
     return IRecyclerBase::Create<FPacket>(ctx);
 }
+
+AFrameBuffer UCodecFactory::EncodeFrame(IPackage_Interface *pkg) const {
+    if (const auto *pkt = TagCast<FPacket>(pkg))
+        return UPacketCodec::EncodeFrame(pkt);
+    return nullptr;
+}
+
+unique_ptr<IPackageCodec_Interface> UPlainCodecFactory::CreateUniquePackageCodec(ATcpSocket socket) {
+    return make_unique<UPlainPacketCodec>(std::move(socket));
+}
+
+unique_ptr<IRecyclerBase> UPlainCodecFactory::CreateUniquePackagePool(asio::io_context &ctx) {
+    return IRecyclerBase::CreateUnique<FPacket>(ctx);
+}
+
+IPackageCodec_Interface *UPlainCodecFactory::CreatePackageCodec(ATcpSocket socket) {
+    return new UPlainPacketCodec(std::move(socket));
+}
+
+IRecyclerBase *UPlainCodecFactory::CreatePackagePool(asio::io_context &ctx) {
+    return IRecyclerBase::Create<FPacket>(ctx);
+}
+
+AFrameBuffer UPlainCodecFactory::EncodeFrame(IPackage_Interface *pkg) const {
+    if (const auto *pkt = TagCast<FPacket>(pkg))
+        return UPlainPacketCodec::EncodeFrame(pkt);
+    return nullptr;
+}
@@ -19,4 +19,25 @@ public:
 
     IPackageCodec_Interface *CreatePackageCodec(ATcpSocket socket) override;
     IRecyclerBase *CreatePackagePool(asio::io_context &ctx) override;
+
+    [[nodiscard]] AFrameBuffer EncodeFrame(IPackage_Interface *pkg) const override;
+};
+
+
+/**
+ * Frame The Packets Over The Plain TCP Socket, Without TLS;
+ * Only For The Trusted Network, Such As Behind A TLS Terminating Proxy Or In The Benchmark
+ */
+class BASE_API UPlainCodecFactory final : public ICodecFactory_Interface {
+
+public:
+    UPlainCodecFactory() = default;
+
+    unique_ptr<IPackageCodec_Interface> CreateUniquePackageCodec(ATcpSocket socket) override;
+    unique_ptr<IRecyclerBase> CreateUniquePackagePool(asio::io_context &ctx) override;
+
+    IPackageCodec_Interface *CreatePackageCodec(ATcpSocket socket) override;
+    IRecyclerBase *CreatePackagePool(asio::io_context &ctx) override;
+
+    [[nodiscard]] AFrameBuffer EncodeFrame(IPackage_Interface *pkg) const override;
 };
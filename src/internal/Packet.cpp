@@ -8,7 +8,8 @@
 inline constexpr int PACKET_MAGIC = 20250514;
 
 FPacket::FPacket()
-    : mHeader() {
+    : mHeader(),
+      mSenderPlayer(-1) {
     memset(&mHeader, 0, sizeof(mHeader));
 }
 
@@ -27,21 +28,51 @@ void FPacket::Initial() {
     mHeader.id = MINIMUM_PACKAGE_ID - 1;
     mHeader.source = -1;
     mHeader.target = -1;
+
+    mTrace.Reset();
+    mSenderPlayer = -1;
 }
 
 void FPacket::Clear() {
     mHeader.id = 0;
     mPayload.Clear();
+    mShared.reset();
+
+    ResetDecoded();
+}
+
+void FPacket::FDecodeCache::Reset() {
+    mDecoded.store(nullptr, std::memory_order_relaxed);
+
+    // Also Drop The Message Failed To Parse, The Initial Block Is Kept For The Next Decode
+    if (mArena != nullptr) {
+        mArena->Reset();
+    }
+}
+
+void FPacket::ResetDecoded() {
+    // The Shared Cache Stays, Its Payload Never Changes
+    mDecodeCache.Reset();
 }
 
 bool FPacket::CopyFrom(IRecycle_Interface *other) {
     if (IRecycle_Interface::CopyFrom(other)) {
-        if (const auto temp = dynamic_cast<FPacket *>(other); temp != nullptr) {
+        if (const auto temp = TagCast<FPacket>(other); temp != nullptr) {
             memcpy(&mHeader, &temp->mHeader, sizeof(mHeader));
+            mSenderPlayer = temp->mSenderPlayer;
+
+            // The Frozen Payload Is Shared Instead Of Copied
+            mShared = temp->mShared;
+            if (mShared == nullptr) {
+                mPayload = temp->mPayload;
+            } else {
+                mPayload.Clear();
+            }
 
-            mPayload = temp->mPayload;
             mHeader.length = temp->mHeader.length;
 
+            ResetDecoded();
+
             return true;
         }
     }
@@ -64,7 +95,11 @@ bool FPacket::CopyFrom(IRecycle_Interface *other) {
 
 void FPacket::Reset() {
     memset(&mHeader, 0, sizeof(mHeader));
+    mSenderPlayer = -1;
     mPayload.Reset();
+    mShared.reset();
+
+    ResetDecoded();
 }
 
 bool FPacket::IsAvailable() const {
@@ -80,7 +115,10 @@ void FPacket::SetPackageID(const uint32_t id) {
 
 FPacket &FPacket::SetData(const std::string_view str) {
     mHeader.length = str.size();
+    mShared.reset();
     mPayload.FromString(str);
+
+    ResetDecoded();
     return *this;
 }
 
@@ -102,7 +140,7 @@ uint32_t FPacket::GetPackageID() const {
 }
 
 size_t FPacket::GetPayloadLength() const {
-    return mPayload.Size();
+    return RawPayload().Size();
 }
 
 void FPacket::SetSource(const int32_t source) {
@@ -121,14 +159,66 @@ int32_t FPacket::GetTarget() const {
     return mHeader.target;
 }
 
+void FPacket::SetSenderPlayer(const int64_t pid) {
+    mSenderPlayer = pid;
+}
+
+int64_t FPacket::GetSenderPlayer() const {
+    return mSenderPlayer;
+}
+
+FPackageTrace *FPacket::GetTrace() {
+    return &mTrace;
+}
+
+void FPacket::Freeze() {
+    if (mShared != nullptr)
+        return;
+
+    mShared = std::make_shared<FSharedPayload>(std::move(mPayload));
+    mPayload.Clear();
+}
+
+bool FPacket::IsFrozen() const {
+    return mShared != nullptr;
+}
+
+bool FPacket::ShareFrom(IPackage_Interface *other) {
+    auto *temp = TagCast<FPacket>(other);
+    if (temp == nullptr)
+        return false;
+
+    if (temp == this)
+        return true;
+
+    temp->Freeze();
+
+    memcpy(&mHeader, &temp->mHeader, sizeof(mHeader));
+    mSenderPlayer = temp->mSenderPlayer;
+
+    mShared = temp->mShared;
+    mPayload.Clear();
+
+    ResetDecoded();
+    return true;
+}
+
 std::string FPacket::ToString() const {
-    return mPayload.ToString();
+    return RawPayload().ToString();
 }
 
 const FByteArray &FPacket::RawPayload() const {
-    return mPayload;
+    return mShared != nullptr ? mShared->bytes : mPayload;
 }
 
 std::vector<uint8_t> &FPacket::RawRef() {
+    // Copy On Write, The Shared Payload Is Never Changed
+    if (mShared != nullptr) {
+        mPayload = mShared->bytes;
+        mShared.reset();
+    }
+
+    // The Caller Is Going To Write The Payload
+    ResetDecoded();
     return mPayload.RawRef();
 }
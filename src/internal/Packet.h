@@ -4,7 +4,13 @@
 #include "base/Package.h"
 #include "base/ByteArray.h"
 
+#include <google/protobuf/arena.h>
+#include <google/protobuf/message_lite.h>
+
 #include <sstream>
+#include <memory>
+#include <atomic>
+#include <mutex>
 
 
 // Define Minimum And Maximum Available Package ID
@@ -20,7 +26,7 @@ inline constexpr uint32_t MAXIMUM_PACKAGE_ID = 999999;
  */
 class BASE_API FPacket final : public IRecycle_Interface, public IPackage_Interface {
 
-    friend class UPacketCodec;
+    template<class> friend class TPacketCodec;
 
     /// Packet Header Define
     struct FHeader {
@@ -33,15 +39,65 @@ class BASE_API FPacket final : public IRecycle_Interface, public IPackage_Interf
         size_t length;
     };
 
+    /// The Decoded Message And The Tag Of Its Type
+    struct FDecoded {
+        const void *type;
+        const google::protobuf::MessageLite *message;
+    };
+
+    /** The Arena Holding The Messages Decoded From One Payload, The Latest Of Them Cached **/
+    class FDecodeCache {
+
+        /** The Block Must Outlive The Arena, Keep It Declared Before **/
+        std::unique_ptr<char[]>                     mArenaBlock;
+        std::unique_ptr<google::protobuf::Arena>    mArena;
+
+        std::atomic<const FDecoded *>   mDecoded{nullptr};
+        std::mutex                      mMutex;
+
+    public:
+        /// Parse Once Per Type, Thread Safe. Null If Failed To Parse
+        template<class Message>
+        const Message *Decode(const FByteArray &payload);
+
+        /// Drop The Decoded Messages, The Initial Block Is Kept For The Next Decode
+        void Reset();
+    };
+
+    /** The Frozen Payload And The Messages Decoded From It, Shared By All The Forks **/
+    struct FSharedPayload {
+        const FByteArray bytes;
+        FDecodeCache cache;
+
+        explicit FSharedPayload(FByteArray &&payload)
+            : bytes(std::move(payload)) {
+        }
+    };
+
     FHeader         mHeader;
     FByteArray      mPayload;
 
+    /** The Frozen Payload Shared With The Forked Packets, Replaces mPayload While Not Null **/
+    std::shared_ptr<FSharedPayload> mShared;
+
+    /** Only In Memory, Never Encoded **/
+    FPackageTrace   mTrace;
+    int64_t         mSenderPlayer;
+
+    /** Decoded From The Own Payload, Reset When Recycled Or Written; The Shared One Decodes Into Its Own Cache **/
+    FDecodeCache    mDecodeCache;
+
+    /// Drop The Message Decoded From The Own Payload, Called Whenever It Changes
+    void ResetDecoded();
+
 protected:
     void OnCreate() override;
     void Initial() override;
     void Clear() override;
 
 public:
+    DECLARE_TYPE_TAG(FPacket, type_tag::PACKET, IRecycle_Interface, IPackage_Interface)
+
     FPacket();
     ~FPacket() override;
 
@@ -70,9 +126,78 @@ public:
     void SetTarget(int32_t target) override;
     [[nodiscard]] int32_t GetTarget() const override;
 
+    void SetSenderPlayer(int64_t pid) override;
+    [[nodiscard]] int64_t GetSenderPlayer() const override;
+
+    [[nodiscard]] FPackageTrace *GetTrace() override;
+
+    void Freeze() override;
+    [[nodiscard]] bool IsFrozen() const override;
+
+    bool ShareFrom(IPackage_Interface *other) override;
+
     [[nodiscard]] std::string ToString() const;
+    /// The Payload Own Or Shared, Read Only
     [[nodiscard]] const FByteArray &RawPayload() const;
+
+    /// Copy The Shared Payload Before Write If Frozen, The Other Forks Are Not Affected
     [[nodiscard]] std::vector<uint8_t> &RawRef();
 
+    /// Decode The Payload Once Into The Arena, The Later Calls With The Same Type Return The Same Message;
+    /// Thread Safe. The Frozen Payload Is Decoded Into The Cache Shared With It,
+    /// So The Forks Multicast To Many Receivers Parse Only Once In All. Null If Failed To Parse
+    template<class Message>
+    requires std::derived_from<Message, google::protobuf::MessageLite>
+    const Message *Decode();
+
     static constexpr size_t PACKAGE_HEADER_SIZE = sizeof(FHeader);
+
+    /** The First Block Of The Arena, Enough For The Most Of The Request Messages **/
+    static constexpr size_t ARENA_INITIAL_BLOCK_SIZE = 512;
 };
+
+
+template<class Message>
+requires std::derived_from<Message, google::protobuf::MessageLite>
+const Message *FPacket::Decode() {
+    if (mShared != nullptr)
+        return mShared->cache.Decode<Message>(mShared->bytes);
+
+    return mDecodeCache.Decode<Message>(mPayload);
+}
+
+template<class Message>
+const Message *FPacket::FDecodeCache::Decode(const FByteArray &payload) {
+    // The Default Instance Is Unique Per Message Type,
+    // A Mismatch Across The Shared Libraries Only Costs Another Parse
+    const void *type = &Message::default_instance();
+
+    if (const auto *decoded = mDecoded.load(std::memory_order_acquire); decoded != nullptr && decoded->type == type)
+        return static_cast<const Message *>(decoded->message);
+
+    std::unique_lock lock(mMutex);
+
+    // Another Receiver May Decode It While Waiting For The Lock
+    if (const auto *decoded = mDecoded.load(std::memory_order_relaxed); decoded != nullptr && decoded->type == type)
+        return static_cast<const Message *>(decoded->message);
+
+    if (mArena == nullptr) {
+        mArenaBlock = std::make_unique<char[]>(ARENA_INITIAL_BLOCK_SIZE);
+
+        google::protobuf::ArenaOptions options;
+        options.initial_block = mArenaBlock.get();
+        options.initial_block_size = ARENA_INITIAL_BLOCK_SIZE;
+
+        mArena = std::make_unique<google::protobuf::Arena>(options);
+    }
+
+    auto *message = google::protobuf::Arena::Create<Message>(mArena.get());
+    if (!message->ParseFromArray(payload.Data(), static_cast<int>(payload.Size())))
+        return nullptr;
+
+    // The Previous Message Of Another Type Stays In The Arena Until Reset, Its Readers Are Still Safe
+    const auto *decoded = google::protobuf::Arena::Create<FDecoded>(mArena.get(), type, message);
+    mDecoded.store(decoded, std::memory_order_release);
+
+    return message;
+}
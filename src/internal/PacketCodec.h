@@ -5,25 +5,247 @@
 #include "Packet.h"
 
 #include <asio/ssl/stream.hpp>
+#include <spdlog/spdlog.h>
+#if defined(_WIN32) || defined(_WIN64)
+#include <winsock2.h>
+#else
+#include <arpa/inet.h>
+#include <endian.h>
+#endif
 
 
-class BASE_API UPacketCodec final : public TPackageCodec<FPacket> {
+using ASslStream = asio::ssl::stream<ATcpSocket>;
 
-    using ASslStream = asio::ssl::stream<ATcpSocket>;
 
-    ASslStream mStream;
+/** The Side Of The Connection, Decides The Role In The TLS Handshake **/
+enum class ECodecSide {
+    SERVER,
+    CLIENT
+};
+
+
+/**
+ * The Framing Of FPacket Over A Byte Stream;
+ * The TLS Stream Is Used For The Game Clients,
+ * The Plain Socket For The Trusted Network And The Load Generator;
+ * Any Other Stream Must Provide next_layer() That Returns The ATcpSocket
+ */
+template<class Stream>
+class TPacketCodec final : public TPackageCodec<FPacket> {
+
+    Stream mStream;
+    ECodecSide mSide;
+
+    /** Refuse To Read Or Write The Longer Payload **/
+    static constexpr size_t MAXIMUM_PAYLOAD_LENGTH = 4096 * 1024;
+
+    /// The Header In Network Byte Order
+    static FPacket::FHeader ToNetworkHeader(const FPacket::FHeader &src);
 
 public:
-    UPacketCodec() = delete;
+    TPacketCodec() = delete;
 
-    explicit UPacketCodec(ASslStream stream);
-    ~UPacketCodec() override = default;
+    explicit TPacketCodec(Stream stream, ECodecSide side = ECodecSide::SERVER);
+    ~TPacketCodec() override = default;
 
     awaitable<bool> Initial() override;
 
     awaitable<bool> EncodeT(FPacket *pkg) override;
     awaitable<bool> DecodeT(FPacket *pkg) override;
 
+    awaitable<bool> WriteFrame(const AFrameBuffer &frame) override;
+
+    /// Frame The Packet Once, The Same Bytes As EncodeT Writes; Null If The Payload Is Too Long
+    static AFrameBuffer EncodeFrame(const FPacket *pkg);
+
     ATcpSocket &GetSocket() override;
 };
 
+template<class Stream>
+TPacketCodec<Stream>::TPacketCodec(Stream stream, const ECodecSide side)
+    : mStream(std::move(stream)),
+      mSide(side) {
+}
+
+template<class Stream>
+awaitable<bool> TPacketCodec<Stream>::Initial() {
+    // The Plain Socket Is Ready Once Connected
+    if constexpr (std::is_same_v<Stream, ASslStream>) {
+        const auto type = mSide == ECodecSide::SERVER ? asio::ssl::stream_base::server : asio::ssl::stream_base::client;
+        if (const auto [ec] = co_await mStream.async_handshake(type); ec) {
+            SPDLOG_ERROR("Connection[{}] Handshake Failed: {}",
+                mStream.next_layer().remote_endpoint().address().to_string(), ec.message());
+            co_return false;
+        }
+    }
+    co_return true;
+}
+
+template<class Stream>
+FPacket::FHeader TPacketCodec<Stream>::ToNetworkHeader(const FPacket::FHeader &src) {
+    FPacket::FHeader header{};
+    memset(&header, 0, sizeof(FPacket::FHeader));
+
+    header.magic = htonl(src.magic);
+    header.id = htonl(src.id);
+
+    header.source = static_cast<int32_t>(htonl(src.source));
+    header.target = static_cast<int32_t>(htonl(src.target));
+
+#if defined(_WIN32) || defined(_WIN64)
+    header.length = htonll(src.length);
+#else
+    header.length = htobe64(src.length);
+#endif
+
+    return header;
+}
+
+template<class Stream>
+awaitable<bool> TPacketCodec<Stream>::EncodeT(FPacket *pkg) {
+    const auto header = ToNetworkHeader(pkg->mHeader);
+
+    if (pkg->mHeader.length <= 0) {
+        const auto [ec, len] = co_await async_write(mStream, asio::buffer(&header, FPacket::PACKAGE_HEADER_SIZE));
+
+        if (ec) {
+            SPDLOG_WARN("{:<20} - Failed To Write Packet Header, Error Code: {}", __FUNCTION__, ec.message());
+            co_return false;
+        }
+
+        if (len != FPacket::PACKAGE_HEADER_SIZE) {
+            SPDLOG_WARN("{:<20} - Length Of Written Packet Header Incorrect, {}", __FUNCTION__, len);
+            co_return false;
+        }
+
+        co_return true;
+    }
+
+    if (pkg->mHeader.length > MAXIMUM_PAYLOAD_LENGTH)
+        co_return false;
+
+    const auto buffers = {
+        asio::buffer(&header, FPacket::PACKAGE_HEADER_SIZE),
+        asio::buffer(pkg->RawPayload().Data(), pkg->RawPayload().Size()),
+    };
+
+    const auto [ec, len] = co_await async_write(mStream, buffers);
+
+    if (ec) {
+        SPDLOG_WARN("{:<20} - Failed To Write Packet, Error Code: {}", __FUNCTION__, ec.message());
+        co_return false;
+    }
+
+    if (len <= FPacket::PACKAGE_HEADER_SIZE) {
+        SPDLOG_WARN("{:<20} - Length Of Written Packet Incorrect, {}", __FUNCTION__, len);
+        co_return false;
+    }
+
+    co_return true;
+}
+
+template<class Stream>
+awaitable<bool> TPacketCodec<Stream>::DecodeT(FPacket *pkg) {
+    if (const auto [ec, len] = co_await async_read(mStream, asio::buffer(&pkg->mHeader, FPacket::PACKAGE_HEADER_SIZE));
+        ec || len == 0) {
+        if (ec) {
+            SPDLOG_WARN("{:<20} -  Failed To Read Packet Header, Error Code: {}", __FUNCTION__, ec.message());
+            co_return false;
+        }
+
+        if (len != FPacket::PACKAGE_HEADER_SIZE) {
+            SPDLOG_WARN("{:<20} - Length Of Read Packet Header Incorrect, {}", __FUNCTION__, len);
+            co_return false;
+        }
+    }
+
+    pkg->mHeader.magic = ntohl(pkg->mHeader.magic);
+    pkg->mHeader.id = ntohl(pkg->mHeader.id);
+
+    pkg->mHeader.source = static_cast<int32_t>(ntohl(pkg->mHeader.source));
+    pkg->mHeader.target = static_cast<int32_t>(ntohl(pkg->mHeader.target));
+
+#if defined(_WIN32) || defined(_WIN64)
+    pkg->mHeader.length = ntohll(pkg->mHeader.length);
+#else
+    pkg->mHeader.length = be64toh(pkg->mHeader.length);
+#endif
+
+    if (pkg->mHeader.length <= 0)
+        co_return true;
+
+    // Payload Too Long
+    if (pkg->mHeader.length > MAXIMUM_PAYLOAD_LENGTH)
+        co_return false;
+
+    auto &payload = pkg->RawRef();
+    payload.resize(pkg->mHeader.length);
+
+    const auto [ec, len] = co_await async_read(mStream, asio::buffer(payload));
+
+    if (ec) {
+        SPDLOG_WARN("{:<20} - Failed To Read Packet, Error Code: {}", __FUNCTION__, ec.message());
+        co_return false;
+    }
+
+    if (len < pkg->mHeader.length) {
+        SPDLOG_WARN("{:<20} - Length Of Read Packet Incorrect, {}", __FUNCTION__, len);
+        co_return false;
+    }
+
+    co_return true;
+}
+
+template<class Stream>
+awaitable<bool> TPacketCodec<Stream>::WriteFrame(const AFrameBuffer &frame) {
+    if (frame == nullptr || frame->size() < FPacket::PACKAGE_HEADER_SIZE)
+        co_return false;
+
+    // The Frame Is Kept Alive By The Caller Until Written
+    const auto [ec, len] = co_await async_write(mStream, asio::buffer(*frame));
+
+    if (ec) {
+        SPDLOG_WARN("{:<20} - Failed To Write Frame, Error Code: {}", __FUNCTION__, ec.message());
+        co_return false;
+    }
+
+    if (len != frame->size()) {
+        SPDLOG_WARN("{:<20} - Length Of Written Frame Incorrect, {}", __FUNCTION__, len);
+        co_return false;
+    }
+
+    co_return true;
+}
+
+template<class Stream>
+AFrameBuffer TPacketCodec<Stream>::EncodeFrame(const FPacket *pkg) {
+    if (pkg == nullptr || pkg->mHeader.length > MAXIMUM_PAYLOAD_LENGTH)
+        return nullptr;
+
+    const auto header = ToNetworkHeader(pkg->mHeader);
+    const auto &payload = pkg->RawPayload();
+
+    auto frame = std::make_shared<std::vector<uint8_t>>(FPacket::PACKAGE_HEADER_SIZE + payload.Size());
+    memcpy(frame->data(), &header, FPacket::PACKAGE_HEADER_SIZE);
+
+    if (payload.Size() > 0) {
+        memcpy(frame->data() + FPacket::PACKAGE_HEADER_SIZE, payload.Data(), payload.Size());
+    }
+
+    return frame;
+}
+
+template<class Stream>
+ATcpSocket &TPacketCodec<Stream>::GetSocket() {
+    if constexpr (std::is_same_v<Stream, ATcpSocket>) {
+        return mStream;
+    } else {
+        return mStream.next_layer();
+    }
+}
+
+using UPacketCodec = TPacketCodec<ASslStream>;
+using UPlainPacketCodec = TPacketCodec<ATcpSocket>;
+
+extern template class BASE_API TPacketCodec<ASslStream>;
+extern template class BASE_API TPacketCodec<ATcpSocket>;
@@ -1,4 +1,5 @@
 #include "PlayerFactory.h"
+#include "base/TypeTag.h"
 
 #include <spdlog/spdlog.h>
 
@@ -25,6 +26,7 @@ void UPlayerFactory::Initial() {
         exit(-1);
     }
 
+    const auto conflicts = type_tag::GetConflictCount();
     mLibrary = FSharedLibrary(agent);
 
     if (!mLibrary.IsValid()) {
@@ -32,6 +34,11 @@ void UPlayerFactory::Initial() {
         exit(-1);
     }
 
+    if (type_tag::GetConflictCount() != conflicts) {
+        SPDLOG_CRITICAL("{} - Player Library Declares A Conflicting Type Tag", __FUNCTION__);
+        exit(-1);
+    }
+
     mCreator = mLibrary.GetSymbol<APlayerCreator>("CreatePlayer");
     if (!mCreator) {
         SPDLOG_CRITICAL("{} - Failed To Load Player Creator", __FUNCTION__);
@@ -1,5 +1,6 @@
 #include "ServiceFactory.h"
 #include "service/ServiceBase.h"
+#include "base/TypeTag.h"
 #include "Utils.h"
 
 #include <filesystem>
@@ -21,6 +22,7 @@ void UServiceFactory::LoadService() {
                 filename.erase(0, strlen(LINUX_LIBRARY_PREFIX));
             }
 #endif
+            const auto conflicts = type_tag::GetConflictCount();
             FSharedLibrary library(entry.path());
 
             if (!library.IsValid()) {
@@ -28,6 +30,12 @@ void UServiceFactory::LoadService() {
                 continue;
             }
 
+            // Its Classes Registered In The Static Initializer, TagCast Would Return The Wrong One
+            if (type_tag::GetConflictCount() != conflicts) {
+                SPDLOG_ERROR("{} - Core Library[{}] Declares A Conflicting Type Tag, Refused", __FUNCTION__, entry.path().string());
+                continue;
+            }
+
             const auto creator = library.GetSymbol<AServiceCreator>("CreateInstance");
             const auto destroyer = library.GetSymbol<AServiceDestroyer>("DestroyInstance");
 
@@ -51,6 +59,7 @@ void UServiceFactory::LoadService() {
                 filename.erase(0, strlen(LINUX_LIBRARY_PREFIX));
             }
 #endif
+            const auto conflicts = type_tag::GetConflictCount();
             FSharedLibrary library(entry.path());
 
             if (!library.IsValid()) {
@@ -58,6 +67,12 @@ void UServiceFactory::LoadService() {
                 continue;
             }
 
+            // Its Classes Registered In The Static Initializer, TagCast Would Return The Wrong One
+            if (type_tag::GetConflictCount() != conflicts) {
+                SPDLOG_ERROR("{} - Extend Library[{}] Declares A Conflicting Type Tag, Refused", __FUNCTION__, entry.path().string());
+                continue;
+            }
+
             const auto creator = library.GetSymbol<AServiceCreator>("CreateInstance");
             const auto destroyer = library.GetSymbol<AServiceDestroyer>("DestroyInstance");
 
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+
+/**
+ * The Layout Of The Binary Log File, Shared By The Writer And The Offline Decoder.
+ *
+ * File    : Magic(4) Version(u32) NameLength(u16) Name
+ * Entry   : Tag(u8) Body
+ *   'F'   : FormatID(u32) Level(u8) Line(u32) FileLength(u16) File FormatLength(u32) Format
+ *   'R'   : The Raw Record Copied From The Ring
+ *
+ * Record  : Size(u32) LoggerID(u32) FormatID(u32) ArgCount(u8) Timestamp(i64, Nanoseconds Since Epoch) Args
+ * Arg     : Type(u8) Value, String Value Is Length(u32) Bytes
+ *
+ * All The Integers Are Written In Native Byte Order
+ */
+namespace binary_log {
+
+    inline constexpr char FILE_MAGIC[4] = { 'U', 'B', 'L', 'G' };
+    inline constexpr uint32_t FILE_VERSION = 1;
+
+    inline constexpr uint8_t ENTRY_FORMAT = 'F';
+    inline constexpr uint8_t ENTRY_RECORD = 'R';
+
+    inline constexpr size_t RECORD_HEADER_SIZE = sizeof(uint32_t) * 3 + sizeof(uint8_t) + sizeof(int64_t);
+
+    enum class EArgType : uint8_t {
+        INT64 = 1,
+        UINT64,
+        DOUBLE,
+        BOOL,
+        CHAR,
+        STRING,
+    };
+
+    /// Read A Trivial Value From The Unaligned Buffer
+    template<class T>
+    T ReadValue(const uint8_t *data) {
+        T val;
+        std::memcpy(&val, data, sizeof(T));
+        return val;
+    }
+
+    /// Write A Trivial Value To The Unaligned Buffer And Return The Next Position
+    template<class T>
+    uint8_t *WriteValue(uint8_t *data, const T &val) {
+        std::memcpy(data, &val, sizeof(T));
+        return data + sizeof(T);
+    }
+}
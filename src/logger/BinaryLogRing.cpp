@@ -0,0 +1,98 @@
+#include "BinaryLogRing.h"
+#include "BinaryLogFormat.h"
+
+#include <bit>
+
+
+// The Record Size Zero Means Skip To The Ring End
+inline constexpr uint32_t WRAP_MARKER = 0;
+
+
+UBinaryLogRing::UBinaryLogRing(const size_t capacity)
+    : mBuffer(std::bit_ceil(std::max<size_t>(capacity, 4096))),
+      mMask(mBuffer.size() - 1),
+      mPadding(0),
+      mHead(0),
+      mTail(0),
+      mDropCount(0) {
+}
+
+UBinaryLogRing::~UBinaryLogRing() {
+}
+
+uint8_t *UBinaryLogRing::Reserve(const uint32_t size) {
+    const auto capacity = mBuffer.size();
+    if (size == 0 || size > capacity / 2) {
+        mDropCount.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    const auto head = mHead.load(std::memory_order_relaxed);
+    const auto tail = mTail.load(std::memory_order_acquire);
+
+    const auto offset = head & mMask;
+    const auto padding = offset + size > capacity ? capacity - offset : 0;
+
+    if (head + padding + size - tail > capacity) {
+        mDropCount.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    mPadding = padding;
+
+    if (padding > 0) {
+        // Consumer Skips The Tail Less Than A Size Field Without The Marker
+        if (padding >= sizeof(uint32_t)) {
+            binary_log::WriteValue(mBuffer.data() + offset, WRAP_MARKER);
+        }
+        return mBuffer.data();
+    }
+
+    return mBuffer.data() + offset;
+}
+
+void UBinaryLogRing::Commit(const uint32_t size) {
+    const auto head = mHead.load(std::memory_order_relaxed);
+    mHead.store(head + mPadding + size, std::memory_order_release);
+    mPadding = 0;
+}
+
+size_t UBinaryLogRing::Consume(const std::function<void(const uint8_t *, uint32_t)> &func) {
+    const auto capacity = mBuffer.size();
+    const auto head = mHead.load(std::memory_order_acquire);
+    auto tail = mTail.load(std::memory_order_relaxed);
+
+    size_t count = 0;
+
+    while (tail < head) {
+        const auto offset = tail & mMask;
+        const auto rest = capacity - offset;
+
+        if (rest < sizeof(uint32_t)) {
+            tail += rest;
+            continue;
+        }
+
+        const auto size = binary_log::ReadValue<uint32_t>(mBuffer.data() + offset);
+        if (size == WRAP_MARKER) {
+            tail += rest;
+            continue;
+        }
+
+        std::invoke(func, mBuffer.data() + offset, size);
+
+        tail += size;
+        ++count;
+    }
+
+    mTail.store(tail, std::memory_order_release);
+    return count;
+}
+
+size_t UBinaryLogRing::GetDropCount() const {
+    return mDropCount.load(std::memory_order_relaxed);
+}
+
+bool UBinaryLogRing::IsEmpty() const {
+    return mHead.load(std::memory_order_acquire) == mTail.load(std::memory_order_acquire);
+}
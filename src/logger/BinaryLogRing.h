@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Common.h"
+
+#include <atomic>
+#include <vector>
+#include <functional>
+
+
+/**
+ * Single Producer Single Consumer Byte Ring For One Thread's Binary Log Records,
+ * The Producer Never Blocks, The Record Is Dropped If There Is No Enough Space
+ */
+class BASE_API UBinaryLogRing final {
+
+public:
+    explicit UBinaryLogRing(size_t capacity);
+    ~UBinaryLogRing();
+
+    DISABLE_COPY_MOVE(UBinaryLogRing)
+
+    /// Reserve Contiguous Space For One Record, Return Null If Full. Producer Only
+    [[nodiscard]] uint8_t *Reserve(uint32_t size);
+
+    /// Publish The Reserved Record. Producer Only
+    void Commit(uint32_t size);
+
+    /// Consume All The Published Records, Return The Count. Consumer Only
+    size_t Consume(const std::function<void(const uint8_t *, uint32_t)> &func);
+
+    [[nodiscard]] size_t GetDropCount() const;
+    [[nodiscard]] bool IsEmpty() const;
+
+private:
+    std::vector<uint8_t> mBuffer;
+    size_t mMask;
+
+    /** The Padding Before The Reserved Record, Written By The Producer Only **/
+    uint64_t mPadding;
+
+    alignas(64) std::atomic_uint64_t mHead;
+    alignas(64) std::atomic_uint64_t mTail;
+
+    std::atomic_size_t mDropCount;
+};
@@ -0,0 +1,273 @@
+#include "BinaryLogger.h"
+
+#include <spdlog/spdlog.h>
+#include <filesystem>
+#include <format>
+#include <ranges>
+
+
+namespace {
+    // The Formats Are Process Wide, So The Same Call Site Has The Same ID In All Loggers
+    std::vector<FBinaryLogFormat> gFormatList;
+    std::mutex gFormatMutex;
+
+    std::atomic_uint64_t gGeneration{0};
+
+    struct FThreadRing {
+        uint64_t generation = 0;
+        std::shared_ptr<UBinaryLogRing> ring;
+    };
+
+    thread_local FThreadRing tThreadRing;
+}
+
+
+UBinaryLogger::UBinaryLogger(UBinaryLogBackend *backend, std::string name, const uint32_t id)
+    : mBackend(backend),
+      mName(std::move(name)),
+      mLoggerID(id),
+      mLevel(spdlog::level::trace) {
+}
+
+UBinaryLogger::~UBinaryLogger() {
+}
+
+const std::string &UBinaryLogger::GetName() const {
+    return mName;
+}
+
+uint32_t UBinaryLogger::GetLoggerID() const {
+    return mLoggerID;
+}
+
+void UBinaryLogger::SetLevel(const spdlog::level::level_enum level) {
+    mLevel.store(level, std::memory_order_relaxed);
+}
+
+bool UBinaryLogger::ShouldLog(const spdlog::level::level_enum level) const {
+    return level >= mLevel.load(std::memory_order_relaxed);
+}
+
+uint32_t UBinaryLogger::RegisterFormat(const spdlog::level::level_enum level, const char *file, const uint32_t line, const char *format) {
+    std::unique_lock lock(gFormatMutex);
+    gFormatList.emplace_back(level, file != nullptr ? file : "", line, format != nullptr ? format : "");
+    return static_cast<uint32_t>(gFormatList.size() - 1);
+}
+
+UBinaryLogRing *UBinaryLogger::GetThreadRing() const {
+    if (mBackend == nullptr)
+        return nullptr;
+    return mBackend->AcquireThreadRing();
+}
+
+UBinaryLogBackend::UBinaryLogBackend(std::string directory, const size_t ringSize, const int pollInterval)
+    : mDirectory(std::move(directory)),
+      mRingSize(ringSize),
+      mPollInterval(pollInterval > 0 ? pollInterval : 10),
+      mGeneration(gGeneration.fetch_add(1, std::memory_order_relaxed) + 1),
+      mRetiredDrop(0),
+      bQuit(false) {
+}
+
+UBinaryLogBackend::~UBinaryLogBackend() {
+    Stop();
+}
+
+void UBinaryLogBackend::Start() {
+    if (mThread.joinable())
+        return;
+
+    std::filesystem::create_directories(mDirectory);
+
+    mThread = std::thread([this] {
+        WriteLoop();
+    });
+}
+
+void UBinaryLogBackend::Stop() {
+    {
+        std::unique_lock lock(mMutex);
+        bQuit = true;
+    }
+    mCondVar.notify_all();
+
+    if (mThread.joinable()) {
+        mThread.join();
+    }
+
+    for (auto &node : mFileMap | std::views::values) {
+        if (node.file != nullptr) {
+            std::fclose(node.file);
+            node.file = nullptr;
+        }
+    }
+    mFileMap.clear();
+}
+
+std::shared_ptr<UBinaryLogger> UBinaryLogBackend::CreateLogger(const std::string &name) {
+    std::unique_lock lock(mLoggerMutex);
+    const auto id = static_cast<uint32_t>(mLoggerNames.size());
+    mLoggerNames.emplace_back(name);
+    return std::make_shared<UBinaryLogger>(this, name, id);
+}
+
+size_t UBinaryLogBackend::GetDropCount() const {
+    std::unique_lock lock(mRingMutex);
+
+    size_t count = mRetiredDrop;
+    for (const auto &ring : mRingList) {
+        count += ring->GetDropCount();
+    }
+    return count;
+}
+
+std::vector<FBinaryLogFormat> UBinaryLogBackend::GetFormatList() {
+    std::unique_lock lock(gFormatMutex);
+    return gFormatList;
+}
+
+UBinaryLogRing *UBinaryLogBackend::AcquireThreadRing() {
+    if (tThreadRing.generation == mGeneration && tThreadRing.ring != nullptr)
+        return tThreadRing.ring.get();
+
+    auto ring = std::make_shared<UBinaryLogRing>(mRingSize);
+    {
+        std::unique_lock lock(mRingMutex);
+        mRingList.emplace_back(ring);
+    }
+
+    tThreadRing.generation = mGeneration;
+    tThreadRing.ring = std::move(ring);
+
+    return tThreadRing.ring.get();
+}
+
+void UBinaryLogBackend::WriteLoop() {
+    while (true) {
+        bool bExit = false;
+        {
+            std::unique_lock lock(mMutex);
+            bExit = mCondVar.wait_for(lock, std::chrono::milliseconds(mPollInterval), [this] { return bQuit; });
+        }
+
+        // Persist The Rest Records Before Exit
+        if (Drain() > 0) {
+            for (const auto &node : mFileMap | std::views::values) {
+                if (node.file != nullptr) {
+                    std::fflush(node.file);
+                }
+            }
+        }
+
+        if (bExit)
+            break;
+    }
+}
+
+size_t UBinaryLogBackend::Drain() {
+    std::vector<std::shared_ptr<UBinaryLogRing>> rings;
+    {
+        std::unique_lock lock(mRingMutex);
+        rings = mRingList;
+    }
+
+    size_t count = 0;
+    for (const auto &ring : rings) {
+        count += ring->Consume([this](const uint8_t *data, const uint32_t size) {
+            WriteRecord(data, size);
+        });
+    }
+
+    // Remove The Rings Of The Exited Threads, Only The List And The Local Copy Hold Them
+    {
+        std::unique_lock lock(mRingMutex);
+        std::erase_if(mRingList, [this](const std::shared_ptr<UBinaryLogRing> &ring) {
+            if (ring.use_count() <= 2 && ring->IsEmpty()) {
+                mRetiredDrop += ring->GetDropCount();
+                return true;
+            }
+            return false;
+        });
+    }
+
+    return count;
+}
+
+void UBinaryLogBackend::WriteRecord(const uint8_t *data, const uint32_t size) {
+    if (size < binary_log::RECORD_HEADER_SIZE)
+        return;
+
+    const auto loggerID = binary_log::ReadValue<uint32_t>(data + sizeof(uint32_t));
+    const auto formatID = binary_log::ReadValue<uint32_t>(data + sizeof(uint32_t) * 2);
+
+    auto *node = OpenLoggerFile(loggerID);
+    if (node == nullptr || node->file == nullptr)
+        return;
+
+    // Write The Format Definition Before Its First Record In This File
+    if (formatID >= node->definedFormat.size() || !node->definedFormat[formatID]) {
+        if (formatID >= mFormatCache.size()) {
+            mFormatCache = GetFormatList();
+        }
+
+        if (formatID >= mFormatCache.size())
+            return;
+
+        const auto &format = mFormatCache[formatID];
+
+        const auto level = static_cast<uint8_t>(format.level);
+        const auto fileLength = static_cast<uint16_t>(format.file.size());
+        const auto formatLength = static_cast<uint32_t>(format.format.size());
+
+        std::fwrite(&binary_log::ENTRY_FORMAT, 1, 1, node->file);
+        std::fwrite(&formatID, sizeof(formatID), 1, node->file);
+        std::fwrite(&level, sizeof(level), 1, node->file);
+        std::fwrite(&format.line, sizeof(format.line), 1, node->file);
+        std::fwrite(&fileLength, sizeof(fileLength), 1, node->file);
+        std::fwrite(format.file.data(), 1, fileLength, node->file);
+        std::fwrite(&formatLength, sizeof(formatLength), 1, node->file);
+        std::fwrite(format.format.data(), 1, formatLength, node->file);
+
+        if (formatID >= node->definedFormat.size()) {
+            node->definedFormat.resize(formatID + 1, false);
+        }
+        node->definedFormat[formatID] = true;
+    }
+
+    std::fwrite(&binary_log::ENTRY_RECORD, 1, 1, node->file);
+    std::fwrite(data, 1, size, node->file);
+}
+
+UBinaryLogBackend::FLoggerFile *UBinaryLogBackend::OpenLoggerFile(const uint32_t id) {
+    if (const auto iter = mFileMap.find(id); iter != mFileMap.end())
+        return &iter->second;
+
+    std::string name;
+    {
+        std::unique_lock lock(mLoggerMutex);
+        if (id >= mLoggerNames.size())
+            return nullptr;
+        name = mLoggerNames[id];
+    }
+
+    const auto stamp = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    const auto path = std::format("{}/{}_{}.blog", mDirectory, name, stamp);
+
+    auto &node = mFileMap[id];
+    node.name = name;
+    node.file = std::fopen(path.c_str(), "wb");
+
+    if (node.file == nullptr) {
+        SPDLOG_ERROR("{} - Failed To Open Binary Log File {}", __FUNCTION__, path);
+        return &node;
+    }
+
+    const auto nameLength = static_cast<uint16_t>(name.size());
+
+    std::fwrite(binary_log::FILE_MAGIC, 1, sizeof(binary_log::FILE_MAGIC), node.file);
+    std::fwrite(&binary_log::FILE_VERSION, sizeof(binary_log::FILE_VERSION), 1, node.file);
+    std::fwrite(&nameLength, sizeof(nameLength), 1, node.file);
+    std::fwrite(name.data(), 1, nameLength, node.file);
+
+    return &node;
+}
@@ -0,0 +1,244 @@
+#pragma once
+
+#include "BinaryLogFormat.h"
+#include "BinaryLogRing.h"
+
+#include <spdlog/common.h>
+#include <condition_variable>
+#include <unordered_map>
+#include <string_view>
+#include <concepts>
+#include <chrono>
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <string>
+#include <vector>
+#include <mutex>
+
+
+class UBinaryLogBackend;
+
+
+/**
+ * The Static Description Of One Log Call Site, Registered Once
+ */
+struct BASE_API FBinaryLogFormat {
+    spdlog::level::level_enum level;
+    std::string file;
+    uint32_t line;
+    std::string format;
+};
+
+
+template<class T>
+concept CBinaryLogArg =
+    std::integral<std::decay_t<T>> ||
+    std::floating_point<std::decay_t<T>> ||
+    std::is_enum_v<std::decay_t<T>> ||
+    std::convertible_to<const T &, std::string_view>;
+
+
+/**
+ * The Per-Service Binary Logger, Writes The Format ID And The Raw Arguments
+ * To The Ring Of The Calling Thread, Formatting Is Done By The Offline Decoder
+ */
+class BASE_API UBinaryLogger final {
+
+    friend class UBinaryLogBackend;
+
+public:
+    UBinaryLogger(UBinaryLogBackend *backend, std::string name, uint32_t id);
+    ~UBinaryLogger();
+
+    DISABLE_COPY_MOVE(UBinaryLogger)
+
+    [[nodiscard]] const std::string &GetName() const;
+    [[nodiscard]] uint32_t GetLoggerID() const;
+
+    void SetLevel(spdlog::level::level_enum level);
+    [[nodiscard]] bool ShouldLog(spdlog::level::level_enum level) const;
+
+    /// Register The Call Site And Return The Format ID, Thread Safe
+    static uint32_t RegisterFormat(spdlog::level::level_enum level, const char *file, uint32_t line, const char *format);
+
+    template<CBinaryLogArg... Args>
+    void Log(uint32_t formatID, const Args &... args);
+
+private:
+    template<class T>
+    static constexpr size_t ArgSize(const T &arg);
+
+    template<class T>
+    static uint8_t *WriteArg(uint8_t *data, const T &arg);
+
+    [[nodiscard]] UBinaryLogRing *GetThreadRing() const;
+
+private:
+    UBinaryLogBackend *mBackend;
+    std::string mName;
+    uint32_t mLoggerID;
+
+    std::atomic<spdlog::level::level_enum> mLevel;
+};
+
+
+/**
+ * Own The Thread Rings And The Background Writer Thread,
+ * Which Persists The Records Into One File Per Logger
+ */
+class BASE_API UBinaryLogBackend final {
+
+    friend class UBinaryLogger;
+
+    struct FLoggerFile {
+        std::string name;
+        FILE *file = nullptr;
+        std::vector<bool> definedFormat;
+    };
+
+public:
+    UBinaryLogBackend(std::string directory, size_t ringSize, int pollInterval);
+    ~UBinaryLogBackend();
+
+    DISABLE_COPY_MOVE(UBinaryLogBackend)
+
+    void Start();
+
+    /// Stop The Writer Thread After Persisting All The Records
+    void Stop();
+
+    [[nodiscard]] std::shared_ptr<UBinaryLogger> CreateLogger(const std::string &name);
+
+    /// The Count Of The Records Dropped By All The Rings
+    [[nodiscard]] size_t GetDropCount() const;
+
+    /// Snapshot Of All The Registered Formats
+    [[nodiscard]] static std::vector<FBinaryLogFormat> GetFormatList();
+
+private:
+    [[nodiscard]] UBinaryLogRing *AcquireThreadRing();
+
+    void WriteLoop();
+    size_t Drain();
+
+    void WriteRecord(const uint8_t *data, uint32_t size);
+    FLoggerFile *OpenLoggerFile(uint32_t id);
+
+private:
+    const std::string mDirectory;
+    const size_t mRingSize;
+    const int mPollInterval;
+
+    /** Distinguish From The Destroyed Backend, Whose Ring May Still Be Cached By The Thread **/
+    const uint64_t mGeneration;
+
+    std::vector<std::shared_ptr<UBinaryLogRing>> mRingList;
+    mutable std::mutex mRingMutex;
+
+    /** The Rings Of The Exited Threads Are Removed After Drained, Keep Their Drop Count **/
+    size_t mRetiredDrop;
+
+    std::vector<std::string> mLoggerNames;
+    std::mutex mLoggerMutex;
+
+    /** Only Accessed In The Writer Thread **/
+    std::unordered_map<uint32_t, FLoggerFile> mFileMap;
+    std::vector<FBinaryLogFormat> mFormatCache;
+
+    std::thread mThread;
+    std::mutex mMutex;
+    std::condition_variable mCondVar;
+    bool bQuit;
+};
+
+
+template<class T>
+constexpr size_t UBinaryLogger::ArgSize(const T &arg) {
+    using AType = std::decay_t<T>;
+    if constexpr (std::same_as<AType, bool> || std::same_as<AType, char>) {
+        return 1 + sizeof(uint8_t);
+    } else if constexpr (std::integral<AType> || std::floating_point<AType> || std::is_enum_v<AType>) {
+        return 1 + sizeof(int64_t);
+    } else {
+        return 1 + sizeof(uint32_t) + std::string_view(arg).size();
+    }
+}
+
+template<class T>
+uint8_t *UBinaryLogger::WriteArg(uint8_t *data, const T &arg) {
+    using namespace binary_log;
+    using AType = std::decay_t<T>;
+
+    if constexpr (std::same_as<AType, bool>) {
+        data = WriteValue(data, EArgType::BOOL);
+        return WriteValue(data, static_cast<uint8_t>(arg));
+    } else if constexpr (std::same_as<AType, char>) {
+        data = WriteValue(data, EArgType::CHAR);
+        return WriteValue(data, static_cast<uint8_t>(arg));
+    } else if constexpr (std::is_enum_v<AType>) {
+        data = WriteValue(data, EArgType::INT64);
+        return WriteValue(data, static_cast<int64_t>(arg));
+    } else if constexpr (std::signed_integral<AType>) {
+        data = WriteValue(data, EArgType::INT64);
+        return WriteValue(data, static_cast<int64_t>(arg));
+    } else if constexpr (std::unsigned_integral<AType>) {
+        data = WriteValue(data, EArgType::UINT64);
+        return WriteValue(data, static_cast<uint64_t>(arg));
+    } else if constexpr (std::floating_point<AType>) {
+        data = WriteValue(data, EArgType::DOUBLE);
+        return WriteValue(data, static_cast<double>(arg));
+    } else {
+        const std::string_view view(arg);
+        data = WriteValue(data, EArgType::STRING);
+        data = WriteValue(data, static_cast<uint32_t>(view.size()));
+        std::memcpy(data, view.data(), view.size());
+        return data + view.size();
+    }
+}
+
+template<CBinaryLogArg... Args>
+inline void UBinaryLogger::Log(const uint32_t formatID, const Args &... args) {
+    static_assert(sizeof...(Args) <= UINT8_MAX, "Too Many Arguments For Binary Log");
+
+    auto *ring = GetThreadRing();
+    if (ring == nullptr)
+        return;
+
+    const auto size = static_cast<uint32_t>(binary_log::RECORD_HEADER_SIZE + (0 + ... + ArgSize(args)));
+
+    auto *data = ring->Reserve(size);
+    if (data == nullptr)
+        return;
+
+    // Only Read The Clock, The Timestamp String Is Built By The Decoder
+    const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    auto *pos = binary_log::WriteValue(data, size);
+    pos = binary_log::WriteValue(pos, mLoggerID);
+    pos = binary_log::WriteValue(pos, formatID);
+    pos = binary_log::WriteValue(pos, static_cast<uint8_t>(sizeof...(Args)));
+    pos = binary_log::WriteValue(pos, now);
+
+    ((pos = WriteArg(pos, args)), ...);
+
+    ring->Commit(size);
+}
+
+
+/// Log With The Binary Logger, The Format Is Registered Once Per Call Site
+#define BINARY_LOG(logger, level, format, ...)                                                                          \
+do {                                                                                                                    \
+    if ((logger) != nullptr && (logger)->ShouldLog(level)) {                                                            \
+        static const uint32_t _binaryFormatID = UBinaryLogger::RegisterFormat(level, __FILE__, __LINE__, format);       \
+        (logger)->Log(_binaryFormatID __VA_OPT__(,) __VA_ARGS__);                                                       \
+    }                                                                                                                   \
+} while (false)
+
+#define BINARY_LOG_TRACE(logger, format, ...)   BINARY_LOG(logger, spdlog::level::trace, format __VA_OPT__(,) __VA_ARGS__)
+#define BINARY_LOG_DEBUG(logger, format, ...)   BINARY_LOG(logger, spdlog::level::debug, format __VA_OPT__(,) __VA_ARGS__)
+#define BINARY_LOG_INFO(logger, format, ...)    BINARY_LOG(logger, spdlog::level::info, format __VA_OPT__(,) __VA_ARGS__)
+#define BINARY_LOG_WARN(logger, format, ...)    BINARY_LOG(logger, spdlog::level::warn, format __VA_OPT__(,) __VA_ARGS__)
+#define BINARY_LOG_ERROR(logger, format, ...)   BINARY_LOG(logger, spdlog::level::err, format __VA_OPT__(,) __VA_ARGS__)
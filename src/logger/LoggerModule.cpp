@@ -3,40 +3,123 @@
 #include "config/Config.h"
 
 #include <spdlog/spdlog.h>
+#include <spdlog/async.h>
 #include <spdlog/sinks/daily_file_sink.h>
 
-ULoggerModule::ULoggerModule() {
+
+ULoggerModule::ULoggerModule()
+    : mOverflowPolicy(spdlog::async_overflow_policy::block) {
 }
 
 ULoggerModule::~ULoggerModule() {
 }
 
+void ULoggerModule::Initial() {
+    if (mState != EModuleState::CREATED)
+        return;
+
+    const auto *config = GetServer()->GetModule<UConfig>();
+    assert(config != nullptr);
+
+    const auto &cfg = config->GetServerConfig()["server"]["logger"];
+
+    const auto queueSize = cfg["queue_size"].as<size_t>();
+    const auto threadCount = cfg["thread"].as<size_t>();
+    const auto flushInterval = cfg["flush_interval"].as<int>();
+
+    // Block Keeps Every Message, Overrun Drops The Oldest One And Never Blocks The Caller
+    if (const auto policy = cfg["overflow"].as<std::string>(); policy == "overrun") {
+        mOverflowPolicy = spdlog::async_overflow_policy::overrun_oldest;
+    } else {
+        mOverflowPolicy = spdlog::async_overflow_policy::block;
+    }
+
+    mThreadPool = std::make_shared<spdlog::details::thread_pool>(queueSize, threadCount > 0 ? threadCount : 1);
+
+    // The File Sink Writes Into The Buffer, And Flush To Disk Periodically Or On Error
+    if (flushInterval > 0) {
+        spdlog::flush_every(std::chrono::seconds(flushInterval));
+    }
+
+    SPDLOG_INFO("{} - Async Logger Queue[{}], Thread[{}], Overflow[{}]",
+        __FUNCTION__, queueSize, threadCount, cfg["overflow"].as<std::string>());
+
+    // Binary Mode, The Call Site Writes Raw Arguments And The Offline Decoder Formats Them
+    if (const auto &binary = cfg["binary"]; binary["enable"].as<bool>()) {
+        mBinaryBackend = std::make_unique<UBinaryLogBackend>(
+            cfg["directory"].as<std::string>() + "/binary",
+            binary["ring_size"].as<size_t>(),
+            binary["poll_interval"].as<int>());
+
+        mBinaryBackend->Start();
+        SPDLOG_INFO("{} - Binary Logger Enabled", __FUNCTION__);
+    }
+
+    mState = EModuleState::INITIALIZED;
+}
+
 void ULoggerModule::Stop() {
     Super::Stop();
-    for (const auto &name : mUseCount | std::views::keys) {
-        spdlog::drop(name);
+
+    {
+        std::unique_lock lock(mMutex);
+        for (const auto &name : mUseCount | std::views::keys) {
+            if (const auto logger = spdlog::get(name)) {
+                logger->flush();
+            }
+            spdlog::drop(name);
+        }
+        mUseCount.clear();
+        mBinaryLoggerMap.clear();
+    }
+
+    if (mBinaryBackend != nullptr) {
+        mBinaryBackend->Stop();
     }
+
+    // The Pool Consumes The Rest Messages Before Its Threads Joined
+    mThreadPool.reset();
 }
 
 void ULoggerModule::TryCreateLogger(const std::string &name) {
     if (mState >= EModuleState::STOPPED)
         return;
 
-    if (!mUseCount.contains(name)) {
-        const auto *config = GetServer()->GetModule<UConfig>();
-        if (!config)
-            return;
+    std::unique_lock lock(mMutex);
 
-        const auto &cfg = config->GetServerConfig();
+    if (const auto iter = mUseCount.find(name); iter != mUseCount.end()) {
+        ++iter->second;
+        return;
+    }
+
+    if (mThreadPool == nullptr)
+        return;
+
+    const auto *config = GetServer()->GetModule<UConfig>();
+    if (!config)
+        return;
 
-        const auto rootDir = cfg["server"]["logger"]["directory"].as<std::string>();
-        const auto loggerPath = rootDir + "/" + name;
+    const auto &cfg = config->GetServerConfig();
 
-        auto logger = spdlog::daily_logger_mt(name, loggerPath, 2, 0);
+    const auto rootDir = cfg["server"]["logger"]["directory"].as<std::string>();
+    const auto loggerPath = rootDir + "/" + name;
+
+    try {
+        auto sink = std::make_shared<spdlog::sinks::daily_file_sink_mt>(loggerPath, 2, 0);
+        auto logger = std::make_shared<spdlog::async_logger>(name, std::move(sink), mThreadPool, mOverflowPolicy);
+
+        logger->flush_on(spdlog::level::err);
+        spdlog::register_logger(logger);
+
+        if (mBinaryBackend != nullptr) {
+            mBinaryLoggerMap.insert_or_assign(name, mBinaryBackend->CreateLogger(name));
+        }
+    } catch (const std::exception &e) {
+        SPDLOG_ERROR("{} - Failed To Create Logger[{}]: {}", __FUNCTION__, name, e.what());
+        return;
     }
 
-    std::unique_lock lock(mMutex);
-    mUseCount[name]++;
+    mUseCount[name] = 1;
 }
 
 void ULoggerModule::TryDestroyLogger(const std::string &name) {
@@ -52,8 +135,12 @@ void ULoggerModule::TryDestroyLogger(const std::string &name) {
             return;
 
         mUseCount.erase(iter);
+        mBinaryLoggerMap.erase(name);
     }
 
+    if (const auto logger = spdlog::get(name)) {
+        logger->flush();
+    }
     spdlog::drop(name);
 }
 
@@ -64,3 +151,27 @@ int ULoggerModule::GetLoggerUseCount(const std::string &name) const {
         return 0;
     return iter->second;
 }
+
+size_t ULoggerModule::GetQueueDepth() const {
+    if (mThreadPool == nullptr)
+        return 0;
+    return mThreadPool->queue_size();
+}
+
+size_t ULoggerModule::GetDropCount() const {
+    if (mThreadPool == nullptr)
+        return 0;
+    return mThreadPool->overrun_counter();
+}
+
+std::shared_ptr<UBinaryLogger> ULoggerModule::GetBinaryLogger(const std::string &name) const {
+    std::shared_lock lock(mMutex);
+    const auto iter = mBinaryLoggerMap.find(name);
+    return iter == mBinaryLoggerMap.end() ? nullptr : iter->second;
+}
+
+size_t ULoggerModule::GetBinaryDropCount() const {
+    if (mBinaryBackend == nullptr)
+        return 0;
+    return mBinaryBackend->GetDropCount();
+}
@@ -1,16 +1,32 @@
 #pragma once
 
 #include "Module.h"
+#include "BinaryLogger.h"
 
 #include <unordered_map>
 #include <shared_mutex>
+#include <memory>
 
 
+namespace spdlog::details {
+    class thread_pool;
+}
+
+namespace spdlog {
+    enum class async_overflow_policy;
+}
+
+
+/**
+ * Create The Service Loggers On A Shared Async Thread Pool,
+ * The Log Call Only Enqueues The Message, Disk Writing Is Done By The Pool Threads
+ */
 class BASE_API ULoggerModule final : public IModuleBase {
 
     DECLARE_MODULE(ULoggerModule)
 
 protected:
+    void Initial() override;
     void Stop() override;
 
 public:
@@ -26,7 +42,26 @@ public:
 
     [[nodiscard]] int GetLoggerUseCount(const std::string &name) const;
 
+    /// The Count Of The Messages Waiting In The Async Queue
+    [[nodiscard]] size_t GetQueueDepth() const;
+
+    /// The Count Of The Messages Dropped Because Of The Queue Full
+    [[nodiscard]] size_t GetDropCount() const;
+
+    /// Return The Binary Logger Created With The Text Logger, Null If Binary Mode Disabled
+    [[nodiscard]] std::shared_ptr<UBinaryLogger> GetBinaryLogger(const std::string &name) const;
+
+    /// The Count Of The Binary Records Dropped Because Of The Thread Ring Full
+    [[nodiscard]] size_t GetBinaryDropCount() const;
+
 private:
+    std::shared_ptr<spdlog::details::thread_pool> mThreadPool;
+    spdlog::async_overflow_policy mOverflowPolicy;
+
+    /** Persist The Binary Loggers, Only Created In Binary Mode **/
+    std::unique_ptr<UBinaryLogBackend> mBinaryBackend;
+    std::unordered_map<std::string, std::shared_ptr<UBinaryLogger>> mBinaryLoggerMap;
+
     std::unordered_map<std::string, int> mUseCount;
     mutable std::shared_mutex mMutex;
 };
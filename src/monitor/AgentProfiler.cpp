@@ -0,0 +1,214 @@
+#include "AgentProfiler.h"
+
+#include <algorithm>
+#include <format>
+#include <ctime>
+
+
+namespace {
+    constexpr size_t HOT_ENTRY_COUNT = 3;
+
+    /** The Innermost Scope Measuring In This Thread **/
+    thread_local UAgentProfiler::FScope *tCurrentScope = nullptr;
+
+    const char *GetNodeTypeName(const EChannelNodeType type) {
+        switch (type) {
+            case EChannelNodeType::PACKAGE: return "package";
+            case EChannelNodeType::EVENT: return "event";
+            case EChannelNodeType::TASK: return "task";
+            case EChannelNodeType::TICKER: return "ticker";
+            default: return "unknown";
+        }
+    }
+
+    uint64_t MakeEntryKey(const EChannelNodeType type, const uint32_t packageID) {
+        return static_cast<uint64_t>(type) << 32 | packageID;
+    }
+}
+
+UAgentProfile::UAgentProfile(std::string name)
+    : mName(std::move(name)) {
+}
+
+UAgentProfile::~UAgentProfile() {
+}
+
+std::string UAgentProfile::GetName() const {
+    std::unique_lock lock(mMutex);
+    return mName;
+}
+
+void UAgentProfile::Record(const EChannelNodeType type, const uint32_t packageID, const int64_t cpuTime) {
+    std::unique_lock lock(mMutex);
+
+    auto &entry = mEntryMap[MakeEntryKey(type, packageID)];
+    ++entry.count;
+    entry.cpuTime += cpuTime;
+
+    ++mTotal.count;
+    mTotal.cpuTime += cpuTime;
+}
+
+UAgentProfiler::UAgentProfiler()
+    : bEnable(false),
+      mLastReport(std::chrono::steady_clock::now()) {
+}
+
+UAgentProfiler::~UAgentProfiler() {
+}
+
+UAgentProfiler &UAgentProfiler::Instance() {
+    static UAgentProfiler profiler;
+    return profiler;
+}
+
+void UAgentProfiler::SetEnable(const bool bEnable) {
+    this->bEnable.store(bEnable, std::memory_order_relaxed);
+}
+
+bool UAgentProfiler::IsEnabled() const {
+    return bEnable.load(std::memory_order_relaxed);
+}
+
+std::shared_ptr<UAgentProfile> UAgentProfiler::CreateProfile(const std::string &name) {
+    if (!IsEnabled())
+        return nullptr;
+
+    auto profile = std::make_shared<UAgentProfile>(name);
+
+    std::unique_lock lock(mMutex);
+    mProfileList.emplace_back(profile);
+
+    return profile;
+}
+
+std::string UAgentProfiler::BuildReport(const size_t topN) {
+    struct FHotEntry {
+        EChannelNodeType type;
+        uint32_t packageID;
+        uint64_t count;
+        int64_t cpuTime;
+    };
+
+    struct FHotAgent {
+        std::string name;
+        uint64_t count;
+        int64_t cpuTime;
+        std::vector<FHotEntry> entries;
+    };
+
+    std::vector<FHotAgent> agents;
+
+    const auto now = std::chrono::steady_clock::now();
+    int64_t elapsed = 0;
+    {
+        std::unique_lock lock(mMutex);
+
+        elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - mLastReport).count();
+        mLastReport = now;
+
+        for (const auto &profile : mProfileList) {
+            std::unique_lock profileLock(profile->mMutex);
+
+            auto &total = profile->mTotal;
+            FHotAgent agent{
+                profile->mName,
+                total.count - total.reportedCount,
+                total.cpuTime - total.reportedTime,
+                {}
+            };
+
+            total.reportedCount = total.count;
+            total.reportedTime = total.cpuTime;
+
+            for (auto &[key, entry] : profile->mEntryMap) {
+                if (entry.count != entry.reportedCount) {
+                    agent.entries.emplace_back(
+                        static_cast<EChannelNodeType>(key >> 32),
+                        static_cast<uint32_t>(key & UINT32_MAX),
+                        entry.count - entry.reportedCount,
+                        entry.cpuTime - entry.reportedTime);
+                }
+
+                entry.reportedCount = entry.count;
+                entry.reportedTime = entry.cpuTime;
+            }
+
+            if (agent.count > 0) {
+                agents.emplace_back(std::move(agent));
+            }
+        }
+
+        // Remove The Profiles Of The Destroyed Agents After Reported
+        std::erase_if(mProfileList, [](const std::shared_ptr<UAgentProfile> &profile) {
+            return profile.use_count() == 1;
+        });
+    }
+
+    const auto count = std::min(topN, agents.size());
+    std::ranges::partial_sort(agents, agents.begin() + static_cast<ptrdiff_t>(count), std::ranges::greater{}, &FHotAgent::cpuTime);
+
+    std::string report = std::format("Hot Agents In The Last {}ms, Top {}:\n", elapsed / 1000000, count);
+
+    for (size_t idx = 0; idx < count; ++idx) {
+        auto &agent = agents[idx];
+
+        const auto usage = elapsed > 0 ? static_cast<double>(agent.cpuTime) * 100.0 / static_cast<double>(elapsed) : 0.0;
+        const auto average = agent.cpuTime / static_cast<int64_t>(agent.count);
+
+        report += std::format("  #{} {} - CPU {}us ({:.2f}%), Messages {}, Average {}ns\n",
+            idx + 1, agent.name, agent.cpuTime / 1000, usage, agent.count, average);
+
+        const auto entryCount = std::min(HOT_ENTRY_COUNT, agent.entries.size());
+        std::ranges::partial_sort(agent.entries, agent.entries.begin() + static_cast<ptrdiff_t>(entryCount), std::ranges::greater{}, &FHotEntry::cpuTime);
+
+        for (size_t pos = 0; pos < entryCount; ++pos) {
+            const auto &entry = agent.entries[pos];
+            report += std::format("      {}[{}] - CPU {}us, Messages {}\n",
+                GetNodeTypeName(entry.type), entry.packageID, entry.cpuTime / 1000, entry.count);
+        }
+    }
+
+    return report;
+}
+
+int64_t UAgentProfiler::ThreadCPUTime() {
+#if defined(__linux__) || defined(__APPLE__)
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+#else
+    // Fall Back To The Wall Clock, Include The Time Blocked
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+UAgentProfiler::FScope::FScope(UAgentProfile *profile, const EChannelNodeType type, const uint32_t packageID)
+    : mProfile(profile),
+      mType(type),
+      mPackageID(packageID),
+      mBegin(0),
+      mNested(0),
+      mOuter(tCurrentScope) {
+    tCurrentScope = this;
+
+    if (mProfile != nullptr) {
+        mBegin = ThreadCPUTime();
+    }
+}
+
+UAgentProfiler::FScope::~FScope() {
+    tCurrentScope = mOuter;
+
+    if (mProfile == nullptr)
+        return;
+
+    const auto elapsed = ThreadCPUTime() - mBegin;
+
+    // The Inline Execution Of Another Agent Is Only Counted By Its Own Scope
+    mProfile->Record(mType, mPackageID, elapsed - mNested);
+
+    if (mOuter != nullptr) {
+        mOuter->mNested += elapsed;
+    }
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "AgentBase.h"
+
+#include <absl/container/flat_hash_map.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include <mutex>
+
+
+/**
+ * The CPU Time And The Message Count Of One Agent,
+ * Split By The Channel Node Type And The Package ID
+ */
+class BASE_API UAgentProfile final {
+
+    friend class UAgentProfiler;
+
+    struct FProfileEntry {
+        uint64_t count = 0;
+        int64_t cpuTime = 0;
+
+        /** The Values At The Last Report, Only Used By The Reporter **/
+        uint64_t reportedCount = 0;
+        int64_t reportedTime = 0;
+    };
+
+public:
+    explicit UAgentProfile(std::string name);
+    ~UAgentProfile();
+
+    DISABLE_COPY_MOVE(UAgentProfile)
+
+    [[nodiscard]] std::string GetName() const;
+
+    /// Called By The Agent Coroutine, Only Contended By The Reporter
+    void Record(EChannelNodeType type, uint32_t packageID, int64_t cpuTime);
+
+private:
+    std::string mName;
+
+    absl::flat_hash_map<uint64_t, FProfileEntry> mEntryMap;
+    FProfileEntry mTotal;
+
+    mutable std::mutex mMutex;
+};
+
+
+/**
+ * Own The Profiles Of All The Agents And Build The Hot Agent Report.
+ * Disabled By Default, Reading The Thread CPU Clock Is A System Call On Most Platforms
+ */
+class BASE_API UAgentProfiler final {
+
+    UAgentProfiler();
+
+public:
+    ~UAgentProfiler();
+
+    DISABLE_COPY_MOVE(UAgentProfiler)
+
+    static UAgentProfiler &Instance();
+
+    void SetEnable(bool bEnable);
+    [[nodiscard]] bool IsEnabled() const;
+
+    /// Return Null If Disabled
+    [[nodiscard]] std::shared_ptr<UAgentProfile> CreateProfile(const std::string &name);
+
+    /// The Top N Agents By CPU Time Since The Last Report, With Their Hottest Nodes
+    [[nodiscard]] std::string BuildReport(size_t topN);
+
+    /// The CPU Time Of The Calling Thread In Nanoseconds
+    static int64_t ThreadCPUTime();
+
+    /**
+     * Measure The CPU Time Of The Scope Into The Profile, Nothing To Do If The Profile Is Null;
+     * The Time Of The Scope Nested In It Is Taken Out, So The Inline Execution Is Not Counted Twice
+     */
+    class BASE_API FScope final {
+
+    public:
+        FScope(UAgentProfile *profile, EChannelNodeType type, uint32_t packageID);
+        ~FScope();
+
+        DISABLE_COPY_MOVE(FScope)
+
+    private:
+        UAgentProfile *mProfile;
+        EChannelNodeType mType;
+        uint32_t mPackageID;
+        int64_t mBegin;
+
+        /** The CPU Time Of The Measured Scopes Nested In This One **/
+        int64_t mNested;
+        FScope *mOuter;
+    };
+
+private:
+    std::atomic_bool bEnable;
+
+    std::vector<std::shared_ptr<UAgentProfile>> mProfileList;
+    std::mutex mMutex;
+
+    /** The Report Time, For The CPU Usage Percent **/
+    ASteadyTimePoint mLastReport;
+};
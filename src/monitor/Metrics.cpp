@@ -0,0 +1,214 @@
+#include "Metrics.h"
+
+#include <algorithm>
+#include <format>
+
+
+namespace {
+    std::atomic_size_t gNextShard{0};
+
+    // The Quantiles Exported For Every Histogram
+    constexpr std::array<double, 4> EXPORT_QUANTILES = { 0.5, 0.9, 0.99, 0.999 };
+
+    std::string BuildLabels(const std::string &labels, const std::string &extra = {}) {
+        if (labels.empty() && extra.empty())
+            return {};
+
+        if (labels.empty())
+            return std::format("{{{}}}", extra);
+
+        if (extra.empty())
+            return std::format("{{{}}}", labels);
+
+        return std::format("{{{},{}}}", labels, extra);
+    }
+}
+
+size_t metrics::GetThreadShard() {
+    thread_local const size_t shard = gNextShard.fetch_add(1, std::memory_order_relaxed) % SHARD_COUNT;
+    return shard;
+}
+
+int64_t UMetricCounter::Value() const {
+    int64_t result = 0;
+    for (const auto &shard : mShards) {
+        result += shard.value.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+void UMetricCounter::Export(std::string &output, const std::string &name, const std::string &labels) const {
+    output += std::format("{}{} {}\n", name, BuildLabels(labels), Value());
+}
+
+void UMetricGauge::SetCollector(const ACollector &collector) {
+    std::unique_lock lock(mCollectorMutex);
+    mCollector = collector;
+}
+
+int64_t UMetricGauge::Value() const {
+    int64_t result = mBase.load(std::memory_order_relaxed);
+    for (const auto &shard : mShards) {
+        result += shard.value.load(std::memory_order_relaxed);
+    }
+
+    std::unique_lock lock(mCollectorMutex);
+    if (mCollector) {
+        result += std::invoke(mCollector);
+    }
+
+    return result;
+}
+
+void UMetricGauge::Export(std::string &output, const std::string &name, const std::string &labels) const {
+    output += std::format("{}{} {}\n", name, BuildLabels(labels), Value());
+}
+
+UMetricHistogram::UMetricHistogram(const size_t shards)
+    : mShards(std::clamp<size_t>(shards, 1, metrics::SHARD_COUNT)) {
+}
+
+uint64_t UMetricHistogram::Count() const {
+    uint64_t result = 0;
+    for (const auto &shard : mShards) {
+        result += shard.count.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+uint64_t UMetricHistogram::Sum() const {
+    uint64_t result = 0;
+    for (const auto &shard : mShards) {
+        result += shard.sum.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+void UMetricHistogram::Merge(std::array<uint64_t, metrics::BUCKET_COUNT> &buckets, uint64_t &count, uint64_t &sum) const {
+    buckets.fill(0);
+    count = 0;
+    sum = 0;
+
+    for (const auto &shard : mShards) {
+        for (size_t idx = 0; idx < metrics::BUCKET_COUNT; ++idx) {
+            buckets[idx] += shard.buckets[idx].load(std::memory_order_relaxed);
+        }
+        sum += shard.sum.load(std::memory_order_relaxed);
+    }
+
+    // The Count Is Rebuilt From The Buckets, So The Quantiles Are Consistent With It
+    for (const auto val : buckets) {
+        count += val;
+    }
+}
+
+uint64_t UMetricHistogram::Percentile(const double quantile) const {
+    std::array<uint64_t, metrics::BUCKET_COUNT> buckets{};
+    uint64_t count, sum;
+    Merge(buckets, count, sum);
+
+    if (count == 0)
+        return 0;
+
+    const auto rank = static_cast<uint64_t>(std::clamp(quantile, 0.0, 1.0) * static_cast<double>(count - 1)) + 1;
+
+    uint64_t seen = 0;
+    for (size_t idx = 0; idx < metrics::BUCKET_COUNT; ++idx) {
+        seen += buckets[idx];
+        if (seen >= rank)
+            return metrics::BucketUpperBound(idx);
+    }
+
+    return metrics::BucketUpperBound(metrics::BUCKET_COUNT - 1);
+}
+
+void UMetricHistogram::Export(std::string &output, const std::string &name, const std::string &labels) const {
+    std::array<uint64_t, metrics::BUCKET_COUNT> buckets{};
+    uint64_t count, sum;
+    Merge(buckets, count, sum);
+
+    // Walk The Buckets Once For All The Quantiles, They Are In Ascending Order
+    size_t idx = 0;
+    uint64_t seen = 0;
+
+    for (const auto quantile : EXPORT_QUANTILES) {
+        uint64_t value = 0;
+        if (count > 0) {
+            const auto rank = static_cast<uint64_t>(quantile * static_cast<double>(count - 1)) + 1;
+            while (idx < metrics::BUCKET_COUNT && seen + buckets[idx] < rank) {
+                seen += buckets[idx++];
+            }
+            value = metrics::BucketUpperBound(std::min(idx, metrics::BUCKET_COUNT - 1));
+        }
+
+        output += std::format("{}{} {}\n", name, BuildLabels(labels, std::format("quantile=\"{}\"", quantile)), value);
+    }
+
+    output += std::format("{}_sum{} {}\n", name, BuildLabels(labels), sum);
+    output += std::format("{}_count{} {}\n", name, BuildLabels(labels), count);
+}
+
+UMetricsRegistry &UMetricsRegistry::Instance() {
+    static UMetricsRegistry registry;
+    return registry;
+}
+
+template<class Type, class... Args>
+Type *UMetricsRegistry::GetOrCreate(const std::string &name, const std::string &help, const std::string &labels, const EMetricType type, Args &&... args) {
+    std::unique_lock lock(mMutex);
+
+    auto &family = mFamilyMap[name];
+    if (family.metrics.empty()) {
+        family.help = help;
+        family.type = type;
+    } else if (family.type != type) {
+        throw std::logic_error(std::format("{} - Metric {} Registered With Another Type", __FUNCTION__, name));
+    }
+
+    auto &metric = family.metrics[labels];
+    if (metric == nullptr) {
+        metric = std::make_unique<Type>(std::forward<Args>(args)...);
+    }
+
+    return static_cast<Type *>(metric.get());
+}
+
+UMetricCounter *UMetricsRegistry::GetCounter(const std::string &name, const std::string &help, const std::string &labels) {
+    return GetOrCreate<UMetricCounter>(name, help, labels, EMetricType::COUNTER);
+}
+
+UMetricGauge *UMetricsRegistry::GetGauge(const std::string &name, const std::string &help, const std::string &labels) {
+    return GetOrCreate<UMetricGauge>(name, help, labels, EMetricType::GAUGE);
+}
+
+UMetricHistogram *UMetricsRegistry::GetHistogram(const std::string &name, const std::string &help, const std::string &labels, const size_t shards) {
+    return GetOrCreate<UMetricHistogram>(name, help, labels, EMetricType::SUMMARY, shards);
+}
+
+std::string UMetricsRegistry::ExportPrometheus() const {
+    std::string output;
+    output.reserve(4096);
+
+    std::unique_lock lock(mMutex);
+
+    for (const auto &[name, family] : mFamilyMap) {
+        if (family.metrics.empty())
+            continue;
+
+        const char *type = "untyped";
+        switch (family.type) {
+            case EMetricType::COUNTER: type = "counter"; break;
+            case EMetricType::GAUGE: type = "gauge"; break;
+            case EMetricType::SUMMARY: type = "summary"; break;
+        }
+
+        output += std::format("# HELP {} {}\n", name, family.help);
+        output += std::format("# TYPE {} {}\n", name, type);
+
+        for (const auto &[labels, metric] : family.metrics) {
+            metric->Export(output, name, labels);
+        }
+    }
+
+    return output;
+}
@@ -0,0 +1,219 @@
+#pragma once
+
+#include "Common.h"
+
+#include <functional>
+#include <string>
+#include <memory>
+#include <atomic>
+#include <array>
+#include <bit>
+#include <vector>
+#include <mutex>
+#include <map>
+
+
+namespace metrics {
+    /** The Write Path Is Spread Over The Shards To Avoid Cache Line Contention **/
+    inline constexpr size_t SHARD_COUNT = 16;
+
+    /** Log-Linear Bucket Layout, Every Power Of Two Is Split Into 2^SUB_BITS Buckets **/
+    inline constexpr size_t SUB_BITS = 3;
+    inline constexpr size_t SUB_COUNT = 1 << SUB_BITS;
+    inline constexpr size_t BUCKET_COUNT = (64 - SUB_BITS + 1) * SUB_COUNT;
+
+    /// The Shard Of The Calling Thread, Assigned Round-Robin At The First Use
+    BASE_API size_t GetThreadShard();
+
+    /// Map The Value To The Histogram Bucket, Relative Error Less Than 1 / SUB_COUNT
+    constexpr size_t BucketIndex(const uint64_t value) {
+        if (value < SUB_COUNT)
+            return value;
+
+        const size_t exp = std::bit_width(value) - 1;
+        const size_t sub = (value >> (exp - SUB_BITS)) & (SUB_COUNT - 1);
+        return (exp - SUB_BITS + 1) * SUB_COUNT + sub;
+    }
+
+    /// The Largest Value Of The Bucket
+    constexpr uint64_t BucketUpperBound(const size_t index) {
+        if (index < SUB_COUNT)
+            return index;
+
+        const size_t exp = index / SUB_COUNT + SUB_BITS - 1;
+        const uint64_t sub = index % SUB_COUNT;
+        const uint64_t lower = (SUB_COUNT + sub) << (exp - SUB_BITS);
+        return lower + (static_cast<uint64_t>(1) << (exp - SUB_BITS)) - 1;
+    }
+}
+
+
+/**
+ * The Base Of All The Metrics, Only Used By The Registry To Export
+ */
+class BASE_API IMetricBase {
+
+public:
+    IMetricBase() = default;
+    virtual ~IMetricBase() = default;
+
+    DISABLE_COPY_MOVE(IMetricBase)
+
+    /// Append The Prometheus Text Samples Of This Metric
+    virtual void Export(std::string &output, const std::string &name, const std::string &labels) const = 0;
+};
+
+
+/**
+ * Monotonic Counter, Lock-Free And Sharded By Thread
+ */
+class BASE_API UMetricCounter final : public IMetricBase {
+
+    struct alignas(64) FShard {
+        std::atomic_int64_t value{0};
+    };
+
+public:
+    UMetricCounter() = default;
+
+    void Increment(const int64_t num = 1) {
+        mShards[metrics::GetThreadShard()].value.fetch_add(num, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] int64_t Value() const;
+
+    void Export(std::string &output, const std::string &name, const std::string &labels) const override;
+
+private:
+    std::array<FShard, metrics::SHARD_COUNT> mShards;
+};
+
+
+/**
+ * Gauge Of The Current Value, Updated By Add In Different Threads,
+ * Or By Set In A Single Thread, Or Sampled By The Collector When Exporting
+ */
+class BASE_API UMetricGauge final : public IMetricBase {
+
+    struct alignas(64) FShard {
+        std::atomic_int64_t value{0};
+    };
+
+public:
+    using ACollector = std::function<int64_t()>;
+
+    UMetricGauge() = default;
+
+    void Add(const int64_t num) {
+        mShards[metrics::GetThreadShard()].value.fetch_add(num, std::memory_order_relaxed);
+    }
+
+    void Sub(const int64_t num) {
+        Add(-num);
+    }
+
+    /// Do Not Mix With Add, The Shards Are Not Reset
+    void Set(const int64_t value) {
+        mBase.store(value, std::memory_order_relaxed);
+    }
+
+    /// The Collector Is Called In The Export Thread, Its Result Is Added To The Value
+    void SetCollector(const ACollector &collector);
+
+    [[nodiscard]] int64_t Value() const;
+
+    void Export(std::string &output, const std::string &name, const std::string &labels) const override;
+
+private:
+    std::array<FShard, metrics::SHARD_COUNT> mShards;
+    std::atomic_int64_t mBase{0};
+
+    ACollector mCollector;
+    mutable std::mutex mCollectorMutex;
+};
+
+
+/**
+ * HDR-Style Histogram With Log-Linear Buckets, Lock-Free And Sharded By Thread.
+ * Exported As A Prometheus Summary With The Common Quantiles
+ */
+class BASE_API UMetricHistogram final : public IMetricBase {
+
+    struct alignas(64) FShard {
+        std::array<std::atomic_uint64_t, metrics::BUCKET_COUNT> buckets{};
+        std::atomic_uint64_t count{0};
+        std::atomic_uint64_t sum{0};
+    };
+
+public:
+    /// Less Shards For The Rarely Written Histogram, Such As The Sampled Ones
+    explicit UMetricHistogram(size_t shards = metrics::SHARD_COUNT);
+
+    void Record(const uint64_t value) {
+        auto &shard = mShards[metrics::GetThreadShard() % mShards.size()];
+        shard.buckets[metrics::BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        shard.count.fetch_add(1, std::memory_order_relaxed);
+        shard.sum.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t Count() const;
+    [[nodiscard]] uint64_t Sum() const;
+
+    /// The Upper Bound Of The Bucket Where The Quantile Located, Quantile In [0, 1]
+    [[nodiscard]] uint64_t Percentile(double quantile) const;
+
+    void Export(std::string &output, const std::string &name, const std::string &labels) const override;
+
+private:
+    /// Merge All The Shards Into One Bucket Array
+    void Merge(std::array<uint64_t, metrics::BUCKET_COUNT> &buckets, uint64_t &count, uint64_t &sum) const;
+
+private:
+    std::vector<FShard> mShards;
+};
+
+
+/**
+ * Process Wide Registry Of The Metrics.
+ * The Returned Pointers Are Stable Until Process Exit, Cache Them In The Hot Path,
+ * The Lock Is Only Taken When Creating Or Exporting
+ */
+class BASE_API UMetricsRegistry final {
+
+    enum class EMetricType {
+        COUNTER,
+        GAUGE,
+        SUMMARY
+    };
+
+    struct FMetricFamily {
+        std::string help;
+        EMetricType type;
+        std::map<std::string, std::unique_ptr<IMetricBase>> metrics;
+    };
+
+    UMetricsRegistry() = default;
+
+public:
+    ~UMetricsRegistry() = default;
+
+    DISABLE_COPY_MOVE(UMetricsRegistry)
+
+    static UMetricsRegistry &Instance();
+
+    /// The Labels Are In Prometheus Form Without Braces, Such As service="gameworld"
+    UMetricCounter *GetCounter(const std::string &name, const std::string &help, const std::string &labels = {});
+    UMetricGauge *GetGauge(const std::string &name, const std::string &help, const std::string &labels = {});
+    UMetricHistogram *GetHistogram(const std::string &name, const std::string &help, const std::string &labels = {}, size_t shards = metrics::SHARD_COUNT);
+
+    /// Render All The Metrics In Prometheus Text Exposition Format
+    [[nodiscard]] std::string ExportPrometheus() const;
+
+private:
+    template<class Type, class... Args>
+    Type *GetOrCreate(const std::string &name, const std::string &help, const std::string &labels, EMetricType type, Args &&... args);
+
+private:
+    std::map<std::string, FMetricFamily> mFamilyMap;
+    mutable std::mutex mMutex;
+};
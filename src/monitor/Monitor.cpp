@@ -1,15 +1,49 @@
 #include "Monitor.h"
-#include "PluginBase.h"
+#include "Metrics.h"
+#include "PackageTracer.h"
+#include "AgentProfiler.h"
+#include "Server.h"
 
+#include <spdlog/spdlog.h>
+#include <filesystem>
+#include <fstream>
 #include <ranges>
 
-UMonitor::UMonitor() {
+
+UMonitor::UMonitor()
+    : mExportInterval(10),
+      mPort(0),
+      mProfileInterval(60),
+      mProfileTop(10) {
 }
 
 void UMonitor::Initial() {
     if (mState != EModuleState::CREATED)
         return;
 
+    const auto &cfg = GetServer()->GetServerConfig();
+
+    mFilePath = cfg["monitor"]["file"].as<std::string>();
+    mExportInterval = cfg["monitor"]["export_interval"].as<int>();
+    mPort = cfg["monitor"]["port"].as<uint16_t>();
+
+    UPackageTracer::SetSampleRate(cfg["monitor"]["trace_sample"].as<uint32_t>());
+
+    UAgentProfiler::Instance().SetEnable(cfg["monitor"]["profile"]["enable"].as<bool>());
+    mProfileInterval = cfg["monitor"]["profile"]["report_interval"].as<int>();
+    mProfileTop = cfg["monitor"]["profile"]["top"].as<size_t>();
+
+    if (mExportInterval <= 0) {
+        SPDLOG_WARN("{} - Invalid Export Interval {}, Use 10 Seconds", __FUNCTION__, mExportInterval);
+        mExportInterval = 10;
+    }
+
+    mExportTimer = make_unique<ASteadyTimer>(mIOContextPool.GetIOContext());
+    mProfileTimer = make_unique<ASteadyTimer>(mIOContextPool.GetIOContext());
+    mAcceptor = make_unique<ATcpAcceptor>(mIOContextPool.GetIOContext());
+
+    mIOContextPool.Start(1);
+
     mState = EModuleState::INITIALIZED;
 }
 
@@ -18,19 +52,169 @@ void UMonitor::Start() {
         return;
 
     mState = EModuleState::RUNNING;
+
+    if (!mFilePath.empty()) {
+        co_spawn(mIOContextPool.GetIOContext(), ExportLoop(), detached);
+    }
+
+    if (mPort > 0) {
+        co_spawn(mIOContextPool.GetIOContext(), WaitForScrape(mPort), detached);
+    }
+
+    if (UAgentProfiler::Instance().IsEnabled() && mProfileInterval > 0) {
+        co_spawn(mIOContextPool.GetIOContext(), ProfileLoop(), detached);
+    }
 }
 
 void UMonitor::Stop() {
     if (mState == EModuleState::STOPPED)
         return;
 
+    const bool bRunning = mState != EModuleState::CREATED;
     mState = EModuleState::STOPPED;
+
+    if (!bRunning)
+        return;
+
+    // The Export And The Scrape Coroutines Are Dropped With The Context
+    mIOContextPool.Stop();
+
+    // Write The Last Snapshot
+    if (!mFilePath.empty()) {
+        WriteMetricsFile();
+    }
 }
 
 UMonitor::~UMonitor() {
     Stop();
 }
 
+std::string UMonitor::ExportMetrics() const {
+    auto &registry = UMetricsRegistry::Instance();
+
+    for (const auto &plugin : mPluginMap | std::views::values) {
+        plugin->OnCollect(registry);
+    }
+
+    return registry.ExportPrometheus();
+}
+
+awaitable<void> UMonitor::ExportLoop() {
+    try {
+        auto point = std::chrono::steady_clock::now();
+
+        while (mState == EModuleState::RUNNING) {
+            point += std::chrono::seconds(mExportInterval);
+            mExportTimer->expires_at(point);
+
+            if (auto [ec] = co_await mExportTimer->async_wait(); ec)
+                break;
+
+            WriteMetricsFile();
+        }
+    } catch (const std::exception &e) {
+        SPDLOG_ERROR("{} - {}", __FUNCTION__, e.what());
+    }
+}
+
+awaitable<void> UMonitor::ProfileLoop() {
+    try {
+        auto point = std::chrono::steady_clock::now();
+
+        while (mState == EModuleState::RUNNING) {
+            point += std::chrono::seconds(mProfileInterval);
+            mProfileTimer->expires_at(point);
+
+            if (auto [ec] = co_await mProfileTimer->async_wait(); ec)
+                break;
+
+            mProfileReport = UAgentProfiler::Instance().BuildReport(mProfileTop);
+            SPDLOG_INFO("{} - {}", __FUNCTION__, mProfileReport);
+        }
+    } catch (const std::exception &e) {
+        SPDLOG_ERROR("{} - {}", __FUNCTION__, e.what());
+    }
+}
+
+void UMonitor::WriteMetricsFile() const {
+    // Write To The Temporary File Then Rename, The Reader Never Sees A Partial File
+    const auto temp = mFilePath + ".tmp";
+    {
+        std::ofstream output(temp, std::ios::trunc);
+        if (!output.is_open()) {
+            SPDLOG_ERROR("{} - Failed To Open {}", __FUNCTION__, temp);
+            return;
+        }
+        output << ExportMetrics();
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(temp, mFilePath, ec);
+    if (ec) {
+        SPDLOG_ERROR("{} - Failed To Rename {} - {}", __FUNCTION__, temp, ec.message());
+    }
+}
+
+awaitable<void> UMonitor::WaitForScrape(const uint16_t port) {
+    try {
+        // Only Listen On The Loopback, Expose It By The Local Agent If Needed
+        const asio::ip::tcp::endpoint endpoint(asio::ip::address_v4::loopback(), port);
+
+        mAcceptor->open(endpoint.protocol());
+        mAcceptor->set_option(asio::socket_base::reuse_address(true));
+        mAcceptor->bind(endpoint);
+        mAcceptor->listen();
+
+        SPDLOG_INFO("{} - Metrics Endpoint http://127.0.0.1:{}/metrics", __FUNCTION__, port);
+
+        while (mState == EModuleState::RUNNING) {
+            auto [ec, socket] = co_await mAcceptor->async_accept();
+            if (ec) {
+                if (ec == asio::error::operation_aborted)
+                    break;
+
+                SPDLOG_WARN("{} - {}", __FUNCTION__, ec.message());
+                continue;
+            }
+
+            co_spawn(mIOContextPool.GetIOContext(), HandleScrape(std::move(socket)), detached);
+        }
+    } catch (const std::exception &e) {
+        SPDLOG_ERROR("{} - {}", __FUNCTION__, e.what());
+    }
+}
+
+awaitable<void> UMonitor::HandleScrape(ATcpSocket socket) const {
+    static constexpr size_t MAX_REQUEST_SIZE = 8192;
+
+    std::string request;
+    if (auto [ec, len] = co_await asio::async_read_until(socket, asio::dynamic_buffer(request, MAX_REQUEST_SIZE), "\r\n\r\n"); ec)
+        co_return;
+
+    std::string body;
+    std::string status = "200 OK";
+
+    if (request.starts_with("GET /metrics ") || request.starts_with("GET / ")) {
+        body = ExportMetrics();
+    } else if (request.starts_with("GET /profile ")) {
+        body = mProfileReport;
+    } else {
+        status = "404 Not Found";
+    }
+
+    const auto response = std::format(
+        "HTTP/1.1 {}\r\n"
+        "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+        "Content-Length: {}\r\n"
+        "Connection: close\r\n\r\n{}", status, body.size(), body);
+
+    co_await asio::async_write(socket, asio::buffer(response));
+
+    std::error_code ec;
+    socket.shutdown(asio::ip::tcp::socket::shutdown_both, ec);
+    socket.close(ec);
+}
+
 // void UMonitor::OnAcceptClient(const std::shared_ptr<UConnection> &conn) {
 //     for (const auto &val : mPluginMap | std::views::values) {
 //         val->OnAcceptClient(conn);
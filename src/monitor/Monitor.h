@@ -1,6 +1,9 @@
 #pragma once
 
 #include "Module.h"
+#include "PluginBase.h"
+#include "base/Types.h"
+#include "base/SingleIOContextPool.h"
 
 #include <memory>
 #include <unordered_map>
@@ -8,9 +11,12 @@
 
 
 class UPlayerAgent;
-class IPluginBase;
 
 
+/**
+ * Export The Metrics Registry Periodically As A Prometheus Text File,
+ * And Optionally Serve It On The Local HTTP Port For Scraping
+ */
 class BASE_API UMonitor final : public IModuleBase {
 
     DECLARE_MODULE(UMonitor)
@@ -28,10 +34,63 @@ public:
         return "UMonitor";
     }
 
+    /// Create The Plugin Before The Module Start, It Will Be Collected Before Every Export
+    template<class Type>
+    requires std::derived_from<Type, IPluginBase>
+    Type *CreatePlugin();
+
+    /// Collect The Plugins And Render All The Metrics
+    [[nodiscard]] std::string ExportMetrics() const;
+
     // void OnAcceptClient(const std::shared_ptr<UAgent> &conn);
 
+private:
+    awaitable<void> ExportLoop();
+    awaitable<void> ProfileLoop();
+    awaitable<void> WaitForScrape(uint16_t port);
+    awaitable<void> HandleScrape(ATcpSocket socket) const;
+
+    void WriteMetricsFile() const;
+
 private:
     std::unordered_map<std::string, std::unique_ptr<IPluginBase>> mPluginMap;
+
+    /** Export In The Independent Thread, Do Not Disturb The Logic Threads **/
+    USingleIOContextPool mIOContextPool;
+
+    unique_ptr<ASteadyTimer> mExportTimer;
+    unique_ptr<ASteadyTimer> mProfileTimer;
+    unique_ptr<ATcpAcceptor> mAcceptor;
+
+    /** The Text File For The Node Exporter, Empty To Disable **/
+    std::string mFilePath;
+
+    /** Export Interval In Seconds **/
+    int mExportInterval;
+
+    /** Local HTTP Port, Zero To Disable **/
+    uint16_t mPort;
+
+    /** Hot Agent Report Interval In Seconds And The Count Of Agents **/
+    int mProfileInterval;
+    size_t mProfileTop;
+
+    /** The Last Hot Agent Report, Only Accessed In The Monitor Thread **/
+    std::string mProfileReport;
 };
 
 
+template<class Type>
+requires std::derived_from<Type, IPluginBase>
+inline Type *UMonitor::CreatePlugin() {
+    if (mState >= EModuleState::RUNNING)
+        return nullptr;
+
+    auto plugin = std::make_unique<Type>();
+    auto *pResult = plugin.get();
+
+    plugin->SetUpModule(this);
+    mPluginMap.insert_or_assign(plugin->GetPluginName(), std::move(plugin));
+
+    return pResult;
+}
@@ -0,0 +1,157 @@
+#include "PackageTracer.h"
+#include "Metrics.h"
+#include "base/Package.h"
+
+#include <absl/container/flat_hash_map.h>
+#include <format>
+
+
+namespace {
+    // The Segment Is Named By The Hop It Reaches, Plus The Two Totals
+    constexpr size_t SEGMENT_TOTAL = static_cast<size_t>(ETraceHop::COUNT);
+    constexpr size_t SEGMENT_ROUND_TRIP = SEGMENT_TOTAL + 1;
+
+    constexpr const char *SEGMENT_NAMES[] = {
+        "read", "route", "enqueue", "execute", "handled", "reply", "write", "total", "round_trip"
+    };
+
+    // The Sampled Histograms Are Rarely Written, Do Not Need Many Shards
+    constexpr size_t TRACE_HISTOGRAM_SHARDS = 2;
+
+    thread_local uint32_t tSampleCounter = 0;
+
+    // The Request Being Handled In This Thread
+    thread_local const FPackageTrace *tCurrentTrace = nullptr;
+
+    // Avoid The Registry Lock When Recording
+    thread_local absl::flat_hash_map<uint64_t, UMetricHistogram *> tHistogramCache;
+
+    UMetricCounter *SampledCounter() {
+        static auto *counter = UMetricsRegistry::Instance().GetCounter("uranus_trace_sampled_total", "The Player Requests Sampled By The Package Tracer");
+        return counter;
+    }
+}
+
+std::atomic_uint32_t UPackageTracer::sSampleRate{0};
+
+void UPackageTracer::SetSampleRate(const uint32_t rate) {
+    sSampleRate.store(rate, std::memory_order_relaxed);
+}
+
+uint32_t UPackageTracer::GetSampleRate() {
+    return sSampleRate.load(std::memory_order_relaxed);
+}
+
+FPackageTrace *UPackageTracer::GetSampledTrace(IPackage_Interface *pkg) {
+    if (pkg == nullptr)
+        return nullptr;
+
+    auto *trace = pkg->GetTrace();
+    if (trace == nullptr || !trace->bSampled)
+        return nullptr;
+
+    return trace;
+}
+
+void UPackageTracer::Begin(IPackage_Interface *pkg) {
+    const auto rate = sSampleRate.load(std::memory_order_relaxed);
+    if (rate == 0 || pkg == nullptr)
+        return;
+
+    if (++tSampleCounter < rate)
+        return;
+
+    tSampleCounter = 0;
+
+    auto *trace = pkg->GetTrace();
+    if (trace == nullptr)
+        return;
+
+    trace->Reset();
+    trace->packageID = pkg->GetPackageID();
+    trace->bSampled = true;
+    trace->Stamp(ETraceHop::READ);
+
+    SampledCounter()->Increment();
+}
+
+void UPackageTracer::Stamp(IPackage_Interface *pkg, const ETraceHop hop) {
+    if (auto *trace = GetSampledTrace(pkg)) {
+        trace->Stamp(hop);
+    }
+}
+
+void UPackageTracer::Inherit(IPackage_Interface *pkg) {
+    if (tCurrentTrace == nullptr || pkg == nullptr)
+        return;
+
+    if (auto *trace = pkg->GetTrace()) {
+        *trace = *tCurrentTrace;
+    }
+}
+
+void UPackageTracer::Finish(IPackage_Interface *pkg) {
+    auto *trace = GetSampledTrace(pkg);
+    if (trace == nullptr)
+        return;
+
+    trace->Stamp(ETraceHop::WRITE);
+
+    Record(*trace, ETraceHop::REPLY, ETraceHop::WRITE);
+    RecordSegment(trace->packageID, SEGMENT_ROUND_TRIP, trace->GetStamp(ETraceHop::READ), trace->GetStamp(ETraceHop::WRITE));
+
+    // Only Recorded Once Even If The Package Is Sent Again
+    trace->bSampled = false;
+}
+
+void UPackageTracer::Record(const FPackageTrace &trace, const ETraceHop from, const ETraceHop to) {
+    auto previous = trace.GetStamp(from);
+
+    for (auto idx = static_cast<size_t>(from) + 1; idx <= static_cast<size_t>(to); ++idx) {
+        const auto stamp = trace.stamps[idx];
+        if (stamp == 0)
+            continue;
+
+        RecordSegment(trace.packageID, idx, previous, stamp);
+        previous = stamp;
+    }
+}
+
+void UPackageTracer::RecordSegment(const uint32_t packageID, const size_t segment, const int64_t begin, const int64_t end) {
+    if (begin == 0 || end < begin)
+        return;
+
+    const uint64_t key = static_cast<uint64_t>(packageID) << 8 | segment;
+
+    auto &histogram = tHistogramCache[key];
+    if (histogram == nullptr) {
+        histogram = UMetricsRegistry::Instance().GetHistogram(
+            "uranus_package_hop_microseconds", "The Sampled Latency Of Each Hop Of The Player Request",
+            std::format("package=\"{}\",hop=\"{}\"", packageID, SEGMENT_NAMES[segment]),
+            TRACE_HISTOGRAM_SHARDS);
+    }
+
+    histogram->Record((end - begin) / 1000);
+}
+
+UPackageTracer::FHandleScope::FHandleScope(IPackage_Interface *pkg)
+    : mTrace(GetSampledTrace(pkg)),
+      mPrevious(tCurrentTrace) {
+    if (mTrace == nullptr)
+        return;
+
+    mTrace->Stamp(ETraceHop::EXECUTE);
+    tCurrentTrace = mTrace;
+}
+
+UPackageTracer::FHandleScope::~FHandleScope() {
+    if (mTrace == nullptr)
+        return;
+
+    tCurrentTrace = mPrevious;
+
+    mTrace->Stamp(ETraceHop::HANDLED);
+
+    Record(*mTrace, ETraceHop::READ, ETraceHop::HANDLED);
+    RecordSegment(mTrace->packageID, SEGMENT_TOTAL, mTrace->GetStamp(ETraceHop::READ), mTrace->GetStamp(ETraceHop::HANDLED));
+}
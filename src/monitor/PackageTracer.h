@@ -0,0 +1,62 @@
+#pragma once
+
+#include "base/PackageTrace.h"
+
+#include <atomic>
+
+
+class IPackage_Interface;
+
+
+/**
+ * Sample The Player Requests And Stamp Them At Each Hop Of The Actor Pipeline,
+ * The Hop Latencies Are Aggregated Into Per-Package Histograms In UMetricsRegistry.
+ * The Package Not Sampled Only Costs A Flag Check At Each Hop
+ */
+class BASE_API UPackageTracer final {
+
+public:
+    UPackageTracer() = delete;
+
+    /// Sample One Of Every Rate Requests Per Thread, Zero To Disable
+    static void SetSampleRate(uint32_t rate);
+    [[nodiscard]] static uint32_t GetSampleRate();
+
+    /// Decide The Sampling And Stamp The READ Hop, Called After The Request Decoded
+    static void Begin(IPackage_Interface *pkg);
+
+    /// Stamp The Hop If The Package Is Sampled
+    static void Stamp(IPackage_Interface *pkg, ETraceHop hop);
+
+    /// Copy The Trace Of The Request Being Handled In This Thread Into The New Package
+    static void Inherit(IPackage_Interface *pkg);
+
+    /// Stamp The WRITE Hop Of The Reply And Record The Outbound Latency
+    static void Finish(IPackage_Interface *pkg);
+
+    /**
+     * Stamp EXECUTE And HANDLED Around IActorBase::OnPackage And Record The Inbound Latency,
+     * The Packages Built In This Scope Inherit The Trace Of The Request
+     */
+    class BASE_API FHandleScope final {
+
+    public:
+        explicit FHandleScope(IPackage_Interface *pkg);
+        ~FHandleScope();
+
+        DISABLE_COPY_MOVE(FHandleScope)
+
+    private:
+        FPackageTrace *mTrace;
+        const FPackageTrace *mPrevious;
+    };
+
+private:
+    [[nodiscard]] static FPackageTrace *GetSampledTrace(IPackage_Interface *pkg);
+
+    static void Record(const FPackageTrace &trace, ETraceHop from, ETraceHop to);
+    static void RecordSegment(uint32_t packageID, size_t segment, int64_t begin, int64_t end);
+
+private:
+    static std::atomic_uint32_t sSampleRate;
+};
@@ -17,6 +17,10 @@ UServer *IPluginBase::GetServer() const {
     return mOwner->GetServer();
 }
 
+void IPluginBase::OnCollect(UMetricsRegistry &registry) {
+    // Implement In SubClass
+}
+
 // void IPluginBase::OnAcceptClient(const std::shared_ptr<UConnection> &conn) {
 // }
 
@@ -5,6 +5,7 @@
 #include <memory>
 
 class UMonitor;
+class UMetricsRegistry;
 class UServer;
 class UPlayerAgent;
 
@@ -23,6 +24,9 @@ public:
     [[nodiscard]] UMonitor *GetMonitor() const;
     [[nodiscard]] UServer *GetServer() const;
 
+    /// Called In The Monitor Thread Before Every Export, Refresh The Sampled Metrics Here
+    virtual void OnCollect(UMetricsRegistry &registry);
+
     // virtual void OnAcceptClient(const std::shared_ptr<UAgent> &conn);
 
 private:
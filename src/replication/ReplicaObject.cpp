@@ -0,0 +1,130 @@
+#include "ReplicaObject.h"
+
+#include <stdexcept>
+#include <format>
+#include <bit>
+
+
+void replication::WriteVarint(std::string &output, uint64_t value) {
+    while (value >= 0x80) {
+        output.push_back(static_cast<char>(value & 0x7F | 0x80));
+        value >>= 7;
+    }
+    output.push_back(static_cast<char>(value));
+}
+
+bool replication::ReadVarint(const uint8_t *&cursor, const uint8_t *end, uint64_t &value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && cursor < end; shift += 7) {
+        const uint8_t byte = *cursor++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+            return true;
+    }
+    return false;
+}
+
+UReplicaObject::UReplicaObject(const int64_t id, const uint32_t type, const size_t fieldCount)
+    : mObjectID(id),
+      mObjectType(type),
+      mVersion(0) {
+
+    if (fieldCount == 0 || fieldCount > MAX_FIELD_COUNT)
+        throw std::invalid_argument(std::format("{} - Field Count {} Out Of Range", __FUNCTION__, fieldCount));
+
+    mFields.resize(fieldCount);
+
+    // All The Fields Are Sent At The First Time, Even Left As The Default Value
+    MarkAllDirty();
+}
+
+UReplicaObject::~UReplicaObject() = default;
+
+int64_t UReplicaObject::GetObjectID() const {
+    return mObjectID;
+}
+
+uint32_t UReplicaObject::GetObjectType() const {
+    return mObjectType;
+}
+
+uint32_t UReplicaObject::GetVersion() const {
+    return mVersion;
+}
+
+size_t UReplicaObject::GetFieldCount() const {
+    return mFields.size();
+}
+
+bool UReplicaObject::Set(const size_t index, AReplicaValue value) {
+    if (index >= mFields.size())
+        return false;
+
+    auto &field = mFields[index];
+    if (field.value == value)
+        return false;
+
+    field.value = std::move(value);
+    field.version = ++mVersion;
+
+    return true;
+}
+
+const AReplicaValue &UReplicaObject::Get(const size_t index) const {
+    return mFields.at(index).value;
+}
+
+void UReplicaObject::MarkAllDirty() {
+    ++mVersion;
+    for (auto &field : mFields) {
+        field.version = mVersion;
+    }
+}
+
+uint64_t UReplicaObject::GetChangedMask(const uint32_t baseline) const {
+    if (baseline >= mVersion)
+        return 0;
+
+    uint64_t mask = 0;
+    for (size_t idx = 0; idx < mFields.size(); ++idx) {
+        if (mFields[idx].version > baseline) {
+            mask |= static_cast<uint64_t>(1) << idx;
+        }
+    }
+    return mask;
+}
+
+bool UReplicaObject::EncodeDelta(const uint32_t baseline, std::string &output) const {
+    const uint64_t mask = GetChangedMask(baseline);
+    if (mask == 0)
+        return false;
+
+    replication::WriteVarint(output, replication::ZigZagEncode(mObjectID));
+    replication::WriteVarint(output, mObjectType);
+    replication::WriteVarint(output, mVersion);
+    replication::WriteVarint(output, mask);
+
+    for (uint64_t rest = mask; rest != 0; rest &= rest - 1) {
+        const auto &value = mFields[std::countr_zero(rest)].value;
+
+        if (const auto *val = std::get_if<int64_t>(&value)) {
+            output.push_back(static_cast<char>(replication::EValueTag::INTEGER));
+            replication::WriteVarint(output, replication::ZigZagEncode(*val));
+        } else if (const auto *val = std::get_if<double>(&value)) {
+            output.push_back(static_cast<char>(replication::EValueTag::FLOAT));
+
+            // Little-Endian On The Wire
+            auto bits = std::bit_cast<uint64_t>(*val);
+            for (int idx = 0; idx < 8; ++idx) {
+                output.push_back(static_cast<char>(bits & 0xFF));
+                bits >>= 8;
+            }
+        } else if (const auto *val = std::get_if<std::string>(&value)) {
+            output.push_back(static_cast<char>(replication::EValueTag::STRING));
+            replication::WriteVarint(output, val->size());
+            output.append(*val);
+        }
+    }
+
+    return true;
+}
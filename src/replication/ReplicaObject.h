@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Common.h"
+
+#include <variant>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+/** The Value Of One Replicated Field, The Layout Of The Fields Is Known To Both Sides By The Type **/
+using AReplicaValue = std::variant<int64_t, double, std::string>;
+
+
+namespace replication {
+    /** The Tag Written Before Every Value, So The Client Can Skip The Field It Does Not Know **/
+    enum class EValueTag : uint8_t {
+        INTEGER,
+        FLOAT,
+        STRING
+    };
+
+    BASE_API void WriteVarint(std::string &output, uint64_t value);
+
+    /// Advance The Cursor, False If The Buffer Ends Before The Varint
+    BASE_API bool ReadVarint(const uint8_t *&cursor, const uint8_t *end, uint64_t &value);
+
+    constexpr uint64_t ZigZagEncode(const int64_t value) {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    constexpr int64_t ZigZagDecode(const uint64_t value) {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+}
+
+
+/**
+ * The Object Whose Fields Are Replicated To The Clients By Delta;
+ * Every Effective Change Bumps The Version Of The Object And Stamps It On The Field,
+ * So The Delta Against A Baseline Version Is Just The Fields Stamped After It.
+ * The Version Zero Means The Client Has Nothing, The Delta Against It Is The Full State.
+ * Not Thread Safe, Owned And Changed By One Actor
+ */
+class BASE_API UReplicaObject final {
+
+    struct FField {
+        AReplicaValue value;
+        uint32_t version = 0;
+    };
+
+public:
+    /** The Changed Fields Are Written As A 64 Bits Mask **/
+    static constexpr size_t MAX_FIELD_COUNT = 64;
+
+    UReplicaObject(int64_t id, uint32_t type, size_t fieldCount);
+    ~UReplicaObject();
+
+    [[nodiscard]] int64_t GetObjectID() const;
+    [[nodiscard]] uint32_t GetObjectType() const;
+    [[nodiscard]] uint32_t GetVersion() const;
+    [[nodiscard]] size_t GetFieldCount() const;
+
+    /// Return False If The Index Is Out Of Range Or The Value Is Not Changed
+    bool Set(size_t index, AReplicaValue value);
+
+    [[nodiscard]] const AReplicaValue &Get(size_t index) const;
+
+    template<class Type>
+    [[nodiscard]] const Type *GetAs(const size_t index) const {
+        return std::get_if<Type>(&Get(index));
+    }
+
+    /// Stamp All The Fields As Changed, The Next Delta Of Every Client Carries The Full State
+    void MarkAllDirty();
+
+    /// The Mask Of The Fields Changed After The Baseline Version
+    [[nodiscard]] uint64_t GetChangedMask(uint32_t baseline) const;
+
+    /// Append The Object ID, Type, Version, The Changed Mask And The Values Of The Changed Fields;
+    /// Return False And Append Nothing If Nothing Changed After The Baseline
+    bool EncodeDelta(uint32_t baseline, std::string &output) const;
+
+private:
+    const int64_t mObjectID;
+    const uint32_t mObjectType;
+
+    std::vector<FField> mFields;
+    uint32_t mVersion;
+};
@@ -0,0 +1,110 @@
+#include "Replicator.h"
+#include "base/ByteArray.h"
+
+#include <algorithm>
+
+
+UReplicator::UReplicator()
+    : mSequence(0) {
+}
+
+UReplicator::~UReplicator() = default;
+
+bool UReplicator::Collect(const std::vector<const UReplicaObject *> &objects, std::string &payload) {
+    std::string body;
+    FPending pending;
+
+    uint64_t count = 0;
+
+    std::unique_lock lock(mMutex);
+
+    for (const auto *object : objects) {
+        if (object == nullptr)
+            continue;
+
+        const auto iter = mAcknowledged.find(object->GetObjectID());
+        const uint32_t baseline = iter != mAcknowledged.end() ? iter->second : 0;
+
+        if (!object->EncodeDelta(baseline, body))
+            continue;
+
+        pending.versions.emplace_back(object->GetObjectID(), object->GetVersion());
+        ++count;
+    }
+
+    if (count == 0)
+        return false;
+
+    pending.sequence = ++mSequence;
+
+    payload.clear();
+    payload.reserve(body.size() + 10);
+
+    replication::WriteVarint(payload, pending.sequence);
+    replication::WriteVarint(payload, count);
+    payload.append(body);
+
+    mPending.emplace_back(std::move(pending));
+    return true;
+}
+
+void UReplicator::Acknowledge(const uint32_t sequence) {
+    std::unique_lock lock(mMutex);
+
+    // The Payloads Collected By Different Actors May Be Written Out Of Order, Only The Written One Is Delivered
+    const auto iter = std::ranges::find_if(mPending, [sequence](const FPending &pending) {
+        return pending.sequence == sequence;
+    });
+
+    // Already Dropped By Reset
+    if (iter == mPending.end())
+        return;
+
+    // The Client Drops The Older Delta, The Baseline Never Goes Back
+    for (const auto &[id, version] : iter->versions) {
+        auto &acked = mAcknowledged[id];
+        acked = std::max(acked, version);
+    }
+
+    mPending.erase(iter);
+}
+
+std::optional<uint32_t> UReplicator::ReadSequence(const FByteArray &payload) {
+    const uint8_t *cursor = payload.Data();
+    uint64_t sequence = 0;
+
+    if (!replication::ReadVarint(cursor, cursor + payload.Size(), sequence) || sequence > UINT32_MAX)
+        return std::nullopt;
+
+    return static_cast<uint32_t>(sequence);
+}
+
+void UReplicator::Forget(const int64_t id) {
+    std::unique_lock lock(mMutex);
+
+    mAcknowledged.erase(id);
+
+    // Or The Payload In Flight Acknowledges It Again
+    for (auto &pending : mPending) {
+        std::erase_if(pending.versions, [id](const auto &pair) {
+            return pair.first == id;
+        });
+    }
+}
+
+void UReplicator::Reset() {
+    std::unique_lock lock(mMutex);
+    mAcknowledged.clear();
+    mPending.clear();
+}
+
+uint32_t UReplicator::GetAcknowledged(const int64_t id) const {
+    std::unique_lock lock(mMutex);
+    const auto iter = mAcknowledged.find(id);
+    return iter != mAcknowledged.end() ? iter->second : 0;
+}
+
+size_t UReplicator::GetPendingCount() const {
+    std::unique_lock lock(mMutex);
+    return mPending.size();
+}
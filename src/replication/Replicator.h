@@ -0,0 +1,63 @@
+#pragma once
+
+#include "ReplicaObject.h"
+
+#include <unordered_map>
+#include <optional>
+#include <deque>
+#include <mutex>
+
+
+class FByteArray;
+
+
+/**
+ * The Replication State Of One Client, The Acknowledged Version Of Every Object It Holds;
+ * Collect Encodes Each Object Against Its Acknowledged Version, So A Packet Still In Flight
+ * Is Covered By The Next One, And An Object Never Acknowledged Is Sent In Full.
+ * The Payload Starts With The Sequence, Followed By The Object Count And The Deltas.
+ * The Client Drops The Delta Of An Object Not Newer Than The Version It Applied, For The Payloads
+ * Collected By Different Actors May Reach The Write Loop Out Of Order.
+ * Thread Safe, Collected By The Owner Actor And Acknowledged By The Write Loop Of The Agent
+ */
+class BASE_API UReplicator final {
+
+    /// The Versions Carried By One Collected Payload
+    struct FPending {
+        uint32_t sequence;
+        std::vector<std::pair<int64_t, uint32_t>> versions;
+    };
+
+public:
+    UReplicator();
+    ~UReplicator();
+
+    DISABLE_COPY_MOVE(UReplicator)
+
+    /// Encode The Changed Objects Into One Payload, False If None Of Them Changed
+    bool Collect(const std::vector<const UReplicaObject *> &objects, std::string &payload);
+
+    /// The Payload Of The Sequence Is Delivered, The Earlier Ones May Still Be In Flight
+    void Acknowledge(uint32_t sequence);
+
+    /// Read The Sequence From The Head Of The Payload Built By Collect
+    static std::optional<uint32_t> ReadSequence(const FByteArray &payload);
+
+    /// The Object Is Out Of The Client, Send It In Full If It Comes Back
+    void Forget(int64_t id);
+
+    /// The Client Is Reconnected Or Gone, It Holds Nothing
+    void Reset();
+
+    /// Zero If The Client Has Not Acknowledged Any Version Of The Object
+    [[nodiscard]] uint32_t GetAcknowledged(int64_t id) const;
+
+    [[nodiscard]] size_t GetPendingCount() const;
+
+private:
+    std::unordered_map<int64_t, uint32_t> mAcknowledged;
+    std::deque<FPending> mPending;
+
+    uint32_t mSequence;
+    mutable std::mutex mMutex;
+};
@@ -6,14 +6,42 @@
 #include "service/ServiceAgent.h"
 #include "gateway/Gateway.h"
 #include "gateway/PlayerAgent.h"
+#include "factory/CodecFactory.h"
+#include "monitor/PackageTracer.h"
 
+#include <format>
 
-URouteModule::URouteModule() {
+
+namespace {
+    /// The Frozen Package Is Shared, Fork One From The Pool Of The Receiver,
+    /// So The Header And The Trace Of This Delivery Are Its Own
+    FPackageHandle PrepareDelivery(const IAgentBase &agent, const FPackageHandle &pkg) {
+        auto delivery = agent.PrepareDelivery(pkg);
+        if (delivery != nullptr) {
+            UPackageTracer::Stamp(delivery.Get(), ETraceHop::ROUTE);
+        }
+        return delivery;
+    }
+}
+
+URouteModule::URouteModule()
+    : mServiceModule(nullptr),
+      mGateway(nullptr) {
 }
 
 URouteModule::~URouteModule() {
 }
 
+void URouteModule::Initial() {
+    if (mState != EModuleState::CREATED)
+        throw std::logic_error(std::format("{} - Module[{}] Not In CREATED State", __FUNCTION__, GetModuleName()));
+
+    mServiceModule = GetServer()->GetModule<UServiceModule>();
+    mGateway = GetServer()->GetModule<UGateway>();
+
+    mState = EModuleState::INITIALIZED;
+}
+
 void URouteModule::PostPackage(const FPackageHandle &pkg, const int64_t pid) const {
     if (mState != EModuleState::RUNNING)
         return;
@@ -24,12 +52,14 @@ void URouteModule::PostPackage(const FPackageHandle &pkg, const int64_t pid) con
     int64_t target = pkg->GetTarget();
 
     if (target > 0) {
-        const auto *serviceModule = GetServer()->GetModule<UServiceModule>();
+        const auto *serviceModule = mServiceModule;
         if (!serviceModule)
             return;
 
         if (const auto agent = serviceModule->FindService(target)) {
-            agent->PushPackage(pkg);
+            if (const auto delivery = PrepareDelivery(*agent, pkg)) {
+                agent->PushPackage(delivery);
+            }
         }
 
         return;
@@ -42,12 +72,14 @@ void URouteModule::PostPackage(const FPackageHandle &pkg, const int64_t pid) con
     if (target < 0)
         return;
 
-    const auto *gateway = GetServer()->GetModule<UGateway>();
+    const auto *gateway = mGateway;
     if (!gateway)
         return;
 
     if (const auto agent = gateway->FindPlayer(target)) {
-        agent->PushPackage(pkg);
+        if (const auto delivery = PrepareDelivery(*agent, pkg)) {
+            agent->PushPackage(delivery);
+        }
     }
 }
 
@@ -58,13 +90,55 @@ void URouteModule::PostPackage(const std::string &name, const FPackageHandle &pk
     if (name.empty() || pkg == nullptr)
         return;
 
-    const auto *serviceModule = GetServer()->GetModule<UServiceModule>();
+    const auto *serviceModule = mServiceModule;
     if (!serviceModule)
         return;
 
+    // The Target Is Written Here, Never On The Handle Of The Caller, Deliver A Fork Sharing The Payload
+    pkg->Freeze();
+
     if (const auto agent = serviceModule->FindService(name)) {
-        pkg->SetTarget(agent->GetServiceID());
-        agent->PushPackage(pkg);
+        if (const auto delivery = PrepareDelivery(*agent, pkg)) {
+            delivery->SetTarget(agent->GetServiceID());
+            agent->PushPackage(delivery);
+        }
+    }
+}
+
+void URouteModule::Multicast(const bool bToService, const std::vector<int64_t> &list, const FPackageHandle &pkg) const {
+    if (mState != EModuleState::RUNNING)
+        return;
+
+    if (list.empty() || pkg == nullptr)
+        return;
+
+    // Every Receiver Gets A Fork Sharing The Payload, The Source Is Never Pushed Itself
+    pkg->Freeze();
+
+    if (bToService) {
+        const auto *serviceModule = mServiceModule;
+        if (!serviceModule)
+            return;
+
+        for (const auto target : list) {
+            if (const auto agent = serviceModule->FindService(target)) {
+                if (const auto delivery = PrepareDelivery(*agent, pkg)) {
+                    delivery->SetTarget(static_cast<int32_t>(target));
+                    agent->PushPackage(delivery);
+                }
+            }
+        }
+    } else {
+        const auto *gateway = mGateway;
+        if (!gateway)
+            return;
+
+        for (const auto &agent : gateway->GetPlayerList(list)) {
+            if (const auto delivery = PrepareDelivery(*agent, pkg)) {
+                delivery->SetTarget(PLAYER_TARGET_ID);
+                agent->PushPackage(delivery);
+            }
+        }
     }
 }
 
@@ -76,7 +150,7 @@ void URouteModule::PostTask(const bool bToService, const int64_t target, const A
         return;
 
     if (bToService) {
-        const auto *serviceModule = GetServer()->GetModule<UServiceModule>();
+        const auto *serviceModule = mServiceModule;
         if (!serviceModule)
             return;
 
@@ -84,7 +158,7 @@ void URouteModule::PostTask(const bool bToService, const int64_t target, const A
             agent->PushTask(task);
         }
     } else {
-        const auto *gateway = GetServer()->GetModule<UGateway>();
+        const auto *gateway = mGateway;
         if (!gateway)
             return;
 
@@ -101,7 +175,7 @@ void URouteModule::PostTask(const std::string &name, const AActorTask &task) con
     if (name.empty() || task == nullptr)
         return;
 
-    const auto *serviceModule = GetServer()->GetModule<UServiceModule>();
+    const auto *serviceModule = mServiceModule;
     if (!serviceModule)
         return;
 
@@ -110,6 +184,55 @@ void URouteModule::PostTask(const std::string &name, const AActorTask &task) con
     }
 }
 
+bool URouteModule::CallTask(const bool bToService, const int64_t target, const AActorTask &task) const {
+    if (mState != EModuleState::RUNNING)
+        return false;
+
+    if (target < 0 || task == nullptr)
+        return false;
+
+    if (bToService) {
+        const auto *serviceModule = mServiceModule;
+        if (!serviceModule)
+            return false;
+
+        if (const auto agent = serviceModule->FindService(target)) {
+            agent->PushTaskInline(task);
+            return true;
+        }
+    } else {
+        const auto *gateway = mGateway;
+        if (!gateway)
+            return false;
+
+        if (const auto agent = gateway->FindPlayer(target)) {
+            agent->PushTaskInline(task);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool URouteModule::CallTask(const std::string &name, const AActorTask &task) const {
+    if (mState != EModuleState::RUNNING)
+        return false;
+
+    if (name.empty() || task == nullptr)
+        return false;
+
+    const auto *serviceModule = mServiceModule;
+    if (!serviceModule)
+        return false;
+
+    if (const auto agent = serviceModule->FindService(name)) {
+        agent->PushTaskInline(task);
+        return true;
+    }
+
+    return false;
+}
+
 void URouteModule::SendToClient(int64_t pid, const FPackageHandle &pkg) const {
     if (mState != EModuleState::RUNNING)
         return;
@@ -117,13 +240,63 @@ void URouteModule::SendToClient(int64_t pid, const FPackageHandle &pkg) const {
     if (pid <= 0 || pkg == nullptr)
         return;
 
-    auto *gateway = GetServer()->GetModule<UGateway>();
+    auto *gateway = mGateway;
+    if (!gateway)
+        return;
+
+    if (const auto agent = gateway->FindPlayer(pid)) {
+        if (const auto delivery = agent->PrepareDelivery(pkg)) {
+            delivery->SetTarget(CLIENT_TARGET_ID);
+            agent->SendPackage(delivery);
+        }
+    }
+}
+
+void URouteModule::BroadcastToClients(const std::vector<int64_t> &list, const FPackageHandle &pkg) const {
+    if (mState != EModuleState::RUNNING)
+        return;
+
+    if (list.empty() || pkg == nullptr)
+        return;
+
+    const auto *gateway = mGateway;
+    if (!gateway)
+        return;
+
+    if (const auto frame = GetServer()->GetCodecFactory()->EncodeFrame(pkg.Get())) {
+        gateway->Broadcast(list, frame);
+    }
+}
+
+void URouteModule::BroadcastToAllClients(const FPackageHandle &pkg) const {
+    if (mState != EModuleState::RUNNING)
+        return;
+
+    if (pkg == nullptr)
+        return;
+
+    const auto *gateway = mGateway;
+    if (!gateway)
+        return;
+
+    if (const auto frame = GetServer()->GetCodecFactory()->EncodeFrame(pkg.Get())) {
+        gateway->BroadcastAll(frame);
+    }
+}
+
+void URouteModule::ReplicateToClient(const int64_t pid, const std::vector<const UReplicaObject *> &objects, const FPackageHandle &pkg) const {
+    if (mState != EModuleState::RUNNING)
+        return;
+
+    if (pid <= 0 || objects.empty() || pkg == nullptr)
+        return;
+
+    auto *gateway = mGateway;
     if (!gateway)
         return;
 
     if (const auto agent = gateway->FindPlayer(pid)) {
-        pkg->SetTarget(CLIENT_TARGET_ID);
-        agent->SendPackage(pkg);
+        agent->Replicate(objects, pkg);
     }
 }
 
@@ -131,7 +304,7 @@ std::map<int64_t, std::string> URouteModule::GetRouteMap() const {
     if (mState != EModuleState::RUNNING)
         return {};
 
-    if (auto *serviceModule = GetServer()->GetModule<UServiceModule>()) {
+    if (auto *serviceModule = mServiceModule) {
         return serviceModule->GetAllServiceMap();
     }
 
@@ -4,10 +4,14 @@
 #include "base/Recycler.h"
 
 #include <map>
+#include <vector>
 
 
 class IPackage_Interface;
 class IActorBase;
+class UReplicaObject;
+class UServiceModule;
+class UGateway;
 
 using FPackageHandle = FRecycleHandle<IPackage_Interface>;
 using AActorTask = std::function<void(IActorBase *)>;
@@ -17,6 +21,13 @@ class BASE_API URouteModule final : public IModuleBase {
 
     DECLARE_MODULE(URouteModule)
 
+    /** Looked Up Once At Initial, All The Modules Are Created Before The Server Initial **/
+    UServiceModule *mServiceModule;
+    UGateway *mGateway;
+
+protected:
+    void Initial() override;
+
 public:
     URouteModule();
     ~URouteModule() override;
@@ -28,17 +39,37 @@ public:
     /// If Target Equal PLAYER_TARGET_ID, Then Use pid
     void PostPackage(const FPackageHandle &pkg, int64_t pid = -1) const;
 
-    /// Only Post To Service
+    /// Only Post To Service, The Package Is Frozen And A Fork Is Delivered With The Target Of The Service
     void PostPackage(const std::string &name, const FPackageHandle &pkg) const;
 
+    /// Freeze The Package And Post A Fork To Each Target, The Payload Shared Without Copying;
+    /// If ToService Is True, Targets Are Service IDs, Else Player IDs
+    void Multicast(bool bToService, const std::vector<int64_t> &list, const FPackageHandle &pkg) const;
+
     /// If ToService Is True, Target Is Service ID, Else Target Is Player ID
     void PostTask(bool bToService, int64_t target, const AActorTask &task) const;
 
     /// Only Post To Service
     void PostTask(const std::string &name, const AActorTask &task) const;
 
+    /// As PostTask, But Tell The Caller Waiting For The Reply; False If The Target Not Found.
+    /// The Caller Awaits The Reply, So The Task May Run Inline When The Callee Is Idle In The Same Thread
+    bool CallTask(bool bToService, int64_t target, const AActorTask &task) const;
+
+    /// Only Call The Service
+    bool CallTask(const std::string &name, const AActorTask &task) const;
+
     /// Send Package To Client
     void SendToClient(int64_t pid, const FPackageHandle &pkg) const;
 
+    /// Frame The Package Once As Is And Send To All The Clients In The List, The Target Set By The Caller
+    void BroadcastToClients(const std::vector<int64_t> &list, const FPackageHandle &pkg) const;
+
+    /// Frame The Package Once As Is And Send To All The Login Clients
+    void BroadcastToAllClients(const FPackageHandle &pkg) const;
+
+    /// Send The Deltas Of The Objects To Client Against The State It Holds
+    void ReplicateToClient(int64_t pid, const std::vector<const UReplicaObject *> &objects, const FPackageHandle &pkg) const;
+
     [[nodiscard]] std::map<int64_t, std::string> GetRouteMap() const;
 };
@@ -7,12 +7,14 @@
 #include "gateway/PlayerAgent.h"
 #include "event/EventModule.h"
 #include "route/RouteModule.h"
+#include "monitor/Metrics.h"
 
 #include <spdlog/spdlog.h>
 
 
 UTickerNode::UTickerNode()
-    : mDeltaTime(0) {
+    : mDeltaTime(0),
+      mTickHistogram(nullptr) {
 }
 
 void UTickerNode::SetCurrentTickTime(const ASteadyTimePoint timepoint) {
@@ -23,19 +25,34 @@ void UTickerNode::SetDeltaTime(const ASteadyDuration delta) {
     mDeltaTime = delta;
 }
 
+void UTickerNode::SetTickHistogram(UMetricHistogram *histogram) {
+    mTickHistogram = histogram;
+}
+
 void UTickerNode::Execute(IActorBase *pActor) const {
     if (pActor == nullptr)
         return;
 
     // Only Service SubClass Can Update
-    if (auto *pService = dynamic_cast<IServiceBase *>(pActor)) {
+    if (auto *pService = TagCast<IServiceBase>(pActor)) {
+        const auto begin = std::chrono::steady_clock::now();
         pService->OnUpdate(mTickTime, mDeltaTime);
+
+        if (mTickHistogram != nullptr) {
+            const auto cost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+            mTickHistogram->Record(cost);
+        }
     }
 }
 
+EChannelNodeType UTickerNode::GetNodeType() const {
+    return EChannelNodeType::TICKER;
+}
+
 UServiceAgent::UServiceAgent(asio::io_context &ctx)
     : IAgentBase(ctx, SERVICE_CHANNEL_SIZE),
-      mServiceID(INVALID_SERVICE_ID) {
+      mServiceID(INVALID_SERVICE_ID),
+      mTickHistogram(nullptr) {
 }
 
 UServiceAgent::~UServiceAgent() {
@@ -71,6 +88,11 @@ bool UServiceAgent::Initial(IModuleBase *pModule, IDataAsset_Interface *pData) {
     mService->SetUpAgent(this);
     const auto ret = mService->Initial(pData);
 
+    // The Service Name Is Valid After Initial
+    mTickHistogram = UMetricsRegistry::Instance().GetHistogram(
+        "uranus_service_tick_microseconds", "The Duration Of The Service Update",
+        std::format("service=\"{}\"", mService->GetServiceName()));
+
     // Context And Service Initialized
     SPDLOG_INFO("{} - Agent[{} - {:p}] Service[{}] Initial Successfully",
         __FUNCTION__, mServiceID, static_cast<const void *>(this), mService->GetServiceName());
@@ -134,6 +156,18 @@ std::string UServiceAgent::GetServicePath() const {
     return mService.GetPath();
 }
 
+std::string UServiceAgent::GetAgentName() const {
+    return std::format("{}:{}", GetAgentKind(), GetServiceName());
+}
+
+const char *UServiceAgent::GetAgentKind() const {
+    return "service";
+}
+
+int64_t UServiceAgent::GetActorID() const {
+    return GetServiceID();
+}
+
 int64_t UServiceAgent::GetServiceID() const {
     return mServiceID;
 }
@@ -145,15 +179,26 @@ void UServiceAgent::PushTicker(const ASteadyTimePoint timepoint, const ASteadyDu
     auto node = make_unique<UTickerNode>();
     node->SetCurrentTickTime(timepoint);
     node->SetDeltaTime(delta);
+    node->SetTickHistogram(mTickHistogram);
+
+    IncreaseChannelDepth();
+
+    // Push To The Inner Channel, Never Resumed In Place Inside An Executing Actor
+    if (const bool ret = TrySendNode(std::move(node)); !ret) {
+        if (!mChannel.is_open()) {
+            DecreaseChannelDepth();
+            return;
+        }
 
-    // Push To The Inner Channel
-    if (const bool ret = mChannel.try_send_via_dispatch(std::error_code{}, std::move(node)); !ret && mChannel.is_open()) {
         auto temp = make_unique<UTickerNode>();
         temp->SetCurrentTickTime(timepoint);
         temp->SetDeltaTime(delta);
+        temp->SetTickHistogram(mTickHistogram);
 
         co_spawn(mContext, [self = SharedFromThis(), temp = std::move(temp)]() mutable -> awaitable<void> {
-            co_await self->mChannel.async_send(std::error_code{}, std::move(temp));
+            if (const auto [ec] = co_await self->mChannel.async_send(std::error_code{}, std::move(temp)); ec) {
+                self->DecreaseChannelDepth();
+            }
         }, detached);
     }
 }
@@ -162,7 +207,7 @@ void UServiceAgent::PostPackage(const FPackageHandle &pkg) const {
     if (pkg == nullptr)
         return;
 
-    // Do Not Post Th Self
+    // Do Not Post To Self
     if (const auto target = pkg->GetTarget(); target < 0 || target == mServiceID)
         return;
 
@@ -177,7 +222,7 @@ void UServiceAgent::PostPackage(const std::string &name, const FPackageHandle &p
     if (pkg == nullptr)
         return;
 
-    // Do Not Post Th Self
+    // Do Not Post To Self
     if (name.empty() || name == GetServiceName())
         return;
 
@@ -188,11 +233,32 @@ void UServiceAgent::PostPackage(const std::string &name, const FPackageHandle &p
     router->PostPackage(name, pkg);
 }
 
+void UServiceAgent::PostPackage(const std::vector<int64_t> &list, const FPackageHandle &pkg) const {
+    if (pkg == nullptr || list.empty())
+        return;
+
+    // Do Not Post To Self
+    std::vector<int64_t> targets;
+    targets.reserve(list.size());
+
+    for (const auto target : list) {
+        if (target > 0 && target != mServiceID) {
+            targets.push_back(target);
+        }
+    }
+
+    const auto *router = GetServer()->GetModule<URouteModule>();
+    if (!router)
+        return;
+
+    router->Multicast(true, targets, pkg);
+}
+
 void UServiceAgent::PostTask(const int64_t target, const AActorTask &task) const {
     if (task == nullptr)
         return;
 
-    // Do Not Post Th Self
+    // Do Not Post To Self
     if (target < 0 || target == mServiceID)
         return;
 
@@ -207,7 +273,7 @@ void UServiceAgent::PostTask(const std::string &name, const AActorTask &task) co
     if (task == nullptr)
         return;
 
-    // Do Not Post Th Self
+    // Do Not Post To Self
     if (name.empty() || name == GetServiceName())
         return;
 
@@ -226,8 +292,24 @@ void UServiceAgent::SendToPlayer(const int64_t pid, const FPackageHandle &pkg) c
     if (!router)
         return;
 
-    pkg->SetTarget(PLAYER_TARGET_ID);
-    router->PostPackage(pkg, pid);
+    // Do Not Write The Header Of The Frozen Package, Others May Hold It
+    const auto delivery = PrepareDelivery(pkg);
+    if (delivery == nullptr)
+        return;
+
+    delivery->SetTarget(PLAYER_TARGET_ID);
+    router->PostPackage(delivery, pid);
+}
+
+void UServiceAgent::SendToPlayers(const std::vector<int64_t> &list, const FPackageHandle &pkg) const {
+    if (pkg == nullptr || list.empty())
+        return;
+
+    const auto *router = GetServer()->GetModule<URouteModule>();
+    if (!router)
+        return;
+
+    router->Multicast(false, list, pkg);
 }
 
 void UServiceAgent::SendToClient(const int64_t pid, const FPackageHandle &pkg) const {
@@ -238,8 +320,56 @@ void UServiceAgent::SendToClient(const int64_t pid, const FPackageHandle &pkg) c
     if (!router)
         return;
 
-    pkg->SetTarget(CLIENT_TARGET_ID);
-    router->SendToClient(pid, pkg);
+    const auto delivery = PrepareDelivery(pkg);
+    if (delivery == nullptr)
+        return;
+
+    delivery->SetTarget(CLIENT_TARGET_ID);
+    router->SendToClient(pid, delivery);
+}
+
+void UServiceAgent::BroadcastToClients(const std::vector<int64_t> &list, const FPackageHandle &pkg) const {
+    if (pkg == nullptr || list.empty())
+        return;
+
+    const auto *router = GetServer()->GetModule<URouteModule>();
+    if (!router)
+        return;
+
+    const auto delivery = PrepareDelivery(pkg);
+    if (delivery == nullptr)
+        return;
+
+    delivery->SetTarget(CLIENT_TARGET_ID);
+    router->BroadcastToClients(list, delivery);
+}
+
+void UServiceAgent::BroadcastToAllClients(const FPackageHandle &pkg) const {
+    if (pkg == nullptr)
+        return;
+
+    const auto *router = GetServer()->GetModule<URouteModule>();
+    if (!router)
+        return;
+
+    const auto delivery = PrepareDelivery(pkg);
+    if (delivery == nullptr)
+        return;
+
+    delivery->SetTarget(CLIENT_TARGET_ID);
+    router->BroadcastToAllClients(delivery);
+}
+
+void UServiceAgent::ReplicateToClient(const int64_t pid, const std::vector<const UReplicaObject *> &objects) const {
+    if (pid <= 0 || objects.empty())
+        return;
+
+    const auto *router = GetServer()->GetModule<URouteModule>();
+    if (!router)
+        return;
+
+    // The Deltas Are Encoded In The Caller, The Objects Are Owned By The Service
+    router->ReplicateToClient(pid, objects, BuildPackage());
 }
 
 void UServiceAgent::PostToPlayer(const int64_t pid, const AActorTask &task) const {
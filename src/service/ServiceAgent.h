@@ -5,6 +5,9 @@
 #include "factory/ServiceHandle.h"
 
 
+class UMetricHistogram;
+class UReplicaObject;
+
 
 /**
  * Wrapper Of Update Data
@@ -14,13 +17,19 @@ class BASE_API UTickerNode final : public IChannelNode_Interface {
     ASteadyTimePoint mTickTime;
     ASteadyDuration mDeltaTime;
 
+    /** Record The Duration Of The Update, Owned By The Metrics Registry **/
+    UMetricHistogram *mTickHistogram;
+
 public:
     UTickerNode();
 
     void SetCurrentTickTime(ASteadyTimePoint timepoint);
     void SetDeltaTime(ASteadyDuration delta);
+    void SetTickHistogram(UMetricHistogram *histogram);
 
     void Execute(IActorBase *pActor) const override;
+
+    [[nodiscard]] EChannelNodeType GetNodeType() const override;
 };
 
 
@@ -37,7 +46,12 @@ class BASE_API UServiceAgent final : public IAgentBase {
     /** The Inner Service Instance **/
     FServiceHandle mService;
 
+    /** The Tick Duration Histogram Of This Service **/
+    UMetricHistogram *mTickHistogram;
+
 public:
+    DECLARE_TYPE_TAG(UServiceAgent, type_tag::SERVICE_AGENT, IAgentBase)
+
     explicit UServiceAgent(asio::io_context &ctx);
     ~UServiceAgent() override;
 
@@ -56,6 +70,10 @@ public:
 
     [[nodiscard]] std::string GetServicePath() const;
 
+    [[nodiscard]] std::string GetAgentName() const override;
+    [[nodiscard]] const char *GetAgentKind() const override;
+    [[nodiscard]] int64_t GetActorID() const override;
+
     /// Initial The Service With DataAsset
     bool Initial(IModuleBase *pModule, IDataAsset_Interface *pData) override;
 
@@ -74,6 +92,9 @@ public:
     /// Post The Package To Service By Service's Name
     void PostPackage(const std::string &name, const FPackageHandle &pkg) const;
 
+    /// Post The Package To The Services, Each One Gets A Fork Sharing The Payload
+    void PostPackage(const std::vector<int64_t> &list, const FPackageHandle &pkg) const;
+
     /// Post Task To Service
     void PostTask(int64_t target, const AActorTask &task) const;
 
@@ -83,9 +104,21 @@ public:
     /// Send The Package To The Player
     void SendToPlayer(int64_t pid, const FPackageHandle &pkg) const;
 
+    /// Send The Package To The Players, Each One Gets A Fork Sharing The Payload
+    void SendToPlayers(const std::vector<int64_t> &list, const FPackageHandle &pkg) const;
+
     /// Send The Package To The Client
     void SendToClient(int64_t pid, const FPackageHandle &pkg) const;
 
+    /// Send The Package To The Clients, Framed Once For All
+    void BroadcastToClients(const std::vector<int64_t> &list, const FPackageHandle &pkg) const;
+
+    /// Send The Package To All The Login Clients, Framed Once For All
+    void BroadcastToAllClients(const FPackageHandle &pkg) const;
+
+    /// Send The Deltas Of The Objects To The Client
+    void ReplicateToClient(int64_t pid, const std::vector<const UReplicaObject *> &objects) const;
+
     /// Post Task To Player
     void PostToPlayer(int64_t pid, const AActorTask &task) const;
 
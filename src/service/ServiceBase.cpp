@@ -79,6 +79,14 @@ void IServiceBase::TryCreateLogger(const std::string &name) const {
     module->TryCreateLogger(name);
 }
 
+shared_ptr<UBinaryLogger> IServiceBase::GetBinaryLogger(const std::string &name) const {
+    const auto *module = GetServer()->GetModule<ULoggerModule>();
+    if (module == nullptr)
+        return nullptr;
+
+    return module->GetBinaryLogger(name);
+}
+
 void IServiceBase::OnUpdate(ASteadyTimePoint now, ASteadyDuration delta) {
 }
 
@@ -131,6 +139,13 @@ void IServiceBase::PostPackage(const std::string &name, const FPackageHandle &pk
     GetAgentT<UServiceAgent>()->PostPackage(name, pkg);
 }
 
+void IServiceBase::PostPackage(const std::vector<int64_t> &list, const FPackageHandle &pkg) const {
+    if (list.empty() || pkg == nullptr)
+        return;
+
+    GetAgentT<UServiceAgent>()->PostPackage(list, pkg);
+}
+
 void IServiceBase::PostTask(const int64_t target, const AActorTask &task) const {
     if (target < 0 || task == nullptr)
         return;
@@ -152,6 +167,13 @@ void IServiceBase::SendToPlayer(const int64_t pid, const FPackageHandle &pkg) co
     GetAgentT<UServiceAgent>()->SendToPlayer(pid, pkg);
 }
 
+void IServiceBase::SendToPlayers(const std::vector<int64_t> &list, const FPackageHandle &pkg) const {
+    if (list.empty() || pkg == nullptr)
+        return;
+
+    GetAgentT<UServiceAgent>()->SendToPlayers(list, pkg);
+}
+
 void IServiceBase::PostToPlayer(const int64_t pid, const AActorTask &task) const {
     if (pid <= 0 || task == nullptr)
         return;
@@ -165,3 +187,24 @@ void IServiceBase::SendToClient(const int64_t pid, const FPackageHandle &pkg) co
 
     GetAgentT<UServiceAgent>()->SendToClient(pid, pkg);
 }
+
+void IServiceBase::BroadcastToClients(const std::vector<int64_t> &list, const FPackageHandle &pkg) const {
+    if (list.empty() || pkg == nullptr)
+        return;
+
+    GetAgentT<UServiceAgent>()->BroadcastToClients(list, pkg);
+}
+
+void IServiceBase::BroadcastToAllClients(const FPackageHandle &pkg) const {
+    if (pkg == nullptr)
+        return;
+
+    GetAgentT<UServiceAgent>()->BroadcastToAllClients(pkg);
+}
+
+void IServiceBase::ReplicateToClient(const int64_t pid, const std::vector<const UReplicaObject *> &objects) const {
+    if (pid <= 0 || objects.empty())
+        return;
+
+    GetAgentT<UServiceAgent>()->ReplicateToClient(pid, objects);
+}
@@ -4,6 +4,7 @@
 #include "timer/TimerHandle.h"
 
 #include <string>
+#include <vector>
 
 class UServer;
 class IActorBase;
@@ -11,6 +12,8 @@ class IPlayerBase;
 class IPackage_Interface;
 class IDataAsset_Interface;
 class IEventParam_Interface;
+class UReplicaObject;
+class UBinaryLogger;
 
 using std::shared_ptr;
 using std::unique_ptr;
@@ -41,6 +44,8 @@ protected:
     bool bUpdatePerTick;
 
 public:
+    DECLARE_TYPE_TAG(IServiceBase, type_tag::SERVICE, IActorBase)
+
     IServiceBase();
     ~IServiceBase() override;
 
@@ -70,6 +75,9 @@ public:
     /// Send To Other Service Use Service Name
     void PostPackage(const std::string &name, const FPackageHandle &pkg) const;
 
+    /// Send To Other Services, The Package Is Frozen And Its Payload Shared By All
+    void PostPackage(const std::vector<int64_t> &list, const FPackageHandle &pkg) const;
+
     /// Post Task To Other Service
     void PostTask(int64_t target, const AActorTask &task) const;
 
@@ -87,6 +95,9 @@ public:
     /// Send Package To Player
     void SendToPlayer(int64_t pid, const FPackageHandle &pkg) const;
 
+    /// Send Package To Players, The Package Is Frozen And Its Payload Shared By All
+    void SendToPlayers(const std::vector<int64_t> &list, const FPackageHandle &pkg) const;
+
     /// Post Task To Player
     void PostToPlayer(int64_t pid, const AActorTask &task) const;
 
@@ -97,6 +108,16 @@ public:
     /// Send Package To The Client
     void SendToClient(int64_t pid, const FPackageHandle &pkg) const;
 
+    /// Send The Package To The Clients, Serialized And Framed Only Once
+    void BroadcastToClients(const std::vector<int64_t> &list, const FPackageHandle &pkg) const;
+
+    /// Send The Package To All The Login Clients, Serialized And Framed Only Once
+    void BroadcastToAllClients(const FPackageHandle &pkg) const;
+
+    /// Send The Deltas Of The Objects Owned By This Service To The Client,
+    /// Only The Fields Changed After The Version The Client Holds
+    void ReplicateToClient(int64_t pid, const std::vector<const UReplicaObject *> &objects) const;
+
     /// Listen Event With The Specific Event Type
     void ListenEvent(int event) const;
 
@@ -121,6 +142,10 @@ public:
 
     void TryCreateLogger(const std::string &name) const;
 
+    /// The Binary Logger Created Along With TryCreateLogger, Null If The Binary Mode Disabled;
+    /// Release It In Stop, It Must Not Outlive The Logger Module
+    [[nodiscard]] shared_ptr<UBinaryLogger> GetBinaryLogger(const std::string &name) const;
+
     /// Implement By Derived Class
     virtual void OnUpdate(ASteadyTimePoint now, ASteadyDuration delta);
 };
@@ -130,7 +155,7 @@ template<class Type, class Callback, class ... Args>
 requires std::derived_from<Type, IServiceBase>
 inline void IServiceBase::PostTaskT(const int64_t target, Callback &&func, Args &&...args) {
     auto task = [func = std::forward<Callback>(func), ...args = std::forward<Args>(args)](IActorBase *pActor) {
-        if (auto *pService = dynamic_cast<Type *>(pActor)) {
+        if (auto *pService = TagCast<Type>(pActor)) {
             std::invoke(func, pService, std::forward<Args>(args)...);
         }
     };
@@ -142,7 +167,7 @@ template<class Type, class Callback, class ... Args>
 requires std::derived_from<Type, IServiceBase>
 inline void IServiceBase::PostTaskT(const std::string &name, Callback &&func, Args &&...args) {
     auto task = [func = std::forward<Callback>(func), ...args = std::forward<Args>(args)](IActorBase *pActor) {
-        if (auto *pService = dynamic_cast<Type *>(pActor)) {
+        if (auto *pService = TagCast<Type>(pActor)) {
             std::invoke(func, pService, std::forward<Args>(args)...);
         }
     };
@@ -154,7 +179,7 @@ template<class Type, class Callback, class ... Args>
 requires std::derived_from<Type, IPlayerBase>
 inline void IServiceBase::PostToPlayerT(const int64_t pid, Callback &&func, Args &&...args) {
     auto task = [func = std::forward<Callback>(func), ...args = std::forward<Args>(args)](IActorBase *pAcotr) {
-        if (auto *pPlayer = dynamic_cast<Type *>(pAcotr)) {
+        if (auto *pPlayer = TagCast<Type>(pAcotr)) {
             std::invoke(func, pPlayer, std::forward<Args>(args)...);
         }
     };
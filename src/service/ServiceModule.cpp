@@ -5,7 +5,8 @@
 #include <spdlog/spdlog.h>
 
 
-UServiceModule::UServiceModule() {
+UServiceModule::UServiceModule()
+    : mServiceMap(FSlotHandle::COMPACT_GENERATION_MASK) {
 }
 
 UServiceModule::~UServiceModule() {
@@ -41,16 +42,16 @@ void UServiceModule::Initial() {
             continue;
         }
 
-        // Allocate A Service ID
-        const auto sid = mAllocator.Allocate();
-
-        // Check If Service ID Repeated
-        if (mServiceMap.contains(sid)) [[unlikely]]
-            throw std::logic_error(fmt::format("Allocate Same Service ID[{}]", sid));
-
         // Create An Agent For Service
         const auto agent = make_shared<UServiceAgent>(mWorkerPool.GetIOContext());
 
+        // Take A Slot As The Service ID
+        const auto slot = mServiceMap.Insert(agent);
+        const auto sid = slot.ToCompactID();
+
+        if (sid <= 0) [[unlikely]]
+            throw std::logic_error(fmt::format("Service Slot[{}] Out Of Range", slot.index));
+
         // Set Up The Agent
         agent->SetUpServiceID(sid);
         agent->SetUpService(std::move(handle));
@@ -58,7 +59,7 @@ void UServiceModule::Initial() {
         // Initial The Agent
         if (!agent->Initial(this, nullptr)) {
             SPDLOG_CRITICAL("Failed To Initial Service: {}", name);
-            mAllocator.Recycle(sid);
+            mServiceMap.Erase(slot);
             agent->Stop();
             continue;
         }
@@ -67,14 +68,14 @@ void UServiceModule::Initial() {
         const std::string serviceName = agent->GetServiceName();
         if (mServiceNameMap.contains(serviceName)) {
             SPDLOG_CRITICAL("Service[{}] Already Exists", serviceName);
+            mServiceMap.Erase(slot);
             agent->Stop();
             continue;
         }
 
         SPDLOG_INFO("Service[{}] Initialized", serviceName);
 
-        // Insert The Service And Its Name To The Maps
-        mServiceMap.insert_or_assign(sid, agent);
+        // Insert The Service Name To The Map
         mServiceNameMap.insert_or_assign(serviceName, sid);
     }
 
@@ -84,6 +85,11 @@ void UServiceModule::Initial() {
     mTickTimer = make_unique<ASteadyTimer>(mWorkerPool.GetIOContext());
     co_spawn(mWorkerPool.GetIOContext(), UpdateLoop(updateMs), detached);
 
+    // Watch The Event-Loop Lag Of The Service Workers
+    mWorkerPool.SetUpWatchdog("service",
+        cfg["server"]["watchdog"]["interval"].as<int>(),
+        cfg["server"]["watchdog"]["threshold"].as<int>());
+
     // Start The Worker Pool
     mWorkerPool.Start(4);
 
@@ -95,10 +101,10 @@ void UServiceModule::Start() {
         throw std::logic_error(std::format("{} - Module[{}] Not In INITIALIZED State", __FUNCTION__, GetModuleName()));
 
     // Boot All The Core Service
-    for (const auto &context : mServiceMap | std::views::values) {
+    mServiceMap.Foreach([](FSlotHandle, const shared_ptr<UServiceAgent> &context) {
         SPDLOG_INFO("Boot Service[{}]", context->GetServiceName());
         context->BootService();
-    }
+    });
     
     mState = EModuleState::RUNNING;
 }
@@ -114,16 +120,19 @@ void UServiceModule::Stop() {
         mTickTimer->cancel();
     }
 
-    // Shutdown All The Core Service
-    for (const auto &context : mServiceMap | std::views::values) {
+    // Shutdown All The Core Service, Skip The Slot Reserved By The Booting One
+    mServiceMap.Foreach([](FSlotHandle, const shared_ptr<UServiceAgent> &context) {
+        if (context == nullptr)
+            return;
+
         SPDLOG_INFO("Stop Service[{}]", context->GetServiceName());
         context->Stop();
-    }
+    });
 
     // Stop The Worker Pool
     mWorkerPool.Stop();
 
-    mServiceMap.clear();
+    mServiceMap.Clear();
     mServiceNameMap.clear();
 }
 
@@ -146,8 +155,8 @@ awaitable<void> UServiceModule::UpdateLoop(int ms) {
             std::shared_lock serviceLock(mServiceMutex);
 
             for (auto tickIter = mTickerSet.begin(); tickIter != mTickerSet.end();) {
-                if (const auto serviceIter = mServiceMap.find(*tickIter); serviceIter != mServiceMap.end()) {
-                    serviceIter->second->PushTicker(tickPoint, delta);
+                if (const auto *agent = mServiceMap.Find(FSlotHandle::FromCompactID(*tickIter)); agent != nullptr && *agent != nullptr) {
+                    (*agent)->PushTicker(tickPoint, delta);
                     ++tickIter;
                     continue;
                 }
@@ -166,8 +175,8 @@ shared_ptr<UServiceAgent> UServiceModule::FindService(const int64_t sid) const {
         return nullptr;
 
     std::shared_lock lock(mServiceMutex);
-    const auto iter = mServiceMap.find(sid);
-    return iter == mServiceMap.end() ? nullptr : iter->second;
+    const auto *agent = mServiceMap.Find(FSlotHandle::FromCompactID(sid));
+    return agent == nullptr ? nullptr : *agent;
 }
 
 shared_ptr<UServiceAgent> UServiceModule::FindService(const std::string &name) const {
@@ -208,15 +217,24 @@ void UServiceModule::BootService(const std::string &name, IDataAsset_Interface *
         return;
     }
 
-    const auto sid = mAllocator.AllocateTS();
-
-    // Check If The Service ID Is Valid
+    // Reserve A Slot As The Service ID, The Agent Is Stored After Booted
+    FSlotHandle slot;
     {
-        std::shared_lock lock(mServiceMutex);
-        if (mServiceMap.contains(sid)) {
-            SPDLOG_CRITICAL("{} - Service ID Repeated, [{}]", __FUNCTION__, sid);
-            return;
-        }
+        std::unique_lock lock(mServiceMutex);
+        slot = mServiceMap.Insert(nullptr);
+    }
+
+    const auto sid = slot.ToCompactID();
+
+    const auto release = [this, slot] {
+        std::unique_lock lock(mServiceMutex);
+        mServiceMap.Erase(slot);
+    };
+
+    if (sid <= 0) {
+        SPDLOG_CRITICAL("{} - Service Slot[{}] Out Of Range", __FUNCTION__, slot.index);
+        release();
+        return;
     }
 
     // Create The Agent For Service
@@ -230,7 +248,7 @@ void UServiceModule::BootService(const std::string &name, IDataAsset_Interface *
     if (!agent->Initial(this, pData)) {
         SPDLOG_ERROR("{} - Service[{}] Initialize Fail", __FUNCTION__, sid);
         agent->Stop();
-        mAllocator.RecycleTS(sid);
+        release();
         return;
     }
 
@@ -239,7 +257,7 @@ void UServiceModule::BootService(const std::string &name, IDataAsset_Interface *
     if (serviceName.empty() || serviceName == "UNKNOWN") {
         SPDLOG_ERROR("{} - Service[{}] Name Undefined", __FUNCTION__, sid);
         agent->Stop();
-        mAllocator.RecycleTS(sid);
+        release();
         return;
     }
 
@@ -256,15 +274,17 @@ void UServiceModule::BootService(const std::string &name, IDataAsset_Interface *
     if (bRepeat || !agent->BootService()) {
         SPDLOG_ERROR("{} - Service[{}] Name Repeated Or Fail To Boot", __FUNCTION__, serviceName);
         agent->Stop();
-        mAllocator.RecycleTS(sid);
+        release();
         return;
     }
 
     SPDLOG_INFO("{} - Boot Service[{}] Successfully", __FUNCTION__, serviceName);
 
-    // Insert The Service And The Name To The Maps
+    // Fill The Reserved Slot And Insert The Name To The Map
     std::scoped_lock lock(mServiceMutex, mServiceNameMutex);
-    mServiceMap.insert_or_assign(sid, agent);
+    if (auto *pSlot = mServiceMap.Find(slot)) {
+        *pSlot = agent;
+    }
     mServiceNameMap.insert_or_assign(serviceName, sid);
 }
 
@@ -274,15 +294,17 @@ void UServiceModule::ShutdownService(const int64_t sid) {
 
     shared_ptr<UServiceAgent> context;
 
-    // Erase From Service Map
+    // Erase From Service Map, The Slot Is Free For The Next Service With A New Generation
     {
         std::unique_lock lock(mServiceMutex);
-        const auto iter = mServiceMap.find(sid);
-        if (iter == mServiceMap.end())
+        const auto slot = FSlotHandle::FromCompactID(sid);
+
+        const auto *agent = mServiceMap.Find(slot);
+        if (agent == nullptr || *agent == nullptr)
             return;
 
-        context = iter->second;
-        mServiceMap.erase(iter);
+        context = *agent;
+        mServiceMap.Erase(slot);
     }
 
     if (context == nullptr)
@@ -302,9 +324,6 @@ void UServiceModule::ShutdownService(const int64_t sid) {
         mTickerSet.erase(sid);
     }
 
-    // Recycle The Service ID
-    mAllocator.RecycleTS(sid);
-
     SPDLOG_INFO("{} - Stop The Service[{}, {}]", __FUNCTION__, sid, name);
     context->Stop();
 }
@@ -334,12 +353,14 @@ void UServiceModule::ShutdownService(const std::string &name) {
     // Erase From The Service Map
     {
         std::unique_lock lock(mServiceMutex);
-        const auto iter = mServiceMap.find(sid);
-        if (iter == mServiceMap.end())
+        const auto slot = FSlotHandle::FromCompactID(sid);
+
+        const auto *agent = mServiceMap.Find(slot);
+        if (agent == nullptr || *agent == nullptr)
             return;
 
-        context = iter->second;
-        mServiceMap.erase(iter);
+        context = *agent;
+        mServiceMap.Erase(slot);
     }
 
     // Erase From The Update Map
@@ -348,9 +369,6 @@ void UServiceModule::ShutdownService(const std::string &name) {
         mTickerSet.erase(sid);
     }
 
-    // Recycle The Service ID
-    mAllocator.RecycleTS(sid);
-
     if (context == nullptr)
         return;
 
@@ -407,9 +425,11 @@ void UServiceModule::ForeachService(const std::function<bool(const shared_ptr<US
 
     {
         std::shared_lock lock(mServiceMutex);
-        for (const auto &agent : mServiceMap | std::views::values) {
-            services.insert(agent);
-        }
+        mServiceMap.Foreach([&services](FSlotHandle, const shared_ptr<UServiceAgent> &agent) {
+            if (agent != nullptr) {
+                services.insert(agent);
+            }
+        });
     }
 
     for (const auto &ser : services) {
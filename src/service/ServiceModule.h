@@ -3,7 +3,7 @@
 #include "Module.h"
 #include "base/Types.h"
 #include "base/SingleIOContextPool.h"
-#include "base/IdentAllocator.h"
+#include "base/SlotMap.h"
 #include "factory/ServiceFactory.h"
 
 #include <absl/container/flat_hash_map.h>
@@ -29,8 +29,8 @@ class BASE_API UServiceModule final : public IModuleBase {
     /** The Worker Pool For All The Service **/
     USingleIOContextPool mWorkerPool;
 
-    /** All The Service Map **/
-    absl::flat_hash_map<int64_t, shared_ptr<UServiceAgent>> mServiceMap;
+    /** All The Services, The Service ID Is The Compact Slot Handle **/
+    TSlotMap<shared_ptr<UServiceAgent>> mServiceMap;
     mutable std::shared_mutex mServiceMutex;
 
     /** Service Name To Service ID Mapping **/
@@ -40,9 +40,6 @@ class BASE_API UServiceModule final : public IModuleBase {
     /** The Service Factory Use To Load Service Shared Libraries **/
     unique_ptr<IServiceFactory_Interface> mServiceFactory;
 
-    /** Allocate Service ID **/
-    TIdentAllocator<int64_t, true> mAllocator;
-
     /** For Update Per Tick **/
     std::unique_ptr<ASteadyTimer> mTickTimer;
 
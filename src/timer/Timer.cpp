@@ -25,7 +25,7 @@ FTimerHandle UTimer::GetTimerHandle() {
     if (mID < 0)
         return {};
 
-    return FTimerHandle{ mID, weak_from_this() };
+    return FTimerHandle{ mID };
 }
 
 void UTimer::Start() {
@@ -2,17 +2,21 @@
 
 #include "Common.h"
 
+#include <functional>
+#include <concepts>
 #include <memory>
 
 
-class UTimer;
 using std::shared_ptr;
 using std::weak_ptr;
 
 
+/**
+ * The ID Packs The Slot Index And The Generation In The Timer Manager,
+ * The Handle Of The Removed Timer Never Matches The Reused Slot
+ */
 struct BASE_API FTimerHandle final {
     int64_t id;
-    std::weak_ptr<UTimer> timer;
 
     FTimerHandle() : id(-1) {
         
@@ -23,10 +27,6 @@ struct BASE_API FTimerHandle final {
         : id(id) {
     }
 
-    FTimerHandle(const int64_t id, const weak_ptr<UTimer> &ptr)
-        : id(id), timer(ptr) {
-    }
-
     bool operator<(const FTimerHandle &rhs) const {
         return id < rhs.id;
     }
@@ -40,17 +40,9 @@ struct BASE_API FTimerHandle final {
         return id;
     }
 
-    // NOLINT(google-explicit-constructor)
-    operator int() const {
-        return static_cast<int>(id);
-    }
-
+    /// Only Check The ID, Ask The Timer Manager If The Timer Is Still Alive
     [[nodiscard]] bool IsValid() const {
-        return id > 0 && !timer.expired();
-    }
-
-    [[nodiscard]] shared_ptr<UTimer> Get() const {
-        return timer.lock();
+        return id > 0;
     }
 
     struct BASE_API FEqual {
@@ -70,27 +62,34 @@ inline bool operator==(const FTimerHandle &lhs, const FTimerHandle &rhs) {
     return lhs.id == rhs.id;
 }
 
-inline bool operator==(const int lhs, const FTimerHandle &rhs) {
-    return lhs == rhs.id;
-}
+// Compared With The Whole Packed ID, Any Integer Is Widened Instead Of The ID Narrowed
 
-inline bool operator==(const FTimerHandle &lhs, const int rhs) {
-    return lhs.id == rhs;
+template<std::integral Integer>
+inline bool operator==(const Integer lhs, const FTimerHandle &rhs) {
+    return static_cast<int64_t>(lhs) == rhs.id;
 }
 
+template<std::integral Integer>
+inline bool operator==(const FTimerHandle &lhs, const Integer rhs) {
+    return lhs.id == static_cast<int64_t>(rhs);
+}
 
-inline bool operator<(const FTimerHandle &lhs, const int rhs) {
-    return lhs.id < rhs;
+template<std::integral Integer>
+inline bool operator<(const FTimerHandle &lhs, const Integer rhs) {
+    return lhs.id < static_cast<int64_t>(rhs);
 }
 
-inline bool operator<(const int lhs, const FTimerHandle &rhs) {
-    return lhs < rhs.id;
+template<std::integral Integer>
+inline bool operator<(const Integer lhs, const FTimerHandle &rhs) {
+    return static_cast<int64_t>(lhs) < rhs.id;
 }
 
-inline bool operator>(const FTimerHandle &lhs, const int rhs) {
-    return lhs.id > rhs;
+template<std::integral Integer>
+inline bool operator>(const FTimerHandle &lhs, const Integer rhs) {
+    return lhs.id > static_cast<int64_t>(rhs);
 }
 
-inline bool operator>(const int lhs, const FTimerHandle &rhs) {
-    return lhs < rhs.id;
+template<std::integral Integer>
+inline bool operator>(const Integer lhs, const FTimerHandle &rhs) {
+    return static_cast<int64_t>(lhs) > rhs.id;
 }
@@ -1,80 +1,83 @@
 #include "TimerManager.h"
 #include "Timer.h"
+#include "monitor/Metrics.h"
 
-#include <ranges>
+
+
+namespace {
+    UMetricGauge *TimerCountGauge() {
+        static auto *gauge = UMetricsRegistry::Instance().GetGauge("uranus_timers", "The Timers Held By All The Timer Managers");
+        return gauge;
+    }
+}
 
 UTimerManager::UTimerManager(asio::io_context &ctx)
     : mContext(ctx) {
 }
 
 UTimerManager::~UTimerManager() {
-    for (const auto &timer : mTimerMap | std::views::values) {
+    mTimerMap.Foreach([](FSlotHandle, const shared_ptr<UTimer> &timer) {
         timer->CleanUpManager();
         timer->Cancel();
-    }
+    });
+
+    TimerCountGauge()->Sub(static_cast<int64_t>(mTimerMap.Size()));
 }
 
 asio::io_context &UTimerManager::GetIOContext() const {
     return mContext;
 }
 
-FTimerHandle UTimerManager::CreateTimer() {
-    const auto tid = mAllocator.AllocateTS();
-    const auto timer = std::make_shared<UTimer>(this);
+FTimerHandle UTimerManager::InsertTimer(const shared_ptr<UTimer> &timer) {
+    std::unique_lock lock(mMutex);
+
+    const auto tid = mTimerMap.Insert(timer).ToID();
     timer->SetUpID(tid);
 
-    std::unique_lock lock(mMutex);
-    if (!mTimerMap.contains(tid)) {
-        const auto handle = timer->GetTimerHandle();
-        mTimerMap.insert_or_assign(handle, timer);
-        return handle;
-    }
+    TimerCountGauge()->Add(1);
+    return FTimerHandle{ tid };
+}
 
-    return {};
+FTimerHandle UTimerManager::CreateTimer() {
+    return InsertTimer(std::make_shared<UTimer>(this));
 }
 
 FTimerHandle UTimerManager::CreateTimer(const ATimerTask &task, const int delay, const int rate) {
-    const auto handle = CreateTimer();
-    if (!handle.IsValid())
-        return {};
-
-    const auto timer = handle.timer.lock();
-    if (timer == nullptr) [[unlikely]]
-        return {};
+    const auto timer = std::make_shared<UTimer>(this);
 
     timer->SetDelay(delay);
     timer->SetRate(rate);
     timer->SetTask(task);
 
+    const auto handle = InsertTimer(timer);
+    timer->Start();
+
     return handle;
 }
 
 FTimerHandle UTimerManager::FindTimer(const int64_t tid) const {
     std::shared_lock lock(mMutex);
-    const auto iter = mTimerMap.find(tid);
-    return iter == mTimerMap.end() ? FTimerHandle() : iter->first;
+    return mTimerMap.Contains(FSlotHandle::FromID(tid)) ? FTimerHandle{ tid } : FTimerHandle();
 }
 
 void UTimerManager::CancelTimer(const int64_t tid) const {
-    if (const auto handle = FindTimer(tid); handle.IsValid()) {
-        if (const auto timer = handle.timer.lock()) {
-            timer->Cancel();
-        }
+    std::shared_lock lock(mMutex);
+    if (const auto *timer = mTimerMap.Find(FSlotHandle::FromID(tid))) {
+        (*timer)->Cancel();
     }
 }
 
 void UTimerManager::CancelAll() {
     std::unique_lock lock(mMutex);
-    for (const auto &timer : mTimerMap | std::views::values) {
+    mTimerMap.Foreach([](FSlotHandle, const shared_ptr<UTimer> &timer) {
         timer->CleanUpManager();
         timer->Cancel();
-    }
+    });
 }
 
 void UTimerManager::RemoveTimer(const int64_t tid) {
     std::unique_lock lock(mMutex);
-    if (const auto it = mTimerMap.find(tid); it != mTimerMap.end()) {
-        mTimerMap.erase(it);
-        mAllocator.RecycleTS(tid);
+    if (mTimerMap.Erase(FSlotHandle::FromID(tid))) {
+        TimerCountGauge()->Sub(1);
     }
 }
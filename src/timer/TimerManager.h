@@ -2,10 +2,9 @@
 
 #include "TimerHandle.h"
 #include "base/Types.h"
-#include "base/IdentAllocator.h"
+#include "base/SlotMap.h"
 
 #include <shared_mutex>
-#include <absl/container/flat_hash_map.h>
 
 
 using ATimerTask = std::function<void(ASteadyTimePoint, ASteadyDuration)>;
@@ -36,13 +35,16 @@ public:
     void CancelAll();
 
 private:
+    /// Store The Timer And Assign Its ID From The Slot
+    FTimerHandle InsertTimer(const shared_ptr<UTimer> &timer);
+
     void RemoveTimer(int64_t tid);
 
 private:
     asio::io_context& mContext;
-    TIdentAllocator<int64_t, true> mAllocator;
 
-    absl::flat_hash_map<FTimerHandle, shared_ptr<UTimer>, FTimerHandle::FHash, FTimerHandle::FEqual> mTimerMap;
+    /** The Timer ID Is The Packed Slot Handle **/
+    TSlotMap<shared_ptr<UTimer>> mTimerMap;
     mutable std::shared_timed_mutex mMutex;
 };
 
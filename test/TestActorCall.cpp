@@ -0,0 +1,240 @@
+#include "UnitTest.h"
+
+#include "ActorBase.h"
+#include "AgentBase.h"
+
+#include <unordered_map>
+#include <stdexcept>
+#include <memory>
+
+
+namespace {
+    constexpr int64_t CALLEE_ID = 1;
+    constexpr int64_t STALLED_ID = 2;
+    constexpr int64_t MISSING_ID = 3;
+
+    constexpr auto SHORT_TIMEOUT = std::chrono::milliseconds(200);
+
+    class UTestCallee final : public IActorBase {
+
+    public:
+        DECLARE_TYPE_TAG(UTestCallee, type_tag::USER + 301, IActorBase)
+
+        int Add(const int lhs, const int rhs) const {
+            return lhs + rhs;
+        }
+
+        void Touch() {
+            ++touched;
+        }
+
+        int Fail() const {
+            throw std::runtime_error("Callee Failed");
+        }
+
+        int touched = 0;
+    };
+
+    class UTestOther final : public IActorBase {
+
+    public:
+        DECLARE_TYPE_TAG(UTestOther, type_tag::USER + 302, IActorBase)
+
+        int Add(const int lhs, const int rhs) const {
+            return lhs - rhs;
+        }
+    };
+
+    /** Routes The Calls To The Agents Of The Test Instead Of The Router **/
+    class UTestCaller final : public IActorBase {
+
+    public:
+        DECLARE_TYPE_TAG(UTestCaller, type_tag::USER + 303, IActorBase)
+
+        std::unordered_map<int64_t, shared_ptr<IAgentBase>> targets;
+
+    protected:
+        using IActorBase::DispatchCall;
+
+        bool DispatchCall(bool, const int64_t target, const AActorTask &task) const override {
+            const auto iter = targets.find(target);
+            if (iter == targets.end())
+                return false;
+
+            iter->second->PushTask(task);
+            return true;
+        }
+    };
+
+    /** Owns The Actor And Drains Its Channel, Without The Server **/
+    class UTestActorAgent final : public IAgentBase {
+
+    public:
+        UTestActorAgent(asio::io_context &ctx, unique_ptr<IActorBase> &&actor)
+            : IAgentBase(ctx),
+              mActor(std::move(actor)) {
+            mActor->SetUpAgent(this);
+        }
+
+        void Run() {
+            co_spawn(mContext, ProcessChannel(), detached);
+        }
+
+        void Close() {
+            mChannel.close();
+        }
+
+    protected:
+        [[nodiscard]] IActorBase *GetActor() const override {
+            return mActor.get();
+        }
+
+    private:
+        unique_ptr<IActorBase> mActor;
+    };
+
+    /** The Caller And The Callee Each In Its Own Context And Thread, The Stalled Agent Never Drains **/
+    class FActorCallFixture : public testing::Test {
+
+    protected:
+        FActorCallFixture()
+            : mCallerGuard(asio::make_work_guard(mCallerContext)),
+              mCalleeGuard(asio::make_work_guard(mCalleeContext)) {
+
+            auto caller = std::make_unique<UTestCaller>();
+            mCaller = caller.get();
+
+            mCallerAgent = std::make_shared<UTestActorAgent>(mCallerContext, std::move(caller));
+            mCalleeAgent = std::make_shared<UTestActorAgent>(mCalleeContext, std::make_unique<UTestCallee>());
+            mStalledAgent = std::make_shared<UTestActorAgent>(mCalleeContext, std::make_unique<UTestCallee>());
+
+            mCaller->targets[CALLEE_ID] = mCalleeAgent;
+            mCaller->targets[STALLED_ID] = mStalledAgent;
+
+            mCallerThread = std::thread([this] { mCallerContext.run(); });
+            mCalleeThread = std::thread([this] { mCalleeContext.run(); });
+
+            unit::RunIn(mCallerContext, [this] { mCallerAgent->Run(); });
+            unit::RunIn(mCalleeContext, [this] { mCalleeAgent->Run(); });
+        }
+
+        ~FActorCallFixture() override {
+            asio::post(mCallerContext, [agent = mCallerAgent] { agent->Close(); });
+            asio::post(mCalleeContext, [agent = mCalleeAgent] { agent->Close(); });
+            asio::post(mCalleeContext, [agent = mStalledAgent] { agent->Close(); });
+
+            mCallerGuard.reset();
+            mCalleeGuard.reset();
+
+            mCallerThread.join();
+            mCalleeThread.join();
+        }
+
+        /** The Result Of The Call And The Thread The Caller Resumed In **/
+        template<auto Method>
+        struct TCallOutcome {
+            TActorCallResult<Method> result;
+            std::thread::id thread;
+        };
+
+        /// Spawn The Call In A Task Of The Caller, As An Actor Awaits It In Its Handler
+        template<auto Method, class... Args>
+        TCallOutcome<Method> RunCall(const ASteadyDuration timeout, const int64_t target, Args... args) {
+            auto promise = std::make_shared<std::promise<TCallOutcome<Method>>>();
+            auto future = promise->get_future();
+
+            mCallerAgent->PushTask([promise, timeout, target, args...](IActorBase *pActor) {
+                co_spawn(pActor->GetIOContext(), [promise, pActor, timeout, target, args...]() -> awaitable<void> {
+                    auto result = co_await pActor->CallFor<Method>(timeout, target, args...);
+                    promise->set_value({ std::move(result), std::this_thread::get_id() });
+                }, detached);
+            });
+
+            EXPECT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+            return future.get();
+        }
+
+    protected:
+        asio::io_context mCallerContext;
+        asio::io_context mCalleeContext;
+
+        asio::executor_work_guard<asio::io_context::executor_type> mCallerGuard;
+        asio::executor_work_guard<asio::io_context::executor_type> mCalleeGuard;
+
+        UTestCaller *mCaller = nullptr;
+
+        shared_ptr<UTestActorAgent> mCallerAgent;
+        shared_ptr<UTestActorAgent> mCalleeAgent;
+        shared_ptr<UTestActorAgent> mStalledAgent;
+
+        std::thread mCallerThread;
+        std::thread mCalleeThread;
+    };
+}
+
+
+TEST_F(FActorCallFixture, ReplyResumesInCallerThread) {
+    const auto outcome = RunCall<&UTestCallee::Add>(ACTOR_CALL_TIMEOUT, CALLEE_ID, 2, 3);
+
+    ASSERT_TRUE(outcome.result.has_value());
+    EXPECT_EQ(*outcome.result, 5);
+    EXPECT_EQ(outcome.thread, mCallerThread.get_id());
+}
+
+TEST_F(FActorCallFixture, VoidMethodReplies) {
+    const auto outcome = RunCall<&UTestCallee::Touch>(ACTOR_CALL_TIMEOUT, CALLEE_ID);
+    EXPECT_TRUE(outcome.result.has_value());
+}
+
+TEST_F(FActorCallFixture, TimeoutWhenNotReplied) {
+    const auto begin = std::chrono::steady_clock::now();
+    const auto outcome = RunCall<&UTestCallee::Add>(SHORT_TIMEOUT, STALLED_ID, 1, 1);
+
+    EXPECT_FALSE(outcome.result.has_value());
+    EXPECT_GE(std::chrono::steady_clock::now() - begin, SHORT_TIMEOUT);
+    EXPECT_EQ(outcome.thread, mCallerThread.get_id());
+}
+
+/// Replied Empty At Once, Not Left To The Timeout
+TEST_F(FActorCallFixture, WrongClassRepliesEmpty) {
+    const auto begin = std::chrono::steady_clock::now();
+    const auto outcome = RunCall<&UTestOther::Add>(ACTOR_CALL_TIMEOUT, CALLEE_ID, 1, 1);
+
+    EXPECT_FALSE(outcome.result.has_value());
+    EXPECT_LT(std::chrono::steady_clock::now() - begin, ACTOR_CALL_TIMEOUT);
+}
+
+TEST_F(FActorCallFixture, MissingTargetRepliesEmpty) {
+    const auto outcome = RunCall<&UTestCallee::Add>(ACTOR_CALL_TIMEOUT, MISSING_ID, 1, 1);
+    EXPECT_FALSE(outcome.result.has_value());
+}
+
+TEST_F(FActorCallFixture, ThrowingCalleeRepliesEmpty) {
+    const auto begin = std::chrono::steady_clock::now();
+    const auto outcome = RunCall<&UTestCallee::Fail>(ACTOR_CALL_TIMEOUT, CALLEE_ID);
+
+    EXPECT_FALSE(outcome.result.has_value());
+    EXPECT_LT(std::chrono::steady_clock::now() - begin, ACTOR_CALL_TIMEOUT);
+}
+
+/// The Caller's Agent Closed While Waiting, The Dropped Reply Still Wakes The Caller
+TEST_F(FActorCallFixture, ClosedCallerWakesWithEmpty) {
+    auto started = std::make_shared<std::promise<void>>();
+    auto promise = std::make_shared<std::promise<TActorCallResult<&UTestCallee::Add>>>();
+    auto future = promise->get_future();
+
+    mCallerAgent->PushTask([started, promise](IActorBase *pActor) {
+        co_spawn(pActor->GetIOContext(), [started, promise, pActor]() -> awaitable<void> {
+            started->set_value();
+            promise->set_value(co_await pActor->CallFor<&UTestCallee::Add>(SHORT_TIMEOUT, STALLED_ID, 1, 1));
+        }, detached);
+    });
+
+    ASSERT_EQ(started->get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+
+    // Runs After The Caller Suspended, The Timeout Reply Then Finds The Channel Closed
+    unit::RunIn(mCallerContext, [this] { mCallerAgent->Close(); });
+
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_FALSE(future.get().has_value());
+}
@@ -0,0 +1,125 @@
+#include "UnitTest.h"
+
+#include "logger/BinaryLogger.h"
+#include "BinaryLogDecoder.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <format>
+#include <thread>
+
+
+namespace {
+    constexpr size_t RING_SIZE = 4096;
+    constexpr int RECORD_COUNT = 2000;
+
+    /// Fill The Record With Its Index, The Size Field Leads As In The Real Ones
+    void FillRecord(uint8_t *data, const uint32_t size, const uint32_t index) {
+        binary_log::WriteValue(data, size);
+        for (uint32_t pos = sizeof(uint32_t); pos < size; ++pos) {
+            data[pos] = static_cast<uint8_t>(index + pos);
+        }
+    }
+
+    std::vector<uint8_t> ReadFile(const std::filesystem::path &path) {
+        std::ifstream input(path, std::ios::binary);
+        return { std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>() };
+    }
+}
+
+
+/// Sizes Not Dividing The Ring, So The Records Hit Every Kind Of The Tail Before Wrapping
+TEST(BinaryLog, RingWrapKeepsRecords) {
+    UBinaryLogRing ring(RING_SIZE);
+
+    uint32_t written = 0;
+    uint32_t consumed = 0;
+
+    const auto consume = [&ring, &consumed] {
+        ring.Consume([&consumed](const uint8_t *data, const uint32_t size) {
+            const auto expected = static_cast<uint32_t>(sizeof(uint32_t) + 13 + consumed % 97);
+            ASSERT_EQ(size, expected) << "Record " << consumed;
+
+            for (uint32_t pos = sizeof(uint32_t); pos < size; ++pos) {
+                ASSERT_EQ(data[pos], static_cast<uint8_t>(consumed + pos)) << "Record " << consumed;
+            }
+            ++consumed;
+        });
+    };
+
+    while (written < RECORD_COUNT) {
+        const auto size = static_cast<uint32_t>(sizeof(uint32_t) + 13 + written % 97);
+
+        auto *data = ring.Reserve(size);
+        if (data == nullptr) {
+            consume();
+            continue;
+        }
+
+        FillRecord(data, size, written);
+        ring.Commit(size);
+        ++written;
+    }
+
+    consume();
+
+    EXPECT_EQ(consumed, written);
+    EXPECT_TRUE(ring.IsEmpty());
+
+    // Only The Full Ring Refused, Every One Retried After Consumed
+    EXPECT_GT(ring.GetDropCount(), 0u);
+}
+
+/// Written Through The Macro, Persisted By The Backend And Decoded Back To The Same Text
+TEST(BinaryLog, DecodeRoundTrip) {
+    const auto directory = std::filesystem::temp_directory_path() / "uranus_binary_log_test";
+    std::filesystem::remove_all(directory);
+
+    size_t dropped = 0;
+    {
+        UBinaryLogBackend backend(directory.string(), RING_SIZE, 1);
+        backend.Start();
+
+        const auto logger = backend.CreateLogger("round_trip");
+
+        for (int idx = 0; idx < RECORD_COUNT; ++idx) {
+            BINARY_LOG_INFO(logger, "Record {} Of {} Ratio {:.2f} Flag {}", idx, std::string("round_trip"), idx / 4.0, idx % 2 == 0);
+
+            // Give The Writer Time To Drain, So The Ring Wraps Instead Of Filling Up
+            if (idx % 20 == 19) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+        }
+
+        backend.Stop();
+        dropped = backend.GetDropCount();
+    }
+
+    std::vector<std::filesystem::path> files;
+    for (const auto &entry : std::filesystem::directory_iterator(directory)) {
+        files.emplace_back(entry.path());
+    }
+    ASSERT_EQ(files.size(), 1u);
+
+    FDecodedLog log;
+    ASSERT_TRUE(DecodeBinaryLog(ReadFile(files.front()), log));
+
+    EXPECT_EQ(log.name, "round_trip");
+    EXPECT_TRUE(log.errors.empty());
+    EXPECT_EQ(log.records.size() + dropped, static_cast<size_t>(RECORD_COUNT));
+
+    // The Dropped Ones Leave Gaps, The Rest Keep Their Order
+    int last = -1;
+    for (const auto &record : log.records) {
+        int idx = 0;
+        ASSERT_EQ(std::sscanf(record.message.c_str(), "Record %d", &idx), 1) << record.message;
+        ASSERT_GT(idx, last);
+        last = idx;
+
+        EXPECT_EQ(record.message, std::format("Record {} Of round_trip Ratio {:.2f} Flag {}", idx, idx / 4.0, idx % 2 == 0));
+        EXPECT_EQ(record.level, "info");
+    }
+
+    std::filesystem::remove_all(directory);
+}
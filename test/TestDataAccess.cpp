@@ -0,0 +1,210 @@
+#include "UnitTest.h"
+
+#include "database/DataAccess.h"
+#include "database/memory/MemoryAdapter.h"
+#include "database/memory/MemoryStartUpData.h"
+
+#include <atomic>
+#include <mutex>
+#include <map>
+
+
+namespace {
+    constexpr auto TEST_COLLECTION = "test_document";
+    constexpr int DOCUMENT_COUNT = 32;
+
+    /** The Server With The Data Access On The Memory Adapter **/
+    unit::FTestServer CreateServer() {
+        return unit::FTestServer([](UServer *server) {
+            if (auto *module = server->CreateModule<UDataAccess>(); module != nullptr) {
+                module->SetDatabaseAdapter<UMemoryAdapter>();
+                module->SetStartUpConfig([](const YAML::Node &) -> IDataAsset_Interface * {
+                    return new FMemoryStartUpData();
+                });
+            }
+        });
+    }
+
+    /** The Results Of The Loads, Written By The Worker Threads **/
+    struct FLoadResult {
+        std::mutex mutex;
+        std::map<std::string, std::optional<std::string>> documents;
+        std::map<std::string, EDBLoadStatus> status;
+        std::atomic_int count = 0;
+
+        ADBLoadCallback Bind(const std::string &key) {
+            return [this, key](const EDBLoadStatus result, std::string doc) {
+                {
+                    std::unique_lock lock(mutex);
+                    status[key] = result;
+                    if (result == EDBLoadStatus::FOUND) {
+                        documents[key] = std::move(doc);
+                    }
+                }
+                ++count;
+            };
+        }
+    };
+
+    /// Await The Operation In A Coroutine Of Its Own Context, As An Actor Does
+    template<class Result, class Functor>
+    Result AwaitIn(Functor &&func) {
+        asio::io_context ctx;
+
+        auto future = co_spawn(ctx, std::forward<Functor>(func), asio::use_future);
+        ctx.run();
+
+        return future.get();
+    }
+}
+
+
+/// The Save Stays In The Write-Behind Buffer, The Load Of The Same Document Must Still See It
+TEST(DataAccess, LoadAfterSaveWithShardKey) {
+    const auto server = CreateServer();
+    auto *module = server.GetModule<UDataAccess>();
+    ASSERT_NE(module, nullptr);
+
+    FLoadResult result;
+
+    for (int idx = 0; idx < DOCUMENT_COUNT; ++idx) {
+        const auto key = std::to_string(idx);
+        ASSERT_TRUE(module->SaveDocument(TEST_COLLECTION, key, "doc_" + key, idx));
+        ASSERT_TRUE(module->LoadDocument(TEST_COLLECTION, key, result.Bind(key), idx));
+    }
+
+    ASSERT_TRUE(unit::WaitFor([&result] { return result.count == DOCUMENT_COUNT; }));
+
+    std::unique_lock lock(result.mutex);
+    for (int idx = 0; idx < DOCUMENT_COUNT; ++idx) {
+        const auto key = std::to_string(idx);
+        ASSERT_TRUE(result.documents[key].has_value()) << key;
+        EXPECT_EQ(*result.documents[key], "doc_" + key);
+    }
+}
+
+/// Without The Shard Key Both Are Routed By The Document Key
+TEST(DataAccess, LoadAfterSaveByDocumentKey) {
+    const auto server = CreateServer();
+    auto *module = server.GetModule<UDataAccess>();
+    ASSERT_NE(module, nullptr);
+
+    FLoadResult result;
+
+    for (int idx = 0; idx < DOCUMENT_COUNT; ++idx) {
+        const auto key = std::to_string(idx);
+        ASSERT_TRUE(module->SaveDocument(TEST_COLLECTION, key, "first_" + key));
+        ASSERT_TRUE(module->SaveDocument(TEST_COLLECTION, key, "second_" + key));
+        ASSERT_TRUE(module->LoadDocument(TEST_COLLECTION, key, result.Bind(key)));
+    }
+
+    ASSERT_TRUE(unit::WaitFor([&result] { return result.count == DOCUMENT_COUNT; }));
+
+    std::unique_lock lock(result.mutex);
+    for (int idx = 0; idx < DOCUMENT_COUNT; ++idx) {
+        const auto key = std::to_string(idx);
+        ASSERT_TRUE(result.documents[key].has_value()) << key;
+        EXPECT_EQ(*result.documents[key], "second_" + key);
+    }
+}
+
+/// The Load Flushes Only The Write Of Its Own Document, The Rest Of The Collection Keeps Buffered
+TEST(DataAccess, LoadFlushesOnlyItsDocument) {
+    const auto server = CreateServer();
+    auto *module = server.GetModule<UDataAccess>();
+    ASSERT_NE(module, nullptr);
+
+    FLoadResult result;
+
+    // The Same Shard Key Puts Both In The Buffer Of One Worker
+    ASSERT_TRUE(module->SaveDocument(TEST_COLLECTION, "first", "doc_first", 1));
+    ASSERT_TRUE(module->SaveDocument(TEST_COLLECTION, "second", "doc_second", 1));
+    ASSERT_TRUE(module->LoadDocument(TEST_COLLECTION, "first", result.Bind("first"), 1));
+
+    // Checked Well Within The Flush Interval
+    EXPECT_EQ(module->GetPendingWriteCount(), 1u);
+
+    ASSERT_TRUE(unit::WaitFor([&result] { return result.count == 1; }));
+
+    std::unique_lock lock(result.mutex);
+    EXPECT_EQ(result.documents["first"], "doc_first");
+}
+
+/// Keyed Both With And Without The Shard Key, The Document Could Be Routed To Two Workers
+TEST(DataAccess, MixedShardKeyRefused) {
+    const auto server = CreateServer();
+    auto *module = server.GetModule<UDataAccess>();
+    ASSERT_NE(module, nullptr);
+
+    FLoadResult result;
+
+    ASSERT_TRUE(module->SaveDocument(TEST_COLLECTION, "key", "doc", 7));
+    EXPECT_FALSE(module->SaveDocument(TEST_COLLECTION, "key", "doc"));
+    EXPECT_FALSE(module->LoadDocument(TEST_COLLECTION, "key", result.Bind("key")));
+
+    // Another Collection Decides On Its Own
+    EXPECT_TRUE(module->SaveDocument("other_document", "key", "doc"));
+}
+
+TEST(DataAccess, LoadMissingDocument) {
+    const auto server = CreateServer();
+    auto *module = server.GetModule<UDataAccess>();
+    ASSERT_NE(module, nullptr);
+
+    FLoadResult result;
+    ASSERT_TRUE(module->LoadDocument(TEST_COLLECTION, "missing", result.Bind("missing")));
+
+    ASSERT_TRUE(unit::WaitFor([&result] { return result.count == 1; }));
+
+    std::unique_lock lock(result.mutex);
+    EXPECT_EQ(result.status["missing"], EDBLoadStatus::NOT_FOUND);
+    EXPECT_FALSE(result.documents["missing"].has_value());
+}
+
+TEST(DataAccess, AsyncSaveAndLoad) {
+    const auto server = CreateServer();
+    auto *module = server.GetModule<UDataAccess>();
+    ASSERT_NE(module, nullptr);
+
+    auto *adapter = dynamic_cast<UMemoryAdapter *>(module->GetAdapter());
+    ASSERT_NE(adapter, nullptr);
+
+    const bool bSaved = AwaitIn<bool>([adapter]() -> awaitable<bool> {
+        co_return co_await adapter->AsyncSave(TEST_COLLECTION, "async", "async_doc", asio::use_awaitable);
+    });
+    EXPECT_TRUE(bSaved);
+
+    const auto doc = AwaitIn<std::optional<std::string>>([adapter]() -> awaitable<std::optional<std::string>> {
+        co_return co_await adapter->AsyncLoad(TEST_COLLECTION, "async", asio::use_awaitable);
+    });
+    ASSERT_TRUE(doc.has_value());
+    EXPECT_EQ(*doc, "async_doc");
+}
+
+/// Not Set Up In The Data Access, Every Push Is Rejected And Still Completes
+TEST(DataAccess, AsyncRejectedCompletesWithFailure) {
+    UMemoryAdapter adapter;
+
+    const bool bSaved = AwaitIn<bool>([&adapter]() -> awaitable<bool> {
+        co_return co_await adapter.AsyncSave(TEST_COLLECTION, "rejected", "doc", asio::use_awaitable);
+    });
+    EXPECT_FALSE(bSaved);
+
+    const auto doc = AwaitIn<std::optional<std::string>>([&adapter]() -> awaitable<std::optional<std::string>> {
+        co_return co_await adapter.AsyncLoad(TEST_COLLECTION, "rejected", asio::use_awaitable);
+    });
+    EXPECT_FALSE(doc.has_value());
+}
+
+TEST(DataAccess, AsyncNullTaskCompletesWithFailure) {
+    const auto server = CreateServer();
+    auto *module = server.GetModule<UDataAccess>();
+    ASSERT_NE(module, nullptr);
+
+    const bool result = AwaitIn<bool>([module]() -> awaitable<bool> {
+        co_return co_await module->PushTaskAsync<bool>([]<class Callback>(Callback &&) {
+            return std::unique_ptr<IDBTaskBase>();
+        }, asio::use_awaitable);
+    });
+    EXPECT_FALSE(result);
+}
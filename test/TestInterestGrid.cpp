@@ -0,0 +1,213 @@
+#include "UnitTest.h"
+
+#include "aoi/InterestGrid.h"
+
+#include <unordered_map>
+#include <algorithm>
+#include <limits>
+#include <ranges>
+#include <random>
+
+
+namespace {
+    constexpr float WORLD_SIZE = 1000.f;
+    constexpr float CELL_SIZE = 50.f;
+    constexpr float VIEW_RADIUS = 80.f;
+
+    constexpr int ENTITY_COUNT = 200;
+    constexpr int ROUND_COUNT = 50;
+
+    /** The Grid Mirrored Without Cells, Everything Compared To Everything **/
+    class FBruteForce {
+
+    public:
+        void Set(const int64_t id, const float x, const float y) {
+            mPositions[id] = { std::clamp(x, 0.f, WORLD_SIZE), std::clamp(y, 0.f, WORLD_SIZE) };
+        }
+
+        void Erase(const int64_t id) {
+            mPositions.erase(id);
+        }
+
+        [[nodiscard]] std::vector<int64_t> VisibleOf(const int64_t id) const {
+            std::vector<int64_t> result;
+
+            const auto &[sx, sy] = mPositions.at(id);
+            for (const auto &[other, pos] : mPositions) {
+                const auto dx = pos.first - sx;
+                const auto dy = pos.second - sy;
+
+                if (other != id && dx * dx + dy * dy <= VIEW_RADIUS * VIEW_RADIUS) {
+                    result.emplace_back(other);
+                }
+            }
+
+            std::ranges::sort(result);
+            return result;
+        }
+
+        [[nodiscard]] const auto &Positions() const {
+            return mPositions;
+        }
+
+    private:
+        std::unordered_map<int64_t, std::pair<float, float>> mPositions;
+    };
+
+    /// Apply The Diffs To The Sight Kept By The Client, It Must End Up As The Grid Has
+    void ApplyDiff(std::unordered_map<int64_t, std::vector<int64_t>> &sights, const FInterestDiff &diff) {
+        auto &sight = sights[diff.watcher];
+
+        for (const auto &point : diff.enter) {
+            EXPECT_EQ(std::ranges::find(sight, point.id), sight.end());
+            sight.emplace_back(point.id);
+        }
+
+        for (const auto id : diff.leave) {
+            const auto iter = std::ranges::find(sight, id);
+            ASSERT_NE(iter, sight.end());
+            sight.erase(iter);
+        }
+
+        for (const auto &point : diff.update) {
+            EXPECT_NE(std::ranges::find(sight, point.id), sight.end());
+        }
+
+        std::ranges::sort(sight);
+    }
+}
+
+
+TEST(InterestGrid, MatchesBruteForce) {
+    UInterestGrid grid(WORLD_SIZE, WORLD_SIZE, CELL_SIZE, VIEW_RADIUS);
+    FBruteForce brute;
+
+    std::unordered_map<int64_t, std::vector<int64_t>> sights;
+
+    std::mt19937 engine(20261019);
+    // Out Of The Bounds On Both Sides, Clamped By Both
+    std::uniform_real_distribution<float> coord(-100.f, WORLD_SIZE + 100.f);
+    std::uniform_real_distribution<float> step(-60.f, 60.f);
+    std::uniform_int_distribution<int> action(0, 9);
+
+    for (int64_t id = 1; id <= ENTITY_COUNT; ++id) {
+        const auto x = coord(engine);
+        const auto y = coord(engine);
+
+        ASSERT_TRUE(grid.Add(id, x, y));
+        brute.Set(id, x, y);
+    }
+
+    for (int round = 0; round < ROUND_COUNT; ++round) {
+        for (int64_t id = 1; id <= ENTITY_COUNT; ++id) {
+            const auto act = action(engine);
+
+            if (!brute.Positions().contains(id)) {
+                // Come Back Later
+                if (act == 0) {
+                    const auto x = coord(engine);
+                    const auto y = coord(engine);
+
+                    ASSERT_TRUE(grid.Add(id, x, y));
+                    brute.Set(id, x, y);
+                }
+                continue;
+            }
+
+            if (act == 0) {
+                ASSERT_TRUE(grid.Remove(id));
+                brute.Erase(id);
+                sights.erase(id);
+            } else if (act < 6) {
+                const auto &[px, py] = brute.Positions().at(id);
+                const auto x = px + step(engine);
+                const auto y = py + step(engine);
+
+                ASSERT_TRUE(grid.Move(id, x, y));
+                brute.Set(id, x, y);
+            }
+        }
+
+        grid.Tick([&sights](const FInterestDiff &diff) {
+            ApplyDiff(sights, diff);
+        });
+
+        ASSERT_EQ(grid.Size(), brute.Positions().size());
+
+        for (const auto &id : brute.Positions() | std::views::keys) {
+            const auto *visible = grid.GetVisible(id);
+            ASSERT_NE(visible, nullptr);
+
+            const auto expected = brute.VisibleOf(id);
+            EXPECT_EQ(*visible, expected) << "Entity " << id << " In Round " << round;
+            EXPECT_EQ(sights[id], expected) << "Entity " << id << " In Round " << round;
+        }
+    }
+}
+
+TEST(InterestGrid, QueryRangeMatchesBruteForce) {
+    UInterestGrid grid(WORLD_SIZE, WORLD_SIZE, CELL_SIZE, VIEW_RADIUS);
+    FBruteForce brute;
+
+    std::mt19937 engine(42);
+    std::uniform_real_distribution<float> coord(0.f, WORLD_SIZE);
+
+    for (int64_t id = 1; id <= ENTITY_COUNT; ++id) {
+        const auto x = coord(engine);
+        const auto y = coord(engine);
+
+        grid.Add(id, x, y, false);
+        brute.Set(id, x, y);
+    }
+
+    for (int i = 0; i < 20; ++i) {
+        const auto x = coord(engine);
+        const auto y = coord(engine);
+
+        std::vector<int64_t> found;
+        grid.QueryRange(x, y, VIEW_RADIUS * 2, [&found](const FInterestPoint &point) {
+            found.emplace_back(point.id);
+        });
+        std::ranges::sort(found);
+
+        std::vector<int64_t> expected;
+        for (const auto &[id, pos] : brute.Positions()) {
+            const auto dx = pos.first - x;
+            const auto dy = pos.second - y;
+
+            if (dx * dx + dy * dy <= VIEW_RADIUS * 2 * (VIEW_RADIUS * 2)) {
+                expected.emplace_back(id);
+            }
+        }
+        std::ranges::sort(expected);
+
+        EXPECT_EQ(found, expected);
+    }
+}
+
+TEST(InterestGrid, RejectsNonFinite) {
+    UInterestGrid grid(WORLD_SIZE, WORLD_SIZE, CELL_SIZE, VIEW_RADIUS);
+
+    constexpr auto nan = std::numeric_limits<float>::quiet_NaN();
+    constexpr auto inf = std::numeric_limits<float>::infinity();
+
+    EXPECT_FALSE(grid.Add(1, nan, 10.f));
+    EXPECT_FALSE(grid.Add(1, 10.f, -inf));
+    EXPECT_FALSE(grid.Contains(1));
+
+    ASSERT_TRUE(grid.Add(1, 10.f, 10.f));
+    EXPECT_FALSE(grid.Move(1, nan, nan));
+    EXPECT_FALSE(grid.Move(1, inf, 10.f));
+
+    // Still In The Old Place
+    int hits = 0;
+    grid.QueryRange(10.f, 10.f, 1.f, [&hits](const FInterestPoint &point) {
+        EXPECT_EQ(point.id, 1);
+        ++hits;
+    });
+    EXPECT_EQ(hits, 1);
+
+    grid.QueryRange(nan, 10.f, VIEW_RADIUS, [](const FInterestPoint &) {
+        ADD_FAILURE() << "Non-Finite Query Visited";
+    });
+}
@@ -0,0 +1,248 @@
+#include "UnitTest.h"
+
+#include "Player.h"
+#include "AgentBase.h"
+#include "component/appear/AppearComponent.h"
+#include "component/stamina/StaminaComponent.h"
+
+#include "database/DataAccess.h"
+#include "database/memory/MemoryAdapter.h"
+#include "database/memory/MemoryStartUpData.h"
+
+#include <nlohmann/json.hpp>
+#include <Utils.h>
+#include <atomic>
+#include <mutex>
+
+
+namespace {
+    /** The Player ID Is Only Set By The Gateway, So The Documents Of The Test Are Keyed By -1 **/
+    constexpr auto PLAYER_KEY = "-1";
+
+    /** Stand-In Of UPlayerAgent, Only Drains Its Channel Into The Player **/
+    class UTestPlayerAgent final : public IAgentBase {
+
+    public:
+        UTestPlayerAgent(asio::io_context &ctx, IModuleBase *module, UPlayer *player)
+            : IAgentBase(ctx),
+              mPlayer(player) {
+            mModule = module;
+            mPlayer->SetUpAgent(this);
+        }
+
+        void Run() {
+            co_spawn(mContext, ProcessChannel(), detached);
+        }
+
+        /// The Save Timer Of The Player Keeps The Context Running, Cancel It Too
+        void Close() {
+            CancelAllTimers();
+            mChannel.close();
+        }
+
+    protected:
+        [[nodiscard]] IActorBase *GetActor() const override {
+            return mPlayer;
+        }
+
+    private:
+        UPlayer *mPlayer;
+    };
+
+    /** The Server With The Data Access On The Memory Adapter, And The Context Of The Player Agents **/
+    class FPlayerFixture : public testing::Test {
+
+    protected:
+        FPlayerFixture()
+            : mServer([](UServer *server) {
+                  if (auto *module = server->CreateModule<UDataAccess>(); module != nullptr) {
+                      module->SetDatabaseAdapter<UMemoryAdapter>();
+                      module->SetStartUpConfig([](const YAML::Node &) -> IDataAsset_Interface * {
+                          return new FMemoryStartUpData();
+                      });
+                  }
+              }),
+              mGuard(asio::make_work_guard(mContext)) {
+            mThread = std::thread([this] {
+                mContext.run();
+            });
+        }
+
+        ~FPlayerFixture() override {
+            for (const auto &agent : mAgents) {
+                asio::post(mContext, [agent] { agent->Close(); });
+            }
+            mGuard.reset();
+            mThread.join();
+        }
+
+        /// Create The Player On Its Own Agent And Log In, Wait Until The Components Loaded
+        UPlayer *Login() {
+            auto *plr = Spawn();
+
+            const bool bLoaded = unit::WaitFor([this, plr] {
+                return unit::RunIn(mContext, [plr] { return plr->IsLoaded(); });
+            });
+            EXPECT_TRUE(bLoaded);
+
+            return plr;
+        }
+
+        /// Create The Player On Its Own Agent And Log In, Not Waiting For The Load
+        UPlayer *Spawn() {
+            auto &player = mPlayers.emplace_back(std::make_unique<UPlayer>());
+            auto *plr = player.get();
+
+            const auto agent = std::make_shared<UTestPlayerAgent>(mContext, mServer.GetModule<UDataAccess>(), plr);
+            mAgents.emplace_back(agent);
+
+            unit::RunIn(mContext, [agent, plr] {
+                agent->Run();
+                plr->Initial();
+                plr->OnLogin();
+            });
+
+            return plr;
+        }
+
+        /// Read The Saved Document Back, After The Writes Pushed Before
+        std::optional<std::string> LoadDocument(const std::string &col) const {
+            std::mutex mutex;
+            std::optional<std::string> result;
+            std::atomic_bool bReturned = false;
+
+            auto *module = mServer.GetModule<UDataAccess>();
+            EXPECT_TRUE(module->LoadDocument(col, PLAYER_KEY, [&](const EDBLoadStatus status, std::string doc) {
+                std::unique_lock lock(mutex);
+                EXPECT_NE(status, EDBLoadStatus::FAILED);
+                if (status == EDBLoadStatus::FOUND) {
+                    result = std::move(doc);
+                }
+                bReturned = true;
+            }));
+
+            EXPECT_TRUE(unit::WaitFor([&bReturned] { return bReturned.load(); }));
+
+            std::unique_lock lock(mutex);
+            return result;
+        }
+
+    protected:
+        unit::FTestServer mServer;
+
+        asio::io_context mContext;
+        asio::executor_work_guard<asio::io_context::executor_type> mGuard;
+        std::thread mThread;
+
+        std::vector<std::shared_ptr<UTestPlayerAgent>> mAgents;
+        std::vector<std::unique_ptr<UPlayer>> mPlayers;
+    };
+}
+
+
+/// Nothing Changed Since Login, Nothing Written
+TEST_F(FPlayerFixture, SaveSkipsCleanComponent) {
+    auto *plr = Login();
+
+    unit::RunIn(mContext, [plr] {
+        plr->Save();
+    });
+
+    EXPECT_FALSE(LoadDocument("Appear").has_value());
+}
+
+/// The Mutation Marks The Component Dirty, The Save Writes Its Document
+TEST_F(FPlayerFixture, MutatedComponentReachesSaveDocument) {
+    auto *plr = Login();
+
+    unit::RunIn(mContext, [plr] {
+        auto *comp = plr->GetComponent<UAppearComponent>();
+        ASSERT_NE(comp, nullptr);
+
+        EXPECT_TRUE(comp->ActiveAvatar(3));
+        EXPECT_TRUE(comp->UseAvatar(3));
+        EXPECT_TRUE(comp->IsDirty());
+
+        plr->Save();
+        EXPECT_FALSE(comp->IsDirty());
+    });
+
+    const auto doc = LoadDocument("Appear");
+    ASSERT_TRUE(doc.has_value());
+
+    const auto json = nlohmann::json::parse(*doc);
+    EXPECT_EQ(json.value("current_index", 0), 3);
+    ASSERT_EQ(json["avatar_list"].size(), 1);
+    EXPECT_EQ(json["avatar_list"][0].value("index", 0), 3);
+    EXPECT_TRUE(json["avatar_list"][0].value("active", false));
+}
+
+/// The Next Login Deserializes The Saved Document, Still Buffered Or Not
+TEST_F(FPlayerFixture, LoginLoadsSavedComponent) {
+    auto *first = Login();
+
+    unit::RunIn(mContext, [first] {
+        auto *comp = first->GetComponent<UAppearComponent>();
+        comp->ActiveAvatar(5);
+        comp->UseAvatar(5);
+
+        first->OnLogout();
+        first->Save();
+    });
+
+    auto *second = Login();
+
+    unit::RunIn(mContext, [second] {
+        const auto *comp = second->GetComponent<UAppearComponent>();
+        ASSERT_NE(comp, nullptr);
+
+        EXPECT_EQ(comp->GetCurrentIndex(), 5);
+        EXPECT_TRUE(comp->IsAvatarActive(5));
+        EXPECT_FALSE(comp->IsDirty());
+    });
+}
+
+/// The Stored Document Can Not Be Read, Never Log In With The Default And Overwrite It
+TEST_F(FPlayerFixture, CorruptDocumentNotOverwritten) {
+    constexpr auto corrupt = "{ not a json";
+
+    auto *module = mServer.GetModule<UDataAccess>();
+    ASSERT_TRUE(module->SaveDocument("Appear", PLAYER_KEY, corrupt));
+
+    auto *plr = Spawn();
+
+    // The First Round Returned, The Retry Is Still Waiting For Its Timer
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+    unit::RunIn(mContext, [plr] {
+        EXPECT_FALSE(plr->IsLoaded());
+
+        auto *comp = plr->GetComponent<UAppearComponent>();
+        ASSERT_NE(comp, nullptr);
+
+        comp->ActiveAvatar(7);
+        plr->Save();
+    });
+
+    EXPECT_EQ(LoadDocument("Appear"), corrupt);
+}
+
+/// The Components Not In The Pools Still Tick When The World Runs The Phase Instead Of The Player
+TEST_F(FPlayerFixture, WorldTickRunsComponentHooks) {
+    auto *plr = Login();
+
+    unit::RunIn(mContext, [this, plr] {
+        auto *comp = plr->GetComponent<UStaminaComponent>();
+        ASSERT_NE(comp, nullptr);
+
+        comp->Deserialize({ { "value", 20 }, { "regen_time", utils::UnixTime() - stamina::REGEN_INTERVAL * 5 } });
+
+        UPlayerWorld world(mContext, FWorldOptions{});
+        UComponentModule::RegisterWorldSystems(world);
+        world.CreatePlayer(plr, plr->GetPlayerID());
+
+        world.RunPhase(EWorldPhase::TICK, std::chrono::steady_clock::now());
+
+        EXPECT_EQ(comp->GetStamina(), 25);
+    });
+}
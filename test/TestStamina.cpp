@@ -0,0 +1,77 @@
+#include "UnitTest.h"
+
+#include "PlayerWorld.h"
+#include "ComponentModule.h"
+#include "component/stamina/StaminaComponent.h"
+
+#include <Utils.h>
+
+
+TEST(Stamina, RegenByTimeGone) {
+    FStaminaState state{ 10, 1000, 0, 0 };
+
+    stamina::Regen(state, 1000 + stamina::REGEN_INTERVAL - 1);
+    EXPECT_EQ(state.value, 10);
+
+    // The Remainder Is Kept For The Next Step
+    stamina::Regen(state, 1000 + stamina::REGEN_INTERVAL * 3 + 5);
+    EXPECT_EQ(state.value, 13);
+    EXPECT_EQ(state.regenTime, 1000 + stamina::REGEN_INTERVAL * 3);
+
+    stamina::Regen(state, 1000 + stamina::REGEN_INTERVAL * 1000);
+    EXPECT_EQ(state.value, stamina::MAX_VALUE);
+    EXPECT_EQ(state.regenTime, 1000 + stamina::REGEN_INTERVAL * 1000);
+}
+
+TEST(Stamina, ResetDailyOnlyOnNewDay) {
+    FStaminaState state{ 0, 0, 2, 100 };
+
+    stamina::ResetDaily(state, 100);
+    EXPECT_EQ(state.refillCount, 2);
+
+    stamina::ResetDaily(state, 200);
+    EXPECT_EQ(state.refillCount, 0);
+    EXPECT_EQ(state.refillDay, 200);
+}
+
+/// The TICK System Over The Pool And The Component Ticked Alone Give The Same State
+TEST(Stamina, WorldSystemSameAsComponentTick) {
+    const auto regenTime = utils::UnixTime() - stamina::REGEN_INTERVAL * 5;
+
+    asio::io_context ctx;
+    UPlayerWorld world(ctx, FWorldOptions{});
+    UComponentModule::RegisterWorldSystems(world);
+
+    auto &registry = world.GetRegistry();
+    const auto entity = registry.create();
+    registry.emplace<FStaminaState>(entity, 20, regenTime, 0, 0);
+
+    world.RunPhase(EWorldPhase::TICK, std::chrono::steady_clock::now());
+
+    UStaminaComponent comp;
+    comp.Deserialize({ { "value", 20 }, { "regen_time", regenTime } });
+    comp.OnTick();
+
+    EXPECT_EQ(registry.get<FStaminaState>(entity).value, 25);
+    EXPECT_EQ(comp.GetStamina(), 25);
+}
+
+TEST(Stamina, ConsumeAndRefillMarkDirty) {
+    UStaminaComponent comp;
+    EXPECT_EQ(comp.GetStamina(), stamina::MAX_VALUE);
+
+    EXPECT_FALSE(comp.Refill());
+    EXPECT_FALSE(comp.IsDirty());
+
+    EXPECT_TRUE(comp.Consume(30));
+    EXPECT_TRUE(comp.IsDirty());
+    EXPECT_EQ(comp.GetStamina(), stamina::MAX_VALUE - 30);
+    EXPECT_FALSE(comp.Consume(stamina::MAX_VALUE));
+
+    for (int idx = 0; idx < stamina::DAILY_REFILL; ++idx) {
+        EXPECT_TRUE(comp.Refill());
+        EXPECT_TRUE(comp.Consume(1));
+    }
+    EXPECT_FALSE(comp.Refill());
+    EXPECT_EQ(comp.GetRefillCount(), stamina::DAILY_REFILL);
+}
@@ -0,0 +1,39 @@
+#include "UnitTest.h"
+
+#include "AgentBase.h"
+#include "gateway/PlayerAgent.h"
+#include "service/ServiceAgent.h"
+
+
+TEST(TypeTag, RegisterRejectsCollision) {
+    constexpr auto tag = type_tag::USER + 901;
+
+    // Each Library Including The Class Registers It Again
+    EXPECT_TRUE(type_tag::Register(tag, "UTagFirst"));
+    EXPECT_TRUE(type_tag::Register(tag, "UTagFirst"));
+
+    // Never Thrown, It Runs In The Static Initializer; Counted For The Loader Instead
+    const auto conflicts = type_tag::GetConflictCount();
+    EXPECT_FALSE(type_tag::Register(tag, "UTagSecond"));
+    EXPECT_EQ(type_tag::GetConflictCount(), conflicts + 1);
+}
+
+TEST(TypeTag, RootTagsReserved) {
+    EXPECT_FALSE(type_tag::Register(type_tag::ACTOR, "UTagActor"));
+    EXPECT_FALSE(type_tag::Register(type_tag::AGENT, "UTagAgent"));
+}
+
+/// The Agents Linked Into The Test Hold Their Own Tags, Registering Again Finds No Conflict
+TEST(TypeTag, LinkedTagsUnique) {
+    const auto conflicts = type_tag::GetConflictCount();
+
+    EXPECT_TRUE(type_tag::Register(UPlayerAgent::TYPE_TAG, UPlayerAgent::TYPE_NAME));
+    EXPECT_TRUE(type_tag::Register(UServiceAgent::TYPE_TAG, UServiceAgent::TYPE_NAME));
+    EXPECT_EQ(type_tag::GetConflictCount(), conflicts);
+}
+
+TEST(TypeTag, AgentsTagged) {
+    EXPECT_TRUE(type_tag::IsTagOf<UPlayerAgent>(type_tag::AGENT));
+    EXPECT_TRUE(type_tag::IsTagOf<UServiceAgent>(type_tag::AGENT));
+    EXPECT_FALSE(type_tag::IsTagOf<UPlayerAgent>(type_tag::SERVICE_AGENT));
+}
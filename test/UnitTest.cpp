@@ -0,0 +1,88 @@
+/**
+ * The Unit Tests Of The Core And The Player Agent;
+ * The Extra Option --uranus_config=<dir> Points To The Directory Of server.yaml
+ */
+
+#include "UnitTest.h"
+#include "config/Config.h"
+
+#include <spdlog/spdlog.h>
+#include <string_view>
+#include <vector>
+
+
+namespace {
+    std::string gConfigPath = "../../config";
+}
+
+const std::string &unit::GetConfigPath() {
+    return gConfigPath;
+}
+
+bool unit::WaitFor(const std::function<bool()> &pred, const std::chrono::milliseconds timeout) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!std::invoke(pred)) {
+        if (std::chrono::steady_clock::now() >= deadline)
+            return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return true;
+}
+
+unit::FTestServer::FTestServer(const std::function<void(UServer *)> &setup)
+    : mServer(new UServer()) {
+
+    if (auto *config = mServer->CreateModule<UConfig>(); config != nullptr) {
+        config->SetYAMLPath(GetConfigPath());
+        config->SetJSONPath(GetConfigPath());
+    }
+
+    if (setup != nullptr) {
+        std::invoke(setup, mServer.get());
+    }
+
+    mThread = std::thread([this] {
+        mServer->Initial();
+        mServer->Start();
+    });
+
+    while (mServer->GetState() != EServerState::RUNNING) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+}
+
+unit::FTestServer::~FTestServer() {
+    asio::post(mServer->GetIOContext(), [this] {
+        mServer->Shutdown();
+    });
+    mThread.join();
+}
+
+UServer *unit::FTestServer::GetServer() const {
+    return mServer.get();
+}
+
+int main(int argc, char *argv[]) {
+    constexpr std::string_view CONFIG_OPTION = "--uranus_config=";
+
+    // Take Out The Own Option Before The Test Library Parses The Rest
+    std::vector<char *> args;
+    for (int idx = 0; idx < argc; ++idx) {
+        if (const std::string_view arg = argv[idx]; arg.starts_with(CONFIG_OPTION)) {
+            gConfigPath = arg.substr(CONFIG_OPTION.size());
+            continue;
+        }
+        args.emplace_back(argv[idx]);
+    }
+
+    int count = static_cast<int>(args.size());
+
+    spdlog::set_level(spdlog::level::warn);
+
+    testing::InitGoogleTest(&count, args.data());
+    const int result = RUN_ALL_TESTS();
+
+    spdlog::drop_all();
+
+    return result;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Server.h"
+
+#include <gtest/gtest.h>
+#include <functional>
+#include <future>
+#include <chrono>
+#include <thread>
+#include <string>
+
+
+namespace unit {
+    /// The Directory Of server.yaml, For The Tests That Need A Running UServer
+    const std::string &GetConfigPath();
+
+    /// Poll Until The Predicate Holds, Return False If Timeout
+    bool WaitFor(const std::function<bool()> &pred, std::chrono::milliseconds timeout = std::chrono::seconds(5));
+
+    /// Run The Function In The Thread Of The Context And Wait For Its Result
+    template<class Functor>
+    auto RunIn(asio::io_context &ctx, Functor &&func) -> std::invoke_result_t<Functor>;
+
+    /**
+     * The Running Server Of One Test, With The Config Module And The Modules Created By The SetUp;
+     * Started In Its Own Thread And Shut Down On Destruction
+     */
+    class FTestServer final {
+
+    public:
+        explicit FTestServer(const std::function<void(UServer *)> &setup);
+        ~FTestServer();
+
+        DISABLE_COPY_MOVE(FTestServer)
+
+        [[nodiscard]] UServer *GetServer() const;
+
+        template<class Type>
+        requires std::derived_from<Type, IModuleBase>
+        Type *GetModule() const;
+
+    private:
+        std::unique_ptr<UServer> mServer;
+        std::thread mThread;
+    };
+
+    template<class Functor>
+    auto RunIn(asio::io_context &ctx, Functor &&func) -> std::invoke_result_t<Functor> {
+        std::packaged_task<std::invoke_result_t<Functor>()> task(std::forward<Functor>(func));
+        auto future = task.get_future();
+
+        asio::post(ctx, [&task] { task(); });
+        return future.get();
+    }
+
+    template<class Type>
+    requires std::derived_from<Type, IModuleBase>
+    Type *FTestServer::GetModule() const {
+        return mServer->GetModule<Type>();
+    }
+}
@@ -0,0 +1,242 @@
+#include "BinaryLogDecoder.h"
+#include "BinaryLogFormat.h"
+
+#include <spdlog/common.h>
+#include <spdlog/fmt/fmt.h>
+
+#if defined(SPDLOG_FMT_EXTERNAL)
+#include <fmt/args.h>
+#else
+#include <spdlog/fmt/bundled/args.h>
+#endif
+
+#include <unordered_map>
+
+
+namespace {
+    struct FFormatDefine {
+        uint8_t level;
+        uint32_t line;
+        std::string file;
+        std::string format;
+    };
+
+    class UBinaryLogReader final {
+
+    public:
+        explicit UBinaryLogReader(const std::vector<uint8_t> &data)
+            : mData(data),
+              mPos(0) {
+        }
+
+        [[nodiscard]] bool HasMore(const size_t size) const {
+            return mPos + size <= mData.size();
+        }
+
+        template<class T>
+        T Read() {
+            const auto val = binary_log::ReadValue<T>(mData.data() + mPos);
+            mPos += sizeof(T);
+            return val;
+        }
+
+        std::string ReadString(const size_t length) {
+            std::string str(reinterpret_cast<const char *>(mData.data() + mPos), length);
+            mPos += length;
+            return str;
+        }
+
+        [[nodiscard]] const uint8_t *Current() const {
+            return mData.data() + mPos;
+        }
+
+        void Skip(const size_t size) {
+            mPos += size;
+        }
+
+    private:
+        const std::vector<uint8_t> &mData;
+        size_t mPos;
+    };
+
+
+    /// True If The Record Still Has The Size Of Bytes From The Data, Compared Without Overflowing The Pointer
+    bool HasBytes(const uint8_t *data, const uint8_t *end, const size_t size) {
+        return data <= end && static_cast<size_t>(end - data) >= size;
+    }
+
+    bool DecodeArgs(const uint8_t *data, const uint8_t *end, const uint8_t count, fmt::dynamic_format_arg_store<fmt::format_context> &store) {
+        using namespace binary_log;
+
+        for (uint8_t idx = 0; idx < count; ++idx) {
+            if (data >= end)
+                return false;
+
+            const auto type = static_cast<EArgType>(*data++);
+            switch (type) {
+                case EArgType::INT64: {
+                    if (!HasBytes(data, end, sizeof(int64_t)))
+                        return false;
+
+                    store.push_back(ReadValue<int64_t>(data));
+                    data += sizeof(int64_t);
+                }
+                break;
+                case EArgType::UINT64: {
+                    if (!HasBytes(data, end, sizeof(uint64_t)))
+                        return false;
+
+                    store.push_back(ReadValue<uint64_t>(data));
+                    data += sizeof(uint64_t);
+                }
+                break;
+                case EArgType::DOUBLE: {
+                    if (!HasBytes(data, end, sizeof(double)))
+                        return false;
+
+                    store.push_back(ReadValue<double>(data));
+                    data += sizeof(double);
+                }
+                break;
+                case EArgType::BOOL: {
+                    if (!HasBytes(data, end, sizeof(uint8_t)))
+                        return false;
+
+                    store.push_back(*data != 0);
+                    data += sizeof(uint8_t);
+                }
+                break;
+                case EArgType::CHAR: {
+                    if (!HasBytes(data, end, sizeof(uint8_t)))
+                        return false;
+
+                    store.push_back(static_cast<char>(*data));
+                    data += sizeof(uint8_t);
+                }
+                break;
+                case EArgType::STRING: {
+                    if (!HasBytes(data, end, sizeof(uint32_t)))
+                        return false;
+
+                    const auto length = ReadValue<uint32_t>(data);
+                    data += sizeof(uint32_t);
+                    if (!HasBytes(data, end, length))
+                        return false;
+
+                    store.push_back(std::string(reinterpret_cast<const char *>(data), length));
+                    data += length;
+                }
+                break;
+                default:
+                    return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+
+bool DecodeBinaryLog(const std::vector<uint8_t> &content, FDecodedLog &result) {
+    UBinaryLogReader reader(content);
+
+    if (!reader.HasMore(sizeof(binary_log::FILE_MAGIC) + sizeof(uint32_t) + sizeof(uint16_t)) ||
+        std::memcmp(reader.Current(), binary_log::FILE_MAGIC, sizeof(binary_log::FILE_MAGIC)) != 0) {
+        result.errors.emplace_back("Not A Binary Log File");
+        return false;
+    }
+
+    reader.Skip(sizeof(binary_log::FILE_MAGIC));
+
+    if (const auto version = reader.Read<uint32_t>(); version != binary_log::FILE_VERSION) {
+        result.errors.emplace_back(fmt::format("Unsupported Version {}", version));
+        return false;
+    }
+
+    const auto nameLength = reader.Read<uint16_t>();
+    if (!reader.HasMore(nameLength))
+        return false;
+
+    result.name = reader.ReadString(nameLength);
+
+    std::unordered_map<uint32_t, FFormatDefine> formatMap;
+
+    while (reader.HasMore(sizeof(uint8_t))) {
+        const auto tag = reader.Read<uint8_t>();
+
+        if (tag == binary_log::ENTRY_FORMAT) {
+            if (!reader.HasMore(sizeof(uint32_t) + sizeof(uint8_t) + sizeof(uint32_t) + sizeof(uint16_t)))
+                break;
+
+            FFormatDefine define;
+
+            const auto id = reader.Read<uint32_t>();
+            define.level = reader.Read<uint8_t>();
+            define.line = reader.Read<uint32_t>();
+
+            const auto fileLength = reader.Read<uint16_t>();
+            if (!reader.HasMore(fileLength + sizeof(uint32_t)))
+                break;
+            define.file = reader.ReadString(fileLength);
+
+            const auto formatLength = reader.Read<uint32_t>();
+            if (!reader.HasMore(formatLength))
+                break;
+            define.format = reader.ReadString(formatLength);
+
+            formatMap.insert_or_assign(id, std::move(define));
+            continue;
+        }
+
+        if (tag != binary_log::ENTRY_RECORD) {
+            result.errors.emplace_back(fmt::format("Corrupted Entry Tag {}", tag));
+            return false;
+        }
+
+        if (!reader.HasMore(binary_log::RECORD_HEADER_SIZE))
+            break;
+
+        const auto *record = reader.Current();
+        const auto size = binary_log::ReadValue<uint32_t>(record);
+        if (size < binary_log::RECORD_HEADER_SIZE || !reader.HasMore(size))
+            break;
+
+        reader.Skip(size);
+
+        const auto formatID = binary_log::ReadValue<uint32_t>(record + sizeof(uint32_t) * 2);
+        const auto argCount = binary_log::ReadValue<uint8_t>(record + sizeof(uint32_t) * 3);
+        const auto timestamp = binary_log::ReadValue<int64_t>(record + sizeof(uint32_t) * 3 + sizeof(uint8_t));
+
+        const auto iter = formatMap.find(formatID);
+        if (iter == formatMap.end()) {
+            result.errors.emplace_back(fmt::format("Unknown Format ID {}", formatID));
+            continue;
+        }
+
+        const auto &define = iter->second;
+
+        fmt::dynamic_format_arg_store<fmt::format_context> store;
+
+        std::string message;
+        if (DecodeArgs(record + binary_log::RECORD_HEADER_SIZE, record + size, argCount, store)) {
+            try {
+                message = fmt::vformat(define.format, store);
+            } catch (const std::exception &e) {
+                message = fmt::format("{} <Format Error: {}>", define.format, e.what());
+            }
+        } else {
+            message = fmt::format("{} <Corrupted Arguments>", define.format);
+        }
+
+        // The Level Comes From The File, Out Of The Enum If Corrupted
+        const auto levelName = define.level < spdlog::level::n_levels
+            ? spdlog::level::to_string_view(static_cast<spdlog::level::level_enum>(define.level))
+            : spdlog::string_view_t("unknown");
+
+        result.records.emplace_back(
+            std::string(levelName.data(), levelName.size()),
+            define.file, define.line, timestamp, std::move(message));
+    }
+
+    return true;
+}
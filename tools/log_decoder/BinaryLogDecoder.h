@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+/**
+ * One Record Rebuilt Into Text, The Timestamp In Nanoseconds Since Epoch
+ */
+struct FDecodedRecord {
+    std::string level;
+    std::string file;
+    uint32_t line = 0;
+    int64_t timestamp = 0;
+    std::string message;
+};
+
+/**
+ * The Content Of One Binary Log File, The Broken Entries Are Skipped With An Error Each
+ */
+struct FDecodedLog {
+    std::string name;
+    std::vector<FDecodedRecord> records;
+    std::vector<std::string> errors;
+};
+
+
+/// Decode The Whole Content Of The File Written By UBinaryLogBackend,
+/// False If It Is Not A Binary Log Or Of Another Version
+bool DecodeBinaryLog(const std::vector<uint8_t> &content, FDecodedLog &result);
@@ -0,0 +1,62 @@
+/**
+ * Decode The Binary Log File Written By UBinaryLogBackend Into Text
+ * Usage: log_decoder <file.blog> [<file.blog> ...]
+ */
+
+#include "BinaryLogDecoder.h"
+
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/fmt/chrono.h>
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+
+static bool DecodeFile(const std::string &path) {
+    std::ifstream input(path, std::ios::binary);
+    if (!input.is_open()) {
+        std::cerr << fmt::format("Failed To Open {}", path) << std::endl;
+        return false;
+    }
+
+    const std::vector<uint8_t> content{ std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>() };
+
+    FDecodedLog log;
+    const bool bDecoded = DecodeBinaryLog(content, log);
+
+    for (const auto &error : log.errors) {
+        std::cerr << fmt::format("{} {}", path, error) << std::endl;
+    }
+
+    for (const auto &record : log.records) {
+        const auto point = std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(record.timestamp)));
+        const auto micro = (record.timestamp / 1000) % 1000000;
+
+        std::cout << fmt::format("[{:%Y-%m-%d %H:%M:%S}.{:06}] [{}] [{}] [{}:{}] {}",
+            fmt::localtime(std::chrono::system_clock::to_time_t(point)), micro,
+            log.name, record.level, record.file, record.line, record.message) << '\n';
+    }
+
+    std::cout.flush();
+    return bDecoded;
+}
+
+int main(const int argc, char *argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: log_decoder <file.blog> [<file.blog> ...]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    int result = EXIT_SUCCESS;
+    for (int idx = 1; idx < argc; ++idx) {
+        if (!DecodeFile(argv[idx])) {
+            result = EXIT_FAILURE;
+        }
+    }
+
+    return result;
+}